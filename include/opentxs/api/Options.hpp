@@ -32,6 +32,7 @@ public:
     auto BlockchainBindIpv4() const noexcept -> const std::set<std::string>&;
     auto BlockchainBindIpv6() const noexcept -> const std::set<std::string>&;
     auto BlockchainStorageLevel() const noexcept -> int;
+    auto BlockchainSyncInterval() const noexcept -> int;
     auto BlockchainWalletEnabled() const noexcept -> bool;
     auto DefaultMintKeyBytes() const noexcept -> std::size_t;
     auto DisabledBlockchains() const noexcept -> std::set<blockchain::Type>;
@@ -70,6 +71,7 @@ public:
         const char* value) noexcept -> Options&;
     auto ParseCommandLine(int argc, char** argv) noexcept -> Options&;
     auto SetBlockchainStorageLevel(int value) noexcept -> Options&;
+    auto SetBlockchainSyncInterval(int milliseconds) noexcept -> Options&;
     auto SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&;
     auto SetBlockchainWalletEnabled(bool enabled) noexcept -> Options&;
     auto SetDefaultMintKeyBytes(std::size_t bytes) noexcept -> Options&;
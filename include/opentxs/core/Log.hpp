@@ -33,6 +33,21 @@
         ::opentxs::LogOutput.Assert(__FILE__, __LINE__, (s));                  \
     };
 
+// Lazy logging: the remainder of the statement, including the evaluation of
+// its arguments, is skipped unless the level is enabled. Levels above
+// OT_LOG_MAX_LEVEL are eliminated at compile time.
+//
+// OT_LOG_TRACE(OT_METHOD)(__func__)(": ")(data->asHex()).Flush();
+#define OT_LOG_IF(SOURCE, LEVEL)                                               \
+    if (((LEVEL) > OT_LOG_MAX_LEVEL) || (false == (SOURCE).Enabled())) {       \
+    } else                                                                     \
+        (SOURCE)
+#define OT_LOG_DETAIL OT_LOG_IF(::opentxs::LogDetail, 1)
+#define OT_LOG_VERBOSE OT_LOG_IF(::opentxs::LogVerbose, 2)
+#define OT_LOG_DEBUG OT_LOG_IF(::opentxs::LogDebug, 3)
+#define OT_LOG_TRACE OT_LOG_IF(::opentxs::LogTrace, 4)
+#define OT_LOG_INSANE OT_LOG_IF(::opentxs::LogInsane, 5)
+
 #define OT_INTERMEDIATE_FORMAT(OT_THE_ERROR_STRING)                            \
     ((std::string(OT_METHOD) + std::string(__func__) + std::string(": ") +     \
       std::string(OT_THE_ERROR_STRING) + std::string("\n"))                    \
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -64,9 +65,19 @@ public:
     template <typename T>
     auto operator()(const T& in) const noexcept -> const LogSource&
     {
+        if (false == Enabled()) { return *this; }
+
         return this->operator()(std::to_string(in));
     }
 
+    /// Returns false if messages at this level would be discarded, either
+    /// because of the runtime verbosity or because the level exceeds
+    /// OT_LOG_MAX_LEVEL
+    auto Enabled() const noexcept -> bool
+    {
+        return (OT_LOG_MAX_LEVEL >= level_) && (verbosity_.load() >= level_);
+    }
+
     [[noreturn]] void Assert(
         const char* file,
         const std::size_t line,
@@ -80,16 +91,16 @@ public:
     ~LogSource() = default;
 
 private:
-    using Source = std::pair<OTZMQPushSocket, std::stringstream>;
+    struct Buffer;
+    struct Buffers;
 
     static std::atomic<int> verbosity_;
     static std::atomic<bool> running_;
-    static std::mutex buffer_lock_;
-    static std::map<std::thread::id, Source> buffer_;
 
     const int level_{-1};
 
-    static auto get_buffer(std::string& id) noexcept -> Source&;
+    static auto buffers() noexcept -> Buffers&;
+    static auto get_buffer() noexcept -> Buffer*;
 
     void send(const bool terminate) const noexcept;
 
@@ -8,6 +8,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -103,6 +104,14 @@ public:
         const blockchain::Type chain,
         const PasswordPrompt& reason,
         const std::uint8_t version = 0) const noexcept -> ECKey = 0;
+    virtual auto Incoming(
+        const PaymentCode& sender,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version = 0) const noexcept
+        -> std::vector<ECKey> = 0;
     virtual auto Locator(
         const AllocateOutput destination,
         const std::uint8_t version = 0) const noexcept -> bool = 0;
@@ -112,6 +121,14 @@ public:
         const blockchain::Type chain,
         const PasswordPrompt& reason,
         const std::uint8_t version = 0) const noexcept -> ECKey = 0;
+    virtual auto Outgoing(
+        const PaymentCode& recipient,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version = 0) const noexcept
+        -> std::vector<ECKey> = 0;
     virtual auto Serialize(AllocateOutput destination) const noexcept
         -> bool = 0;
     OPENTXS_NO_EXPORT virtual auto Serialize(
@@ -8,6 +8,11 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
 #include "opentxs/crypto/library/AsymmetricProvider.hpp"
 
 namespace opentxs
@@ -17,6 +22,12 @@ namespace crypto
 class OPENTXS_EXPORT EcdsaProvider : virtual public AsymmetricProvider
 {
 public:
+    /// plaintext, public key, signature
+    using Verification = std::tuple<ReadView, ReadView, ReadView>;
+    /// Schedules a job on another thread. Returns false if the job was not
+    /// accepted.
+    using Executor = std::function<bool(std::function<void()>)>;
+
     virtual auto PubkeyAdd(
         const ReadView pubkey,
         const ReadView scalar,
@@ -33,6 +44,14 @@ public:
         const ReadView key,
         const crypto::HashType hash,
         Space& signature) const noexcept -> bool = 0;
+    /// Verifies every item and returns one result per item in the same order
+    ///
+    /// If the executor is not empty the work is spread over the threads it
+    /// schedules jobs on, otherwise it happens on the calling thread.
+    virtual auto VerifyBatch(
+        const std::vector<Verification>& items,
+        const crypto::HashType hashType,
+        const Executor& executor) const noexcept -> std::vector<bool> = 0;
 
     ~EcdsaProvider() override = default;
 
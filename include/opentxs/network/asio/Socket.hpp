@@ -61,6 +61,10 @@ public:
         const ReadView notify,
         const OTZMQWorkType type,
         const std::size_t bytes) noexcept -> bool;
+    auto ReceiveSome(
+        const ReadView notify,
+        const OTZMQWorkType type,
+        const std::size_t bytes) noexcept -> bool;
     auto Transmit(const ReadView data, Notification notifier) noexcept -> bool;
 
     OPENTXS_NO_EXPORT Socket(Imp* imp) noexcept;
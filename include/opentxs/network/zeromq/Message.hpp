@@ -8,6 +8,8 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <string>
+
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -89,6 +91,8 @@ public:
     }
     virtual auto AddFrame(const void* input, const std::size_t size)
         -> Frame& = 0;
+    virtual auto AddFrame(Space&& input) -> Frame& = 0;
+    virtual auto AddFrame(std::string&& input) -> Frame& = 0;
     virtual auto AppendBytes() noexcept -> AllocateOutput = 0;
     virtual auto at(const std::size_t index) -> Frame& = 0;
     virtual auto Body() -> FrameSection = 0;
@@ -48,6 +48,10 @@ auto StoragePurseAllowedStorageItemHash() noexcept -> const VersionMap&;
 auto StorageSeedsAllowedStorageItemHash() noexcept -> const VersionMap&;
 auto StorageServersAllowedStorageItemHash() noexcept -> const VersionMap&;
 auto StorageThreadAllowedItem() noexcept -> const VersionMap&;
+auto StorageThreadAllowedStorageThreadPageRef() noexcept -> const VersionMap&;
+auto StorageThreadPageAllowedItem() noexcept -> const VersionMap&;
+auto StorageThreadPageAllowedStorageThreadPageRef() noexcept
+    -> const VersionMap&;
 auto StorageUnitsAllowedStorageItemHash() noexcept -> const VersionMap&;
 }  // namespace proto
 }  // namespace opentxs
@@ -768,6 +768,12 @@ public:
         const Digest& hash,
         const Random& random,
         const Flag& bucket) -> opentxs::api::storage::Plugin*;
+    static auto StorageFSPacked(
+        const api::storage::Storage& storage,
+        const StorageConfig& config,
+        const Digest& hash,
+        const Random& random,
+        const Flag& bucket) -> opentxs::api::storage::Plugin*;
     static auto StorageMemDB(
         const api::storage::Storage& storage,
         const StorageConfig& config,
@@ -44,6 +44,7 @@ struct Options::Imp::Parser {
     static constexpr auto blockchain_ipv4_bind_{"blockchain_bind_ipv4"};
     static constexpr auto blockchain_ipv6_bind_{"blockchain_bind_ipv6"};
     static constexpr auto blockchain_storage_{"blockchain_storage"};
+    static constexpr auto blockchain_sync_interval_{"blockchain_sync_interval"};
     static constexpr auto blockchain_sync_provide_{"provide_sync_server"};
     static constexpr auto blockchain_sync_connect_{"blockchain_sync_server"};
     static constexpr auto blockchain_wallet_enable_{"blockchain_wallet"};
@@ -93,6 +94,13 @@ struct Options::Imp::Parser {
                 "Blockchain block persistence level.\n    0: do not save any "
                 "blocks\n    1: save blocks downloaded by the wallet\n    2: "
                 "download and save all blocks");
+            out.add_options()(
+                blockchain_sync_interval_,
+                po::value<int>(),
+                "Milliseconds between flushes of the blockchain database to "
+                "disk. Writes made in between may be lost if the system "
+                "crashes but the database remains consistent. 0: flush every "
+                "write");
             out.add_options()(
                 blockchain_sync_provide_,
                 po::value<bool>()->implicit_value(true),
@@ -206,6 +214,7 @@ Options::Imp::Imp() noexcept
     , blockchain_ipv4_bind_()
     , blockchain_ipv6_bind_()
     , blockchain_storage_level_(std::nullopt)
+    , blockchain_sync_interval_(std::nullopt)
     , blockchain_sync_server_enabled_(std::nullopt)
     , blockchain_sync_servers_()
     , blockchain_wallet_enabled_(std::nullopt)
@@ -235,6 +244,7 @@ Options::Imp::Imp(const Imp& rhs) noexcept
     , blockchain_ipv4_bind_(rhs.blockchain_ipv4_bind_)
     , blockchain_ipv6_bind_(rhs.blockchain_ipv6_bind_)
     , blockchain_storage_level_(rhs.blockchain_storage_level_)
+    , blockchain_sync_interval_(rhs.blockchain_sync_interval_)
     , blockchain_sync_server_enabled_(rhs.blockchain_sync_server_enabled_)
     , blockchain_sync_servers_(rhs.blockchain_sync_servers_)
     , blockchain_wallet_enabled_(rhs.blockchain_wallet_enabled_)
@@ -327,6 +337,8 @@ auto Options::Imp::import_value(const char* key, const char* value) noexcept
             blockchain_ipv6_bind_.emplace(value);
         } else if (0 == std::strcmp(key, Parser::blockchain_storage_)) {
             blockchain_storage_level_ = std::stoi(value);
+        } else if (0 == std::strcmp(key, Parser::blockchain_sync_interval_)) {
+            blockchain_sync_interval_ = std::stoi(value);
         } else if (0 == std::strcmp(key, Parser::blockchain_sync_provide_)) {
             blockchain_sync_server_enabled_ = to_bool(value);
 
@@ -442,6 +454,11 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                 blockchain_storage_level_ = value.as<int>();
             } catch (...) {
             }
+        } else if (name == Parser::blockchain_sync_interval_) {
+            try {
+                blockchain_sync_interval_ = value.as<int>();
+            } catch (...) {
+            }
         } else if (name == Parser::blockchain_sync_provide_) {
             try {
                 blockchain_sync_server_enabled_ = value.as<bool>();
@@ -626,6 +643,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         l.blockchain_storage_level_ = v.value();
     }
 
+    if (const auto& v = r.blockchain_sync_interval_; v.has_value()) {
+        l.blockchain_sync_interval_ = v.value();
+    }
+
     if (const auto& v = r.blockchain_sync_server_enabled_; v.has_value()) {
         l.blockchain_sync_server_enabled_ = v.value();
     }
@@ -806,6 +827,11 @@ auto Options::BlockchainStorageLevel() const noexcept -> int
     return Imp::get(imp_->blockchain_storage_level_);
 }
 
+auto Options::BlockchainSyncInterval() const noexcept -> int
+{
+    return Imp::get(imp_->blockchain_sync_interval_);
+}
+
 auto Options::BlockchainWalletEnabled() const noexcept -> bool
 {
     return Imp::get(imp_->blockchain_wallet_enabled_, true);
@@ -952,6 +978,13 @@ auto Options::SetBlockchainStorageLevel(int value) noexcept -> Options&
     return *this;
 }
 
+auto Options::SetBlockchainSyncInterval(int milliseconds) noexcept -> Options&
+{
+    imp_->blockchain_sync_interval_ = milliseconds;
+
+    return *this;
+}
+
 auto Options::SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&
 {
     imp_->blockchain_sync_server_enabled_ = enabled;
@@ -25,6 +25,7 @@ struct Options::Imp final {
     std::set<std::string> blockchain_ipv4_bind_;
     std::set<std::string> blockchain_ipv6_bind_;
     std::optional<int> blockchain_storage_level_;
+    std::optional<int> blockchain_sync_interval_;
     std::optional<bool> blockchain_sync_server_enabled_;
     std::set<std::string> blockchain_sync_servers_;
     std::optional<bool> blockchain_wallet_enabled_;
@@ -100,8 +100,8 @@ auto Activity::Imp::add_blockchain_transaction(
 {
     const auto incoming =
         transaction.AssociatedRemoteContacts(blockchain, contact_, nym);
-    LogTrace(OT_METHOD)(__func__)(": transaction ")(transaction.ID().asHex())(
-        " is associated "
+    OT_LOG_TRACE(OT_METHOD)(__func__)(": transaction ")(
+        transaction.ID().asHex())(" is associated "
         "with ")(incoming.size())(" con"
                                   "tact"
                                   "s")
@@ -148,7 +148,7 @@ struct MailCache::Imp {
                 work->AddFrame(task.nym_);
                 work->AddFrame(task.item_);
                 work->AddFrame(task.box_);
-                work->AddFrame(message);
+                work->AddFrame(std::move(message));
                 message_loaded_.Send(work);
             }
 
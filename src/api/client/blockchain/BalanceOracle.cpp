@@ -61,6 +61,12 @@ struct BalanceOracle::Imp {
     auto UpdateBalance(const Chain chain, const Balance balance) const noexcept
         -> void
     {
+        {
+            auto lock = Lock{lock_};
+
+            if (false == changed(balances_, chain, balance)) { return; }
+        }
+
         const auto make = [&](auto& out, auto type) {
             out->AddFrame();
             out->AddFrame(value(type));
@@ -91,6 +97,14 @@ struct BalanceOracle::Imp {
         const Chain chain,
         const Balance balance) const noexcept -> void
     {
+        {
+            auto lock = Lock{lock_};
+
+            if (false == changed(nym_balances_[chain], owner, balance)) {
+                return;
+            }
+        }
+
         const auto make = [&](auto& out, auto type) {
             out->AddFrame();
             out->AddFrame(value(type));
@@ -143,6 +157,8 @@ struct BalanceOracle::Imp {
         , lock_()
         , subscribers_()
         , nym_subscribers_()
+        , balances_()
+        , nym_balances_()
     {
     }
 
@@ -157,6 +173,27 @@ private:
     mutable std::mutex lock_;
     mutable std::map<Chain, Subscribers> subscribers_;
     mutable std::map<Chain, std::map<OTNymID, Subscribers>> nym_subscribers_;
+    // NOTE the most recently published values, used to suppress updates
+    // which would not change anything
+    mutable std::map<Chain, Balance> balances_;
+    mutable std::map<Chain, std::map<OTNymID, Balance>> nym_balances_;
+
+    template <typename Map, typename Key>
+    static auto changed(
+        Map& map,
+        const Key& key,
+        const Balance& balance) noexcept -> bool
+    {
+        auto [it, added] = map.try_emplace(key, balance);
+
+        if (added) { return true; }
+
+        if (it->second == balance) { return false; }
+
+        it->second = balance;
+
+        return true;
+    }
 
     auto cb(opentxs::network::zeromq::Message& in) noexcept -> void
     {
@@ -206,9 +206,10 @@ auto Blockchain::KeyEndpoint() const noexcept -> const std::string&
     return imp_->KeyEndpoint();
 }
 
-auto Blockchain::KeyGenerated(const Chain chain) const noexcept -> void
+auto Blockchain::KeyGenerated(const Chain chain, const Identifier& account)
+    const noexcept -> void
 {
-    imp_->KeyGenerated(chain);
+    imp_->KeyGenerated(chain, account);
 }
 
 auto Blockchain::LoadTransactionBitcoin(const TxidHex& txid) const noexcept
@@ -166,7 +166,8 @@ public:
         return *this;
     }
     auto KeyEndpoint() const noexcept -> const std::string& final;
-    auto KeyGenerated(const Chain chain) const noexcept -> void final;
+    auto KeyGenerated(const Chain chain, const Identifier& account)
+        const noexcept -> void final;
     auto LoadTransactionBitcoin(const TxidHex& id) const noexcept
         -> std::unique_ptr<const Tx> final;
     auto LoadTransactionBitcoin(const Txid& id) const noexcept
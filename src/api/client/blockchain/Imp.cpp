@@ -754,7 +754,8 @@ auto Blockchain::Imp::KeyEndpoint() const noexcept -> const std::string&
 }
 
 auto Blockchain::Imp::KeyGenerated(
-    const opentxs::blockchain::Type) const noexcept -> void
+    const opentxs::blockchain::Type,
+    const Identifier&) const noexcept -> void
 {
 }
 
@@ -183,7 +183,8 @@ struct Blockchain::Imp {
     virtual auto IndexItem(const ReadView bytes) const noexcept -> PatternID;
     virtual auto KeyEndpoint() const noexcept -> const std::string&;
     virtual auto KeyGenerated(
-        const opentxs::blockchain::Type chain) const noexcept -> void;
+        const opentxs::blockchain::Type chain,
+        const Identifier& account) const noexcept -> void;
     virtual auto LoadTransactionBitcoin(const TxidHex& txid) const noexcept
         -> std::unique_ptr<const Tx>;
     virtual auto LoadTransactionBitcoin(const Txid& txid) const noexcept
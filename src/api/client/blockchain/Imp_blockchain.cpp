@@ -292,10 +292,12 @@ auto BlockchainImp::KeyEndpoint() const noexcept -> const std::string&
 }
 
 auto BlockchainImp::KeyGenerated(
-    const opentxs::blockchain::Type chain) const noexcept -> void
+    const opentxs::blockchain::Type chain,
+    const Identifier& account) const noexcept -> void
 {
     auto work = MakeWork(api_, OT_ZMQ_NEW_BLOCKCHAIN_WALLET_KEY_SIGNAL);
     work->AddFrame(chain);
+    work->AddFrame(account);
     key_updates_->Send(work);
 }
 
@@ -135,8 +135,9 @@ struct BlockchainImp final : public Blockchain::Imp {
         const noexcept -> bool final;
     auto IndexItem(const ReadView bytes) const noexcept -> PatternID final;
     auto KeyEndpoint() const noexcept -> const std::string& final;
-    auto KeyGenerated(const opentxs::blockchain::Type chain) const noexcept
-        -> void final;
+    auto KeyGenerated(
+        const opentxs::blockchain::Type chain,
+        const Identifier& account) const noexcept -> void final;
     auto LoadTransactionBitcoin(const TxidHex& txid) const noexcept
         -> std::unique_ptr<const Tx> final;
     auto LoadTransactionBitcoin(const Txid& txid) const noexcept
@@ -176,6 +176,8 @@ auto Asio::Imp::Connect(
     return true;
 }
 
+auto Asio::Imp::GetTimer() noexcept -> Timer { return Timer{io_context_.get()}; }
+
 auto Asio::Imp::IOContext() noexcept -> boost::asio::io_context&
 {
     return io_context_;
@@ -365,6 +367,46 @@ auto Asio::Imp::Receive(
     return true;
 }
 
+auto Asio::Imp::ReceiveSome(
+    const ReadView id,
+    const OTZMQWorkType type,
+    const std::size_t bytes,
+    internal::Asio::Socket& socket) noexcept -> bool
+{
+    auto lock = sLock{lock_};
+
+    if (shutdown()) { return false; }
+
+    if (0 == id.size()) { return false; }
+
+    auto bufData = buffers_.get(bytes);
+    const auto& endpoint = socket.endpoint_;
+    socket.socket_.async_read_some(
+        bufData.second,
+        [this, connection{space(id)}, type, bufData, address{endpoint.str()}](
+            const auto& e, auto size) {
+            const auto& [index, buffer] = bufData;
+            auto work = zmq_.TaggedReply(
+                reader(connection), e ? value(WorkType::AsioDisconnect) : type);
+
+            if (e) {
+                LogVerbose(OT_METHOD)(__func__)(": asio receive error: ")(
+                    e.message())
+                    .Flush();
+                work->AddFrame(address);
+            } else {
+                work->AddFrame(buffer.data(), size);
+            }
+
+            OT_ASSERT(1 < work->Body().size());
+
+            data_socket_->Send(std::move(work));
+            buffers_.clear(index);
+        });
+
+    return true;
+}
+
 auto Asio::Imp::Resolve(std::string_view server, std::uint16_t port)
     const noexcept -> Resolved
 {
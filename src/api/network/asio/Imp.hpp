@@ -77,6 +77,7 @@ struct Asio::Imp final : public api::network::internal::Asio,
         -> bool final;
     auto GetPublicAddress4() const noexcept -> std::shared_future<OTData>;
     auto GetPublicAddress6() const noexcept -> std::shared_future<OTData>;
+    auto GetTimer() noexcept -> Timer final;
     auto Init() noexcept -> void;
     auto IOContext() noexcept -> boost::asio::io_context& final;
     auto PostIO(Asio::Callback cb) noexcept -> bool final;
@@ -86,6 +87,11 @@ struct Asio::Imp final : public api::network::internal::Asio,
         const OTZMQWorkType type,
         const std::size_t bytes,
         internal::Asio::Socket& socket) noexcept -> bool final;
+    auto ReceiveSome(
+        const ReadView id,
+        const OTZMQWorkType type,
+        const std::size_t bytes,
+        internal::Asio::Socket& socket) noexcept -> bool final;
     auto Resolve(std::string_view server, std::uint16_t port) const noexcept
         -> Resolved;
     auto Shutdown() noexcept -> void;
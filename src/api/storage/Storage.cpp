@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "api/storage/Storage.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
@@ -58,6 +59,7 @@
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
 #include "opentxs/protobuf/UnitDefinition.pb.h"
+#include "storage/ObjectCache.hpp"
 #include "storage/StorageConfig.hpp"
 #include "storage/tree/Accounts.hpp"
 #include "storage/tree/Bip47Channels.hpp"
@@ -196,6 +198,12 @@ auto Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("commit_window_ms"),
+        storageConfig.commit_window_,
+        storageConfig.commit_window_,
+        notUsed);
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("path"),
@@ -236,6 +244,12 @@ auto Factory::Storage(
         notUsed);
     encryptedDirectory =
         String::Factory(storageConfig.fs_encrypted_backup_directory_.c_str());
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("fs_segment_size"),
+        storageConfig.fs_segment_size_,
+        storageConfig.fs_segment_size_,
+        notUsed);
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("sqlite3_primary"),
@@ -266,6 +280,24 @@ auto Factory::Storage(
         String::Factory(storageConfig.sqlite3_db_file_),
         storageConfig.sqlite3_db_file_,
         notUsed);
+    config.CheckSet_str(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_synchronous"),
+        String::Factory(storageConfig.sqlite3_synchronous_),
+        storageConfig.sqlite3_synchronous_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_mmap_size"),
+        storageConfig.sqlite3_mmap_size_,
+        storageConfig.sqlite3_mmap_size_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_cache_size"),
+        storageConfig.sqlite3_cache_size_,
+        storageConfig.sqlite3_cache_size_,
+        notUsed);
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("lmdb_primary"),
@@ -367,6 +399,7 @@ Storage::Storage(
     : crypto_(crypto)
     , running_(running)
     , gc_interval_(config.gc_interval_)
+    , commit_window_(std::max<std::int64_t>(config.commit_window_, 0))
     , write_lock_()
     , root_(nullptr)
     , primary_bucket_(Flag::Factory(false))
@@ -382,6 +415,12 @@ Storage::Storage(
           hash,
           random))
     , multiplex_(*multiplex_p_)
+    , commit_lock_()
+    , commit_cv_()
+    , committing_(false)
+    , updated_(0)
+    , committed_(0)
+    , first_update_()
 {
     OT_ASSERT(multiplex_p_);
 }
@@ -569,11 +608,41 @@ void Storage::Cleanup_Storage()
         if (thread.joinable()) { thread.join(); }
     }
 
-    if (root_) { root_->cleanup(); }
+    if (root_) {
+        commit();
+        root_->cleanup();
+    }
+
+    const auto stats = opentxs::storage::ObjectCache::Get().Statistics();
+    LogVerbose(OT_METHOD)(__func__)(": Object cache hits: ")(stats.hits_)(
+        ", misses: ")(stats.misses_)(", evictions: ")(stats.evictions_)(
+        ", objects: ")(stats.objects_)(", bytes: ")(stats.bytes_)
+        .Flush();
 }
 
 void Storage::Cleanup() { Cleanup_Storage(); }
 
+// NOTE The caller must not hold commit_lock_
+void Storage::commit() const
+{
+    Lock lock(write_lock_);
+
+    if (false == bool(root_)) { return; }
+
+    auto generation = std::uint64_t{};
+
+    {
+        Lock commitLock(commit_lock_);
+        generation = updated_;
+
+        if (generation == committed_) { return; }
+    }
+
+    multiplex_.StoreRoot(true, root_->commit());
+    Lock commitLock(commit_lock_);
+    committed_ = std::max(committed_, generation);
+}
+
 void Storage::CollectGarbage() const { Root().Migrate(multiplex_.Primary()); }
 
 auto Storage::ContactAlias(const std::string& id) const -> std::string
@@ -679,6 +748,12 @@ auto Storage::DeletePaymentWorkflow(
         .Delete(workflowID);
 }
 
+auto Storage::GarbageCollectionStatus() const noexcept
+    -> opentxs::api::storage::GarbageCollection
+{
+    return Root().gc_.Status();
+}
+
 auto Storage::HashType() const -> std::uint32_t { return HASH_TYPE; }
 
 void Storage::InitBackup() { multiplex_.InitBackup(); }
@@ -1312,6 +1387,14 @@ auto Storage::mutable_Root() const -> Editor<opentxs::storage::Root>
         this->save(in, lock);
     };
 
+    if (0 < commit_window_.count()) {
+
+        return Editor<opentxs::storage::Root>(
+            write_lock_, root(), callback, [this](const auto&) -> void {
+                this->wait_for_commit();
+            });
+    }
+
     return Editor<opentxs::storage::Root>(write_lock_, root(), callback);
 }
 
@@ -1360,6 +1443,11 @@ auto Storage::NymList() const -> ObjectList
     return Root().Tree().Nyms().List();
 }
 
+void Storage::PauseGarbageCollection() const noexcept
+{
+    Root().gc_.Pause();
+}
+
 auto Storage::PaymentWorkflowList(const std::string& nymID) const -> ObjectList
 {
     if (false == Root().Tree().Nyms().Exists(nymID)) {
@@ -1811,7 +1899,11 @@ auto Storage::root() const -> opentxs::storage::Root*
 
     if (!root_) {
         root_.reset(new opentxs::storage::Root(
-            multiplex_, multiplex_.LoadRoot(), gc_interval_, primary_bucket_));
+            multiplex_,
+            multiplex_.LoadRoot(),
+            gc_interval_,
+            primary_bucket_,
+            0 < commit_window_.count()));
     }
 
     OT_ASSERT(root_);
@@ -1823,6 +1915,11 @@ auto Storage::root() const -> opentxs::storage::Root*
 
 auto Storage::Root() const -> const opentxs::storage::Root& { return *root(); }
 
+void Storage::ResumeGarbageCollection() const noexcept
+{
+    Root().gc_.Resume();
+}
+
 void Storage::RunGC() const
 {
     if (!running_) { return; }
@@ -1850,6 +1947,16 @@ void Storage::save(opentxs::storage::Root* in, const Lock& lock) const
     OT_ASSERT(verify_write_lock(lock));
     OT_ASSERT(nullptr != in);
 
+    if (0 < commit_window_.count()) {
+        Lock commitLock(commit_lock_);
+
+        if (updated_ == committed_) { first_update_ = Clock::now(); }
+
+        ++updated_;
+
+        return;
+    }
+
     multiplex_.StoreRoot(true, in->root_);
 }
 
@@ -2636,5 +2743,31 @@ auto Storage::verify_write_lock(const Lock& lock) const -> bool
     return true;
 }
 
+// Blocks until every update made prior to the call has been committed. The
+// first waiter sleeps for the remainder of the commit window so that updates
+// made by other threads in the meantime are included in the same commit.
+void Storage::wait_for_commit() const
+{
+    Lock lock(commit_lock_);
+    const auto target = updated_;
+
+    while (committed_ < target) {
+        if (committing_) {
+            commit_cv_.wait(lock);
+
+            continue;
+        }
+
+        committing_ = true;
+        const auto deadline = first_update_ + commit_window_;
+        lock.unlock();
+        std::this_thread::sleep_until(deadline);
+        commit();
+        lock.lock();
+        committing_ = false;
+        commit_cv_.notify_all();
+    }
+}
+
 Storage::~Storage() { Cleanup_Storage(); }
 }  // namespace opentxs::api::storage::implementation
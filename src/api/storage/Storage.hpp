@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <ctime>
 #include <iosfwd>
@@ -172,6 +174,8 @@ public:
     auto DeletePaymentWorkflow(
         const std::string& nymID,
         const std::string& workflowID) const -> bool final;
+    auto GarbageCollectionStatus() const noexcept
+        -> opentxs::api::storage::GarbageCollection final;
     auto HashType() const -> std::uint32_t final;
     auto IssuerList(const std::string& nymID) const -> ObjectList final;
     auto Load(
@@ -306,6 +310,7 @@ public:
     auto NymBoxList(const std::string& nymID, const StorageBox box) const
         -> ObjectList final;
     auto NymList() const -> ObjectList final;
+    void PauseGarbageCollection() const noexcept final;
     auto PaymentWorkflowList(const std::string& nymID) const
         -> ObjectList final;
     auto PaymentWorkflowLookup(
@@ -349,6 +354,7 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         const std::string& newID) const -> bool final;
+    void ResumeGarbageCollection() const noexcept final;
     void RunGC() const final;
     auto SeedList() const -> ObjectList final;
     auto ServerAlias(const std::string& id) const -> std::string final;
@@ -467,6 +473,7 @@ private:
     const api::Crypto& crypto_;
     const Flag& running_;
     std::int64_t gc_interval_{std::numeric_limits<std::int64_t>::max()};
+    const std::chrono::milliseconds commit_window_;
     mutable std::mutex write_lock_;
     mutable std::unique_ptr<opentxs::storage::Root> root_;
     mutable OTFlag primary_bucket_;
@@ -474,6 +481,12 @@ private:
     const StorageConfig config_;
     std::unique_ptr<Multiplex> multiplex_p_;
     Multiplex& multiplex_;
+    mutable std::mutex commit_lock_;
+    mutable std::condition_variable commit_cv_;
+    mutable bool committing_;
+    mutable std::uint64_t updated_;
+    mutable std::uint64_t committed_;
+    mutable Time first_update_;
 
     auto root() const -> opentxs::storage::Root*;
     auto Root() const -> const opentxs::storage::Root&;
@@ -485,6 +498,7 @@ private:
     void Cleanup();
     void Cleanup_Storage();
     void CollectGarbage() const;
+    void commit() const;
     void InitBackup() final;
     void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) final;
     void InitPlugins();
@@ -494,6 +508,7 @@ private:
     void RunMapUnits(UnitLambda lambda) const;
     void save(opentxs::storage::Root* in, const Lock& lock) const;
     void start() final;
+    void wait_for_commit() const;
 
     Storage(
         const api::Crypto& crypto,
@@ -8,6 +8,7 @@
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"  // IWYU pragma: associated
 
 #include <boost/endian/buffers.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
@@ -194,6 +195,100 @@ auto Bip143Hashes::Sequences(const SigHash sig) const noexcept -> const Hash&
     return sequences_;
 }
 
+auto LegacyPreimages::Preimage(
+    const std::size_t index,
+    const SigHash& sigHash,
+    const block::bitcoin::internal::Input& input) const noexcept(false) -> Space
+{
+    if (SigOption::All != sigHash.Type()) {
+        throw std::runtime_error{"Mode not supported"};
+    }
+
+    if (index >= inputs_.size()) {
+        throw std::out_of_range{"Invalid input index"};
+    }
+
+    const auto anyoneCanPay = sigHash.AnyoneCanPay();
+    const auto count =
+        blockchain::bitcoin::CompactSize{anyoneCanPay ? 1u : inputs_.size()};
+    const auto& outpoint = input.PreviousOutput();
+    const auto pScript = input.Spends().SigningSubscript();
+
+    OT_ASSERT(pScript);
+
+    const auto& script = *pScript;
+    const auto scriptBytes = script.CalculateSize();
+    const auto cs = blockchain::bitcoin::CompactSize{scriptBytes};
+    const auto sequence = be::little_uint32_buf_t{input.Sequence()};
+    const auto others = [&] {
+        if (anyoneCanPay) { return std::size_t{0}; }
+
+        return std::accumulate(
+                   inputs_.begin(), inputs_.end(), std::size_t{0}, cb) -
+               inputs_.at(index).size();
+    }();
+    // clang-format off
+    auto preimage = space(
+        sizeof(version_) +
+        count.Size() +
+        others +
+        sizeof(outpoint) +
+        cs.Total() +
+        sizeof(sequence) +
+        outputs_.size() +
+        sizeof(locktime_) +
+        sizeof(sigHash)
+    );
+    // clang-format on
+    auto it = preimage.data();
+    const auto copy = [&](const auto& bytes) {
+        std::memcpy(it, bytes.data(), bytes.size());
+        std::advance(it, bytes.size());
+    };
+    std::memcpy(it, &version_, sizeof(version_));
+    std::advance(it, sizeof(version_));
+
+    if (false == count.Encode(preallocated(count.Size(), it))) {
+        throw std::runtime_error{"CompactSize encoding failure"};
+    }
+
+    std::advance(it, count.Size());
+
+    if (false == anyoneCanPay) {
+        std::for_each(
+            inputs_.begin(), std::next(inputs_.begin(), index), copy);
+    }
+
+    std::memcpy(it, &outpoint, sizeof(outpoint));
+    std::advance(it, sizeof(outpoint));
+
+    if (false == cs.Encode(preallocated(cs.Size(), it))) {
+        throw std::runtime_error{"CompactSize encoding failure"};
+    }
+
+    std::advance(it, cs.Size());
+
+    if (false == script.Serialize(preallocated(scriptBytes, it))) {
+        throw std::runtime_error{"Script encoding failure"};
+    }
+
+    std::advance(it, scriptBytes);
+    std::memcpy(it, &sequence, sizeof(sequence));
+    std::advance(it, sizeof(sequence));
+
+    if (false == anyoneCanPay) {
+        std::for_each(
+            std::next(inputs_.begin(), index + 1), inputs_.end(), copy);
+    }
+
+    copy(outputs_);
+    std::memcpy(it, &locktime_, sizeof(locktime_));
+    std::advance(it, sizeof(locktime_));
+    std::memcpy(it, &sigHash, sizeof(sigHash));
+
+    return preimage;
+}
+
 auto EncodedInput::size() const noexcept -> std::size_t
 {
     return sizeof(outpoint_) + cs_.Total() + sizeof(sequence_);
@@ -551,18 +551,7 @@ auto Transaction::FindMatches(
     return output;
 }
 
-auto Transaction::GetPatterns() const noexcept -> std::vector<PatternID>
-{
-    auto output = inputs_->GetPatterns();
-    const auto oPatterns = outputs_->GetPatterns();
-    output.reserve(output.size() + oPatterns.size());
-    output.insert(output.end(), oPatterns.begin(), oPatterns.end());
-    dedup(output);
-
-    return output;
-}
-
-auto Transaction::GetPreimageBTC(
+auto Transaction::ForTestingOnlyGetPreimageBTC(
     const std::size_t index,
     const blockchain::bitcoin::SigHash& hashType) const noexcept -> Space
 {
@@ -596,6 +585,17 @@ auto Transaction::GetPreimageBTC(
     return output;
 }
 
+auto Transaction::GetPatterns() const noexcept -> std::vector<PatternID>
+{
+    auto output = inputs_->GetPatterns();
+    const auto oPatterns = outputs_->GetPatterns();
+    output.reserve(output.size() + oPatterns.size());
+    output.insert(output.end(), oPatterns.begin(), oPatterns.end());
+    dedup(output);
+
+    return output;
+}
+
 auto Transaction::Keys() const noexcept -> std::vector<KeyID>
 {
     auto out = inputs_->Keys();
@@ -91,11 +91,11 @@ public:
         const FilterType type,
         const Patterns& txos,
         const ParsedPatterns& elements) const noexcept -> Matches final;
-    auto GetPatterns() const noexcept -> std::vector<PatternID> final;
-    auto GetPreimageBTC(
+    auto ForTestingOnlyGetPreimageBTC(
         const std::size_t index,
         const blockchain::bitcoin::SigHash& hashType) const noexcept
         -> Space final;
+    auto GetPatterns() const noexcept -> std::vector<PatternID> final;
     auto ID() const noexcept -> const Txid& final { return txid_; }
     auto IDNormalized() const noexcept -> const Identifier& final;
     auto Inputs() const noexcept -> const bitcoin::Inputs& final
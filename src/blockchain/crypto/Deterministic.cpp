@@ -10,6 +10,7 @@
 #include <boost/container/vector.hpp>
 #include <robin_hood.h>
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <tuple>
@@ -18,11 +19,14 @@
 #include "blockchain/crypto/Element.hpp"
 #include "blockchain/crypto/Subaccount.hpp"
 #include "internal/api/client/Client.hpp"
+#include "internal/api/network/Network.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/HDSeed.hpp"
 #include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/blockchain/crypto/Account.hpp"
 #include "opentxs/blockchain/crypto/Element.hpp"
 #include "opentxs/blockchain/crypto/Wallet.hpp"
@@ -31,6 +35,9 @@
 #include "opentxs/crypto/key/EllipticCurve.hpp"
 #include "opentxs/crypto/key/asymmetric/Role.hpp"
 #include "opentxs/protobuf/HDPath.pb.h"
+#include "util/ParallelFor.hpp"
+
+#define OT_BLOCKCHAIN_KEY_DERIVATION_BATCH 16
 
 #define OT_METHOD "opentxs::blockchain::crypto::implementation::Deterministic::"
 
@@ -105,6 +112,24 @@ auto Deterministic::ChainData::Get(Subchain type) noexcept(false)
     }
 }
 
+auto Deterministic::add_element(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index index,
+    const opentxs::crypto::key::EllipticCurve& key) const noexcept(false)
+    -> void
+{
+    auto& addressMap = data_.Get(type).map_;
+    const auto& blockchain = parent_.Parent().Parent();
+    const auto [it, added] = addressMap.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(index),
+        std::forward_as_tuple(std::make_unique<implementation::Element>(
+            api_, blockchain, *this, chain_, type, index, key, get_contact())));
+
+    if (false == added) { throw std::runtime_error("Failed to add key"); }
+}
+
 #if OT_CRYPTO_WITH_BIP32
 auto Deterministic::accept(
     const rLock& lock,
@@ -227,6 +252,14 @@ auto Deterministic::check(
 }
 #endif  // OT_CRYPTO_WITH_BIP32
 
+auto Deterministic::chain_key(
+    const rLock&,
+    const Subchain,
+    const PasswordPrompt&) const noexcept -> ChainKey
+{
+    return {};
+}
+
 auto Deterministic::check_activity(
     const rLock& lock,
     const std::vector<Activity>& unspent,
@@ -283,9 +316,34 @@ auto Deterministic::check_lookahead(
 #if OT_CRYPTO_WITH_BIP32
     auto needed = need_lookahead(lock, type);
 
-    while (0u < needed) {
-        generated.emplace_back(generate_next(lock, type, reason));
-        --needed;
+    if (0u == needed) { return; }
+
+    auto deriver = key_deriver(lock, type, reason);
+
+    if (false == bool(deriver)) {
+        while (0u < needed) {
+            generated.emplace_back(generate_next(lock, type, reason));
+            --needed;
+        }
+
+        return;
+    }
+
+    auto& index = generated_.at(type);
+
+    if ((max_index_ - index) < needed) {
+        throw std::runtime_error("Account is full");
+    }
+
+    const auto keys = derive_batch(std::move(deriver), index, needed);
+
+    for (const auto& pKey : keys) {
+        if (false == bool(pKey)) {
+            throw std::runtime_error("Failed to generate key");
+        }
+
+        add_element(lock, type, index, *pKey);
+        generated.emplace_back(index++);
     }
 #endif  // OT_CRYPTO_WITH_BIP32
 }
@@ -324,6 +382,34 @@ auto Deterministic::confirm(
     }
 }
 
+auto Deterministic::derive_batch(
+    Deriver deriver,
+    const Bip32Index first,
+    const Bip32Index count) const noexcept -> std::vector<ECKey>
+{
+    auto keys = std::vector<ECKey>(count);
+    ParallelFor(
+        count,
+        OT_BLOCKCHAIN_KEY_DERIVATION_BATCH,
+        [this](auto job) {
+            return api_.Network().Asio().Internal().PostCPU(std::move(job));
+        },
+        [&](const auto start, const auto stop) {
+            const auto size = static_cast<Bip32Index>(stop - start);
+            auto derived =
+                deriver(static_cast<Bip32Index>(first + start), size);
+
+            if (derived.size() == size) {
+                std::move(
+                    derived.begin(),
+                    derived.end(),
+                    std::next(keys.begin(), start));
+            }
+        });
+
+    return keys;
+}
+
 auto Deterministic::element(
     const rLock&,
     const Subchain type,
@@ -356,7 +442,7 @@ auto Deterministic::finish_allocation(const rLock& lock, Batch& generated)
 {
 #if OT_BLOCKCHAIN
     if (0u < generated.size()) {
-        parent_.Parent().Parent().Internal().KeyGenerated(chain_);
+        parent_.Parent().Parent().Internal().KeyGenerated(chain_, id_);
     }
 #endif  // OT_BLOCKCHAIN
 
@@ -422,22 +508,19 @@ auto Deterministic::generate(
 
     if (max_index_ <= index) { throw std::runtime_error("Account is full"); }
 
-    auto pKey = PrivateKey(type, index, reason);
+    const auto pKey = [&]() -> ECKey {
+        if (const auto chain = chain_key(lock, type, reason); chain) {
+            return chain->ChildKey(index, reason);
+        }
+
+        return PrivateKey(type, index, reason);
+    }();
 
     if (false == bool(pKey)) {
         throw std::runtime_error("Failed to generate key");
     }
 
-    const auto& key = *pKey;
-    auto& addressMap = data_.Get(type).map_;
-    const auto& blockchain = parent_.Parent().Parent();
-    const auto [it, added] = addressMap.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(index),
-        std::forward_as_tuple(std::make_unique<implementation::Element>(
-            api_, blockchain, *this, chain_, type, index, key, get_contact())));
-
-    if (false == added) { throw std::runtime_error("Failed to add key"); }
+    add_element(lock, type, index, *pKey);
 
     return index++;
 #else
@@ -490,6 +573,32 @@ auto Deterministic::Key(const Subchain type, const Bip32Index index)
     }
 }
 
+auto Deterministic::key_deriver(
+    const rLock& lock,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept -> Deriver
+{
+    auto chain = chain_key(lock, type, reason);
+
+    if (false == bool(chain)) { return {}; }
+
+    // NOTE the password prompt belongs to the caller so the deriver keeps a
+    // copy
+    return [chain = std::move(chain),
+            prompt = api_.Factory().PasswordPrompt(reason)](
+               const Bip32Index first,
+               const Bip32Index count) -> std::vector<ECKey> {
+        auto output = std::vector<ECKey>{};
+        output.reserve(count);
+
+        for (auto i = Bip32Index{0}; i < count; ++i) {
+            output.emplace_back(chain->ChildKey(first + i, prompt));
+        }
+
+        return output;
+    };
+}
+
 auto Deterministic::LastGenerated(const Subchain type) const noexcept
     -> std::optional<Bip32Index>
 {
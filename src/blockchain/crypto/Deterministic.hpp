@@ -11,6 +11,7 @@
 #include <functional>
 #include <iosfwd>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -108,6 +109,9 @@ public:
     ~Deterministic() override = default;
 
 protected:
+    using ChainKey = std::shared_ptr<const opentxs::crypto::key::HD>;
+    using Deriver = std::function<
+        std::vector<ECKey>(const Bip32Index first, const Bip32Index count)>;
     using IndexMap = std::map<Subchain, Bip32Index>;
     using SerializedType = proto::BlockchainDeterministicAccountData;
 
@@ -141,6 +145,18 @@ protected:
     mutable boost::container::flat_map<Subchain, std::optional<Bip32Index>>
         last_allocation_;
 
+    // Public parent key of the subchain, if the subchain uses public
+    // derivation. Lookahead keys are derived from it without private keys.
+    virtual auto chain_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept -> ChainKey;
+    // Derives consecutive keys of the subchain without taking the account
+    // lock so that lookahead batches can be spread over the thread pool
+    virtual auto key_deriver(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept -> Deriver;
     auto check_lookahead(
         const rLock& lock,
         const Subchain type,
@@ -212,6 +228,12 @@ private:
         const AddressMap& map,
         std::set<OTIdentifier>& contacts) noexcept -> void;
 
+    auto add_element(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index index,
+        const opentxs::crypto::key::EllipticCurve& key) const noexcept(false)
+        -> void;
 #if OT_CRYPTO_WITH_BIP32
     auto accept(
         const rLock& lock,
@@ -248,6 +270,10 @@ private:
         const rLock& lock,
         const Subchain type,
         const Bip32Index index) noexcept -> void final;
+    auto derive_batch(
+        Deriver deriver,
+        const Bip32Index first,
+        const Bip32Index count) const noexcept -> std::vector<ECKey>;
     [[nodiscard]] auto finish_allocation(const rLock& lock, Batch& generated)
         const noexcept -> bool;
     [[nodiscard]] auto generate(
@@ -21,9 +21,12 @@
 #include "blockchain/crypto/Subaccount.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/blockchain/crypto/Factory.hpp"
+#include "internal/crypto/key/Factory.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/Core.hpp"
+#include "opentxs/api/Factory.hpp"
 #include "opentxs/api/HDSeed.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/blockchain/crypto/Account.hpp"
 #include "opentxs/blockchain/crypto/HDProtocol.hpp"
@@ -37,6 +40,7 @@
 #include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/Bip32Child.hpp"
 #include "opentxs/crypto/Bip43Purpose.hpp"
+#include "opentxs/crypto/key/Secp256k1.hpp"
 #include "opentxs/protobuf/BlockchainAddress.pb.h"
 #include "opentxs/protobuf/BlockchainHDAccountData.pb.h"
 #include "opentxs/protobuf/HDAccount.pb.h"
@@ -109,6 +113,8 @@ HD::HD(
     , version_(DefaultVersion)
     , cached_internal_()
     , cached_external_()
+    , cached_internal_public_()
+    , cached_external_public_()
     , name_()
 {
     init(reason);
@@ -195,11 +201,39 @@ HD::HD(
     , version_(serialized.version())
     , cached_internal_()
     , cached_external_()
+    , cached_internal_public_()
+    , cached_external_public_()
     , name_()
 {
     init();
 }
 
+#if OT_CRYPTO_WITH_BIP32
+auto HD::account_key(
+    const rLock& lock,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
+{
+    const auto change =
+        (internalType == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
+    auto& pKey = (internalType == type) ? cached_internal_ : cached_external_;
+
+    if (!pKey) {
+        pKey = api_.Seeds().AccountKey(path_, change, reason);
+
+        if (!pKey) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to derive account key")
+                .Flush();
+
+            return nullptr;
+        }
+    }
+
+    return pKey.get();
+}
+#endif  // OT_CRYPTO_WITH_BIP32
+
 auto HD::account_already_exists(const rLock&) const noexcept -> bool
 {
     const auto existing = api_.Storage().BlockchainAccountList(
@@ -208,6 +242,53 @@ auto HD::account_already_exists(const rLock&) const noexcept -> bool
     return 0 < existing.count(id_->str());
 }
 
+auto HD::chain_key(
+    const rLock& lock,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept -> ChainKey
+{
+#if OT_CRYPTO_WITH_BIP32 && OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    if ((internalType != type) && (externalType != type)) { return {}; }
+
+    auto& output = (internalType == type) ? cached_internal_public_
+                                          : cached_external_public_;
+
+    if (output) { return output; }
+
+    const auto* pKey = account_key(lock, type, reason);
+
+    if (nullptr == pKey) { return {}; }
+
+    const auto& key = *pKey;
+    auto path = proto::HDPath{};
+
+    if (false == key.Path(path)) {
+        LogOutput(OT_METHOD)(__func__)(": Missing account key path").Flush();
+
+        return {};
+    }
+
+    // NOTE a key without a private half derives its children with public
+    // derivation
+    output = factory::Secp256k1Key(
+        api_,
+        api_.Crypto().SECP256K1(),
+        api_.Factory().Secret(0),
+        api_.Factory().SecretFromBytes(key.Chaincode(reason)),
+        api_.Factory().Data(key.PublicKey()),
+        path,
+        key.Parent(),
+        key.Role(),
+        key.Version(),
+        reason);
+
+    return output;
+#else
+
+    return {};
+#endif  // OT_CRYPTO_WITH_BIP32 && OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+}
+
 auto HD::Name() const noexcept -> std::string
 {
     auto lock = rLock{lock_};
@@ -250,27 +331,12 @@ auto HD::PrivateKey(
     }
 
 #if OT_CRYPTO_WITH_BIP32
-    const auto change =
-        (internalType == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
-    auto& pKey = (internalType == type) ? cached_internal_ : cached_external_;
     auto lock = rLock{lock_};
+    const auto* pKey = account_key(lock, type, reason);
 
-    if (!pKey) {
-        pKey = api_.Seeds().AccountKey(path_, change, reason);
-
-        if (!pKey) {
-            LogOutput(OT_METHOD)(__func__)(": Failed to derive account key")
-                .Flush();
-
-            return {};
-        }
-    }
-
-    OT_ASSERT(pKey);
-
-    const auto& key = *pKey;
+    if (nullptr == pKey) { return {}; }
 
-    return key.ChildKey(index, reason);
+    return pKey->ChildKey(index, reason);
 #else
 
     return {};
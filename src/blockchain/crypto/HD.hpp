@@ -104,9 +104,22 @@ private:
     VersionNumber version_;
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_internal_;
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_external_;
+    mutable ChainKey cached_internal_public_;
+    mutable ChainKey cached_external_public_;
     mutable std::optional<std::string> name_;
 
+#if OT_CRYPTO_WITH_BIP32
+    auto account_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD*;
+#endif  // OT_CRYPTO_WITH_BIP32
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto chain_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept -> ChainKey final;
     auto save(const rLock& lock) const noexcept -> bool final;
 
     HD(const HD&) = delete;
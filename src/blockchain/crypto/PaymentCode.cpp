@@ -15,6 +15,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "Proto.hpp"
 #include "blockchain/crypto/Deterministic.hpp"
@@ -302,6 +303,57 @@ auto PaymentCode::IsNotified() const noexcept -> bool
     return 0 < outgoing_notifications_.size();
 }
 
+auto PaymentCode::key_deriver(
+    const rLock&,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept -> Deriver
+{
+    if (false == has_private(reason)) {
+        LogOutput(OT_METHOD)(__func__)(": Missing private key").Flush();
+
+        return {};
+    }
+
+    // NOTE every revision of the payment codes is retained for the lifetime
+    // of the subaccount so the references remain valid on pool threads. The
+    // password prompt belongs to the caller so the deriver keeps a copy. Each
+    // batch derives the key shared by every index of the channel only once.
+    const auto& local = local_.get();
+    const auto& remote = remote_.get();
+    const auto chain = chain_;
+    const auto prompt = api_.Factory().PasswordPrompt(reason);
+
+    switch (type) {
+        case internalType: {
+            return [&local, &remote, chain, prompt](
+                       const Bip32Index first, const Bip32Index count) {
+                auto keys =
+                    local.Outgoing(remote, first, count, chain, prompt);
+
+                return std::vector<ECKey>{
+                    std::make_move_iterator(keys.begin()),
+                    std::make_move_iterator(keys.end())};
+            };
+        }
+        case externalType: {
+            return [&local, &remote, chain, prompt](
+                       const Bip32Index first, const Bip32Index count) {
+                auto keys =
+                    local.Incoming(remote, first, count, chain, prompt);
+
+                return std::vector<ECKey>{
+                    std::make_move_iterator(keys.begin()),
+                    std::make_move_iterator(keys.end())};
+            };
+        }
+        default: {
+            LogOutput(OT_METHOD)(__func__)(": Invalid subchain").Flush();
+
+            return {};
+        }
+    }
+}
+
 auto PaymentCode::PrivateKey(
     const Subchain type,
     const Bip32Index index,
@@ -156,6 +156,10 @@ private:
         return contact_id_;
     }
     auto has_private(const PasswordPrompt& reason) const noexcept -> bool;
+    auto key_deriver(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept -> Deriver final;
     auto save(const rLock& lock) const noexcept -> bool final;
     auto set_deterministic_contact(
         std::set<OTIdentifier>& contacts) const noexcept -> void final
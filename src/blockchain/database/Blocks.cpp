@@ -77,7 +77,7 @@ auto Blocks::LoadBitcoin(const block::Hash& block) const noexcept
         const auto bytes = common_.BlockLoad(block);
 
         if (false == bytes.valid()) {
-            LogDebug(OT_METHOD)(__func__)(": block ")(block.asHex())(
+            OT_LOG_DEBUG(OT_METHOD)(__func__)(": block ")(block.asHex())(
                 " not found.")
                 .Flush();
 
@@ -54,6 +54,10 @@ const storage::lmdb::TableNames Database::table_names_{
     {database::BlockHeaderDisconnected, "disconnected_block_headers"},
     {database::BlockFilterBest, "filter_tips"},
     {database::BlockFilterHeaderBest, "filter_header_tips"},
+    {database::WalletOutputs, "wallet_outputs"},
+    {database::WalletOutputJournal, "wallet_output_journal"},
+    {database::WalletOutputOwners, "wallet_output_owners"},
+    {database::WalletSubchainScanned, "wallet_subchain_scanned"},
 };
 
 Database::Database(
@@ -78,6 +82,10 @@ Database::Database(
                 {database::BlockHeaderDisconnected, MDB_DUPSORT},
                 {database::BlockFilterBest, MDB_INTEGERKEY},
                 {database::BlockFilterHeaderBest, MDB_INTEGERKEY},
+                {database::WalletOutputs, 0},
+                {database::WalletOutputJournal, MDB_INTEGERKEY},
+                {database::WalletOutputOwners, MDB_DUPSORT},
+                {database::WalletSubchainScanned, 0},
             },
             0};
         init_db(lmdb);
@@ -87,7 +95,7 @@ Database::Database(
     , blocks_(api, common_, lmdb_, type)
     , filters_(api, common_, lmdb_, type)
     , headers_(api, network, common_, lmdb_, type)
-    , wallet_(api, blockchain, common_, chain_)
+    , wallet_(api, blockchain, common_, lmdb_, chain_)
     , sync_(api, common_, lmdb_, type)
 {
 }
@@ -351,6 +351,20 @@ public:
     {
         return filters_.LoadFilterHeader(type, block);
     }
+    auto LoadFilterHeaders(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<Hash> final
+    {
+        return filters_.LoadFilterHeaders(type, blocks);
+    }
+    auto LoadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const node::GCS>> final
+    {
+        return filters_.LoadFilters(type, blocks);
+    }
     // Throws std::out_of_range if the header does not exist
     auto LoadHeader(const block::Hash& hash) const noexcept(false)
         -> std::unique_ptr<block::Header> final
@@ -400,6 +414,14 @@ public:
     {
         return wallet_.ReserveUTXO(spender, proposal, policy);
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const Selection& selection) const noexcept -> std::vector<UTXO> final
+    {
+        return wallet_.ReserveUTXOs(spender, proposal, policy, selection);
+    }
     auto SetBlockTip(const block::Position& position) const noexcept
         -> bool final
     {
@@ -11,6 +11,7 @@
 #include <boost/container/vector.hpp>
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -179,6 +180,29 @@ auto Filters::LoadFilterHeader(const filter::Type type, const ReadView block)
     return api_.Factory().Data();
 }
 
+auto Filters::LoadFilterHeaders(
+    const filter::Type type,
+    const std::vector<block::pHash>& blocks) const noexcept
+    -> std::vector<Hash>
+{
+    auto output = std::vector<Hash>{};
+    output.reserve(blocks.size());
+
+    for (const auto& header : common_.LoadFilterHeaders(type, views(blocks))) {
+        output.emplace_back(api_.Factory().Data(reader(header)));
+    }
+
+    return output;
+}
+
+auto Filters::LoadFilters(
+    const filter::Type type,
+    const std::vector<block::pHash>& blocks) const noexcept
+    -> std::vector<std::unique_ptr<const blockchain::node::GCS>>
+{
+    return common_.LoadFilters(type, views(blocks));
+}
+
 auto Filters::SetHeaderTip(
     const filter::Type type,
     const block::Position& position) const noexcept -> bool
@@ -263,4 +287,18 @@ auto Filters::StoreHeaders(
 {
     return common_.StoreFilterHeaders(type, headers);
 }
+
+auto Filters::views(const std::vector<block::pHash>& blocks) noexcept
+    -> std::vector<ReadView>
+{
+    auto output = std::vector<ReadView>{};
+    output.reserve(blocks.size());
+    std::transform(
+        blocks.begin(),
+        blocks.end(),
+        std::back_inserter(output),
+        [](const auto& hash) { return hash->Bytes(); });
+
+    return output;
+}
 }  // namespace opentxs::blockchain::database
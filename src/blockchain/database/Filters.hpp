@@ -90,6 +90,14 @@ public:
         const noexcept -> Hash;
     auto LoadFilterHeader(const filter::Type type, const ReadView block)
         const noexcept -> Hash;
+    auto LoadFilterHeaders(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<Hash>;
+    auto LoadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const blockchain::node::GCS>>;
     auto SetHeaderTip(const filter::Type type, const block::Position& position)
         const noexcept -> bool;
     auto SetTip(const filter::Type type, const block::Position& position)
@@ -119,6 +127,9 @@ private:
     const block::Position blank_position_;
     mutable std::mutex lock_;
 
+    static auto views(const std::vector<block::pHash>& blocks) noexcept
+        -> std::vector<ReadView>;
+
     auto import_genesis(const blockchain::Type type) const noexcept -> void;
 };
 }  // namespace opentxs::blockchain::database
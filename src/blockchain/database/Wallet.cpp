@@ -28,13 +28,30 @@ Wallet::Wallet(
     const api::Core& api,
     const api::client::internal::Blockchain& blockchain,
     const common::Database& common,
+    const storage::lmdb::LMDB& lmdb,
     const blockchain::Type chain) noexcept
     : common_(common)
-    , subchains_(api)
+    , subchains_(api, lmdb)
     , proposals_()
     , transactions_(api, blockchain, common_)
-    , outputs_(api, blockchain, chain, subchains_, proposals_, transactions_)
-{
+    , outputs_(
+          api,
+          blockchain,
+          lmdb,
+          chain,
+          subchains_,
+          proposals_,
+          transactions_)
+{
+    // NOTE scan progress which is not backed by a valid journal entry must be
+    // discarded so the missing outputs will be found again
+    if (const auto damaged = outputs_.Load(); damaged.has_value()) {
+        LogOutput(OT_METHOD)(__func__)(
+            ": Wallet output journal is damaged beyond height ")(
+            damaged.value())
+            .Flush();
+        subchains_.Rewind(damaged.value() - 1);
+    }
 }
 
 auto Wallet::AddConfirmedTransaction(
@@ -230,6 +247,21 @@ auto Wallet::ReserveUTXO(
     return outputs_.ReserveUTXO(spender, id, policy);
 }
 
+auto Wallet::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& id,
+    const Spend policy,
+    const Selection& selection) const noexcept -> std::vector<UTXO>
+{
+    if (false == proposals_.Exists(id)) {
+        LogOutput(OT_METHOD)(__func__)(": Proposal does not exist").Flush();
+
+        return {};
+    }
+
+    return outputs_.ReserveUTXOs(spender, id, policy, selection);
+}
+
 auto Wallet::SetDefaultFilterType(const FilterType type) const noexcept -> bool
 {
     return subchains_.SetDefaultFilterType(type);
@@ -114,6 +114,7 @@ public:
     using MatchingIndices = Parent::MatchingIndices;
     using UTXO = Parent::UTXO;
     using Spend = Parent::Spend;
+    using Selection = Parent::Selection;
     using State = node::Wallet::TxoState;
 
     auto AddConfirmedTransaction(
@@ -175,6 +176,11 @@ public:
         const identifier::Nym& spender,
         const Identifier& proposal,
         const Spend policy) const noexcept -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const Selection& selection) const noexcept -> std::vector<UTXO>;
     auto SetDefaultFilterType(const FilterType type) const noexcept -> bool;
     auto SubchainAddElements(
         const SubchainIndex& index,
@@ -197,6 +203,7 @@ public:
         const api::Core& api,
         const api::client::internal::Blockchain& blockchain,
         const common::Database& common,
+        const storage::lmdb::LMDB& lmdb,
         const blockchain::Type chain) noexcept;
 
 private:
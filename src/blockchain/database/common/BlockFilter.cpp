@@ -37,6 +37,20 @@ auto tsv(const Input& in) noexcept -> ReadView
     return {reinterpret_cast<const char*>(&in), sizeof(in)};
 }
 
+template <typename Header, typename Hash>
+auto serialize(const Header& header, const Hash& hash) noexcept -> Space
+{
+    auto proto = proto::BlockchainFilterHeader();
+    proto.set_version(1);
+    proto.set_header(header->str());
+    proto.set_hash(std::string{hash});
+    auto bytes = space(proto.ByteSize());
+    proto.SerializeWithCachedSizesToArray(
+        reinterpret_cast<std::uint8_t*>(bytes.data()));
+
+    return bytes;
+}
+
 BlockFilter::BlockFilter(
     const api::Core& api,
     storage::lmdb::LMDB& lmdb,
@@ -222,11 +236,93 @@ auto BlockFilter::store(
     }
 }
 
+auto BlockFilter::LoadFilterHeaders(
+    const FilterType type,
+    const std::vector<ReadView>& blocks) const noexcept -> std::vector<Space>
+{
+    auto output = std::vector<Space>(blocks.size());
+
+    try {
+        auto cb = [&](const std::size_t index, const ReadView value) {
+            if ((nullptr != value.data()) && (0 < value.size())) {
+                const auto proto = proto::Factory<proto::BlockchainFilterHeader>(
+                    value.data(), value.size());
+                output.at(index) = space(proto.header());
+            }
+
+            return true;
+        };
+        lmdb_.Load(translate_header(type), blocks, cb);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+    }
+
+    return output;
+}
+
+auto BlockFilter::LoadFilters(
+    const FilterType type,
+    const std::vector<ReadView>& blocks) const noexcept
+    -> std::vector<std::unique_ptr<const opentxs::blockchain::node::GCS>>
+{
+    auto output =
+        std::vector<std::unique_ptr<const opentxs::blockchain::node::GCS>>{};
+    output.resize(blocks.size());
+
+    try {
+        auto found = std::vector<std::size_t>{};
+        auto indices = std::vector<util::IndexData>{};
+        found.reserve(blocks.size());
+        indices.reserve(blocks.size());
+        auto cb = [&](const std::size_t position, const ReadView value) {
+            auto index = util::IndexData{};
+
+            if (sizeof(index) == value.size()) {
+                std::memcpy(
+                    static_cast<void*>(&index), value.data(), value.size());
+            }
+
+            if (0 < index.size_) {
+                found.emplace_back(position);
+                indices.emplace_back(index);
+            }
+
+            return true;
+        };
+        lmdb_.Load(translate_filter(type), blocks, cb);
+        const auto views = bulk_.ReadViews(indices);
+
+        for (auto i = std::size_t{0}; i < views.size(); ++i) {
+            output.at(found.at(i)) = factory::GCS(
+                api_, proto::Factory<proto::GCS>(views.at(i)));
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+    }
+
+    return output;
+}
+
 auto BlockFilter::StoreFilterHeaders(
     const FilterType type,
     const std::vector<FilterHeader>& headers) const noexcept -> bool
 {
-    return StoreFilters(type, headers, {});
+    // NOTE headers do not use bulk storage so they can be committed by the
+    // writer thread instead of blocking every other writer
+    try {
+        const auto table = translate_header(type);
+        auto batch = lmdb_.StartBatch();
+
+        for (const auto& [block, header, hash] : headers) {
+            batch.Store(table, block->Bytes(), reader(serialize(header, hash)));
+        }
+
+        return batch.Submit().get();
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+        return false;
+    }
 }
 
 auto BlockFilter::StoreFilters(
@@ -245,13 +341,7 @@ auto BlockFilter::StoreFilters(
     auto lock = Lock{bulk_.Mutex()};
 
     for (const auto& [block, header, hash] : headers) {
-        auto proto = proto::BlockchainFilterHeader();
-        proto.set_version(1);
-        proto.set_header(header->str());
-        proto.set_hash(std::string{hash});
-        auto bytes = space(proto.ByteSize());
-        proto.SerializeWithCachedSizesToArray(
-            reinterpret_cast<std::uint8_t*>(bytes.data()));
+        const auto bytes = serialize(header, hash);
 
         try {
             const auto stored = lmdb_.Store(
@@ -68,6 +68,17 @@ public:
         const FilterType type,
         const ReadView blockHash,
         const AllocateOutput header) const noexcept -> bool;
+    /// Headers are returned in the order requested. Missing headers are
+    /// represented by an empty value.
+    auto LoadFilterHeaders(
+        const FilterType type,
+        const std::vector<ReadView>& blocks) const noexcept
+        -> std::vector<Space>;
+    /// Filters are returned in the order requested. Missing filters are
+    /// represented by a null pointer.
+    auto LoadFilters(const FilterType type, const std::vector<ReadView>& blocks)
+        const noexcept
+        -> std::vector<std::unique_ptr<const opentxs::blockchain::node::GCS>>;
     auto StoreFilterHeaders(
         const FilterType type,
         const std::vector<FilterHeader>& headers) const noexcept -> bool;
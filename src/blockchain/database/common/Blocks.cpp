@@ -58,7 +58,7 @@ auto Blocks::Load(const Hash& block) const noexcept -> BlockReader
     lmdb_.Load(table_, block.Bytes(), cb);
 
     if (0 == index.size_) {
-        LogTrace(OT_METHOD)(__func__)(": Block ")(block.asHex())(
+        OT_LOG_TRACE(OT_METHOD)(__func__)(": Block ")(block.asHex())(
             " not found in index")
             .Flush();
 
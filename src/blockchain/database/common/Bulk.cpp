@@ -9,6 +9,7 @@
 
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
@@ -23,6 +24,11 @@ struct Bulk::Imp final : private util::MappedFileStorage {
     {
         return get_read_view(index);
     }
+    auto ReadViews(const Lock&, const std::vector<util::IndexData>& indices)
+        const noexcept -> std::vector<opentxs::ReadView>
+    {
+        return get_read_views(indices);
+    }
     auto WriteView(
         const Lock&,
         storage::lmdb::LMDB::Transaction& tx,
@@ -69,6 +75,14 @@ auto Bulk::ReadView(const Lock& lock, const util::IndexData& index)
     return imp_->ReadView(lock, index);
 }
 
+auto Bulk::ReadViews(const std::vector<util::IndexData>& indices)
+    const noexcept -> std::vector<opentxs::ReadView>
+{
+    auto lock = Lock{imp_->Mutex()};
+
+    return imp_->ReadViews(lock, indices);
+}
+
 auto Bulk::WriteView(
     storage::lmdb::LMDB::Transaction& tx,
     util::IndexData& index,
@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Types.hpp"
@@ -44,6 +45,8 @@ public:
         -> opentxs::ReadView;
     auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
+    auto ReadViews(const std::vector<util::IndexData>& indices) const noexcept
+        -> std::vector<opentxs::ReadView>;
     auto WriteView(
         storage::lmdb::LMDB::Transaction& tx,
         util::IndexData& index,
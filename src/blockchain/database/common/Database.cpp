@@ -14,6 +14,7 @@ extern "C" {
 
 #include <boost/filesystem.hpp>
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <iosfwd>
@@ -348,6 +349,15 @@ struct Database::Imp {
 
         static_assert(
             sizeof(opentxs::blockchain::PatternID) == crypto_shorthash_BYTES);
+
+        if (const auto interval = args.BlockchainSyncInterval(); 0 < interval) {
+            if (false ==
+                lmdb_.SyncInterval(std::chrono::milliseconds{interval})) {
+                LogOutput("Failed to enable deferred blockchain database "
+                          "flushing")
+                    .Flush();
+            }
+        }
     }
 };
 
@@ -554,6 +564,21 @@ auto Database::LoadFilterHeader(
     return imp_.filters_.LoadFilterHeader(type, blockHash, header);
 }
 
+auto Database::LoadFilterHeaders(
+    const FilterType type,
+    const std::vector<ReadView>& blocks) const noexcept -> std::vector<Space>
+{
+    return imp_.filters_.LoadFilterHeaders(type, blocks);
+}
+
+auto Database::LoadFilters(
+    const FilterType type,
+    const std::vector<ReadView>& blocks) const noexcept
+    -> std::vector<std::unique_ptr<const opentxs::blockchain::node::GCS>>
+{
+    return imp_.filters_.LoadFilters(type, blocks);
+}
+
 auto Database::LoadTransaction(const ReadView txid) const noexcept
     -> std::optional<proto::BlockchainTransaction>
 {
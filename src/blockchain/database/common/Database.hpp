@@ -153,6 +153,13 @@ public:
         const FilterType type,
         const ReadView blockHash,
         const AllocateOutput header) const noexcept -> bool;
+    auto LoadFilterHeaders(
+        const FilterType type,
+        const std::vector<ReadView>& blocks) const noexcept
+        -> std::vector<Space>;
+    auto LoadFilters(const FilterType type, const std::vector<ReadView>& blocks)
+        const noexcept
+        -> std::vector<std::unique_ptr<const opentxs::blockchain::node::GCS>>;
     auto LoadSync(
         const Chain chain,
         const Height height,
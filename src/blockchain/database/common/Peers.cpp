@@ -213,10 +213,9 @@ auto Peers::Insert(Address_p pAddress) noexcept -> bool
     return insert(lock, std::move(peers));
 }
 
-auto Peers::insert(const Lock& lock, std::vector<Address_p> peers) noexcept
-    -> bool
+auto Peers::insert(Lock& lock, std::vector<Address_p> peers) noexcept -> bool
 {
-    auto parentTxn = lmdb_.TransactionRW();
+    auto batch = lmdb_.StartBatch();
 
     for (auto& pAddress : peers) {
         if (false == bool(pAddress)) {
@@ -235,112 +234,50 @@ auto Peers::insert(const Lock& lock, std::vector<Address_p> peers) noexcept
 
         // write to database
         {
-            auto result = lmdb_.Store(
-                Table::PeerDetails,
-                id,
-                [&] {
-                    auto proto =
-                        opentxs::blockchain::p2p::Address::SerializedType{};
-                    address.Serialize(proto);
-
-                    return proto::ToString(proto);
-                }(),
-                parentTxn);
-
-            if (false == result.first) {
-                LogOutput(OT_METHOD)(__func__)(": Failed to save peer address")
-                    .Flush();
-
-                return false;
-            }
-
-            result = lmdb_.Store(
+            batch.Store(Table::PeerDetails, id, [&] {
+                auto proto =
+                    opentxs::blockchain::p2p::Address::SerializedType{};
+                address.Serialize(proto);
+
+                return proto::ToString(proto);
+            }());
+            batch.Store(
                 Table::PeerChainIndex,
                 static_cast<std::size_t>(address.Chain()),
-                id,
-                parentTxn);
-
-            if (false == result.first) {
-                LogOutput(OT_METHOD)(__func__)(
-                    ": Failed to save peer chain index")
-                    .Flush();
-
-                return false;
-            }
-
-            result = lmdb_.Store(
+                id);
+            batch.Store(
                 Table::PeerProtocolIndex,
                 static_cast<std::size_t>(address.Style()),
-                id,
-                parentTxn);
-
-            if (false == result.first) {
-                LogOutput(OT_METHOD)(__func__)(
-                    ": Failed to save peer protocol index")
-                    .Flush();
-
-                return false;
-            }
+                id);
 
             for (const auto& service : address.Services()) {
-                result = lmdb_.Store(
+                batch.Store(
                     Table::PeerServiceIndex,
                     static_cast<std::size_t>(service),
-                    id,
-                    parentTxn);
-
-                if (false == result.first) {
-                    LogOutput(OT_METHOD)(__func__)(
-                        ": Failed to save peer service index")
-                        .Flush();
-
-                    return false;
-                }
+                    id);
             }
 
             for (const auto& service : deleteServices) {
-                result.first = lmdb_.Delete(
+                batch.Delete(
                     Table::PeerServiceIndex,
                     static_cast<std::size_t>(service),
-                    id,
-                    parentTxn);
+                    id);
             }
 
-            result = lmdb_.Store(
+            batch.Store(
                 Table::PeerNetworkIndex,
                 static_cast<std::size_t>(address.Type()),
-                id,
-                parentTxn);
-
-            if (false == result.first) {
-                LogOutput(OT_METHOD)(__func__)(
-                    ": Failed to save peer network index")
-                    .Flush();
-
-                return false;
-            }
-
-            result = lmdb_.Store(
+                id);
+            batch.Store(
                 Table::PeerConnectedIndex,
                 static_cast<std::size_t>(
                     Clock::to_time_t(address.LastConnected())),
-                id,
-                parentTxn);
-
-            if (false == result.first) {
-                LogOutput(OT_METHOD)(__func__)(
-                    ": Failed to save peer network index")
-                    .Flush();
-
-                return false;
-            }
-
-            lmdb_.Delete(
+                id);
+            batch.Delete(
                 Table::PeerConnectedIndex,
                 static_cast<std::size_t>(
                     Clock::to_time_t(address.PreviousLastConnected())),
-                id,
-                parentTxn);
+                id);
         }
 
         // Update in-memory indices to match database
@@ -361,7 +298,12 @@ auto Peers::insert(const Lock& lock, std::vector<Address_p> peers) noexcept
         }
     }
 
-    if (false == parentTxn.Finalize(true)) {
+    // NOTE the batch is queued while holding the lock so concurrent inserts
+    // are committed in the same order as the in-memory indices were updated
+    const auto committed = batch.Submit();
+    lock.unlock();
+
+    if (false == committed.get()) {
         LogOutput(OT_METHOD)(__func__)(": Database error").Flush();
 
         return false;
@@ -70,8 +70,7 @@ private:
     TypeIndexMap networks_;
     ConnectedIndexMap connected_;
 
-    auto insert(const Lock& lock, std::vector<Address_p> peers) noexcept
-        -> bool;
+    auto insert(Lock& lock, std::vector<Address_p> peers) noexcept -> bool;
     auto load_address(const std::string& id) const noexcept(false) -> Address_p;
     template <typename Index, typename Map>
     auto read_index(
@@ -60,7 +60,7 @@ auto Wallet::AssociateTransaction(
     const Txid& txid,
     const std::vector<PatternID>& in) const noexcept -> bool
 {
-    LogTrace(OT_METHOD)(__func__)(": Transaction ")(txid.asHex())(
+    OT_LOG_TRACE(OT_METHOD)(__func__)(": Transaction ")(txid.asHex())(
         " is associated with patterns:")
         .Flush();
     // TODO transaction data never changes so indexing should only happen
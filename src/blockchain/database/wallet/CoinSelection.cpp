@@ -0,0 +1,174 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/database/wallet/CoinSelection.hpp"  // IWYU pragma: associated
+
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+
+#define OT_WALLET_BNB_MAX_TRIES 100000
+#define OT_WALLET_KNAPSACK_ITERATIONS 1000
+
+namespace opentxs::blockchain::database::wallet
+{
+auto SelectBnB(
+    const Candidates& candidates,
+    const Selection& selection) noexcept -> Candidates
+{
+    const auto target = selection.target_;
+    const auto limit = target + selection.change_threshold_;
+    auto available = std::accumulate(
+        candidates.begin(),
+        candidates.end(),
+        Amount{0},
+        [](const auto sum, const auto& item) { return sum + item.first; });
+
+    if (available < target) { return {}; }
+
+    auto value = Amount{0};
+    auto current = std::vector<bool>{};
+    auto best = std::vector<bool>{};
+    auto bestExcess = std::numeric_limits<Amount>::max();
+
+    for (auto i = std::size_t{0}; i < OT_WALLET_BNB_MAX_TRIES; ++i) {
+        auto backtrack{false};
+
+        if (((value + available) < target) || (value > limit)) {
+            backtrack = true;
+        } else if (value >= target) {
+            const auto excess = value - target;
+
+            if (excess < bestExcess) {
+                bestExcess = excess;
+                best = current;
+
+                if (0 == excess) { break; }
+            }
+
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            while ((false == current.empty()) && (false == current.back())) {
+                current.pop_back();
+                available += candidates.at(current.size()).first;
+            }
+
+            if (current.empty()) { break; }
+
+            current.back() = false;
+            value -= candidates.at(current.size() - 1u).first;
+        } else {
+            const auto& next = candidates.at(current.size());
+            available -= next.first;
+
+            // NOTE including this output after excluding a previous output of
+            // the same value would repeat an explored branch
+            if ((false == current.empty()) && (false == current.back()) &&
+                (candidates.at(current.size() - 1u).first == next.first)) {
+                current.emplace_back(false);
+            } else {
+                current.emplace_back(true);
+                value += next.first;
+            }
+        }
+    }
+
+    auto output = Candidates{};
+
+    for (auto i = std::size_t{0}; i < best.size(); ++i) {
+        if (best.at(i)) { output.emplace_back(candidates.at(i)); }
+    }
+
+    return output;
+}
+
+auto SelectKnapsack(
+    const Candidates& candidates,
+    const Selection& selection,
+    const std::uint64_t seed) noexcept -> Candidates
+{
+    const auto target = selection.target_ + selection.change_threshold_;
+    auto smaller = Candidates{};
+    auto larger = std::optional<Candidates::value_type>{};
+    auto total = Amount{0};
+
+    // NOTE candidates are sorted in descending order so the last larger
+    // candidate found is the smallest one
+    for (const auto& candidate : candidates) {
+        if (candidate.first >= target) {
+            larger = candidate;
+        } else {
+            smaller.emplace_back(candidate);
+            total += candidate.first;
+        }
+    }
+
+    if (total < target) {
+        if (larger.has_value()) { return {larger.value()}; }
+
+        // NOTE the remaining excess is too small to be worth returning
+        if (total >= selection.target_) { return smaller; }
+
+        return {};
+    }
+
+    auto best = std::vector<bool>(smaller.size(), true);
+    auto bestValue = total;
+    auto rng = std::mt19937_64{seed};
+    auto coin = std::bernoulli_distribution{0.5};
+
+    for (auto i = std::size_t{0};
+         (i < OT_WALLET_KNAPSACK_ITERATIONS) && (bestValue != target);
+         ++i) {
+        auto included = std::vector<bool>(smaller.size(), false);
+        auto value = Amount{0};
+        auto reached{false};
+
+        for (auto pass = 0; (pass < 2) && (false == reached); ++pass) {
+            for (auto j = std::size_t{0}; j < smaller.size(); ++j) {
+                const auto take =
+                    (0 == pass) ? coin(rng) : (false == included.at(j));
+
+                if (false == take) { continue; }
+
+                value += smaller.at(j).first;
+                included.at(j) = true;
+
+                if (value >= target) {
+                    reached = true;
+
+                    if (value < bestValue) {
+                        bestValue = value;
+                        best = included;
+                    }
+
+                    value -= smaller.at(j).first;
+                    included.at(j) = false;
+                }
+            }
+        }
+    }
+
+    if (larger.has_value() && (bestValue != target) &&
+        (larger.value().first <= bestValue)) {
+
+        return {larger.value()};
+    }
+
+    auto output = Candidates{};
+
+    for (auto i = std::size_t{0}; i < best.size(); ++i) {
+        if (best.at(i)) { output.emplace_back(smaller.at(i)); }
+    }
+
+    return output;
+}
+}  // namespace opentxs::blockchain::database::wallet
@@ -0,0 +1,40 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/Types.hpp"
+
+namespace opentxs::blockchain::database::wallet
+{
+using Selection = node::internal::WalletDatabase::Selection;
+// NOTE pairs of effective value and output id, sorted in descending order
+using Candidates = std::vector<std::pair<Amount, std::uint32_t>>;
+
+/** Depth first search for the input set with the least excess value which
+ *  does not require a change output
+ *
+ *  Returns an empty set if no combination of candidates lands between the
+ *  target and the change threshold.
+ */
+auto SelectBnB(
+    const Candidates& candidates,
+    const Selection& selection) noexcept -> Candidates;
+/** Approximate the smallest input set which covers the target plus enough
+ *  value to create a change output
+ *
+ *  The search is randomized. Passing the same seed produces the same
+ *  result.
+ */
+auto SelectKnapsack(
+    const Candidates& candidates,
+    const Selection& selection,
+    const std::uint64_t seed) noexcept -> Candidates;
+}  // namespace opentxs::blockchain::database::wallet
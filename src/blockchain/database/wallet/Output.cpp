@@ -10,14 +10,19 @@
 #include <robin_hood.h>
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstring>
 #include <iosfwd>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <ostream>
+#include <random>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -25,10 +30,13 @@
 #include <utility>
 #include <variant>
 
+#include "blockchain/database/wallet/CoinSelection.hpp"
 #include "blockchain/database/wallet/Proposal.hpp"
 #include "blockchain/database/wallet/Subchain.hpp"
 #include "blockchain/database/wallet/Transaction.hpp"
+#include "Proto.tpp"
 #include "internal/api/client/Client.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/node/Node.hpp"
 #include "opentxs/Bytes.hpp"
@@ -59,6 +67,9 @@
 #include "opentxs/protobuf/Check.hpp"
 #include "opentxs/protobuf/verify/BlockchainTransactionOutput.hpp"
 #include "util/Container.hpp"
+#include "util/LMDB.hpp"
+
+#define OT_WALLET_JOURNAL_COMPACT_THRESHOLD 10000
 
 #define OT_METHOD "opentxs::blockchain::database::Output::"
 
@@ -217,8 +228,8 @@ struct Output::Imp {
             }
 
             try {
-                auto& serialized = find_output(lock, outpoint);
-                const auto& [state, position, proto] = serialized;
+                const auto id = find_output(lock, outpoint);
+                const auto proto = load_output(lock, id);
 
                 if (!copy.AssociatePreviousOutput(
                         blockchain_, inputIndex, proto)) {
@@ -229,8 +240,7 @@ struct Output::Imp {
                     return false;
                 }
 
-                if (false ==
-                    change_state(lock, outpoint, serialized, consumed, block)) {
+                if (false == change_state(lock, id, consumed, block)) {
                     LogOutput(OT_METHOD)(__func__)(
                         ": Error updating consumed output state")
                         .Flush();
@@ -264,10 +274,9 @@ struct Output::Imp {
             OT_ASSERT(outpoint.Index() == index);
 
             try {
-                auto& serialized = find_output(lock, outpoint);
+                const auto id = find_output(lock, outpoint);
 
-                if (false ==
-                    change_state(lock, outpoint, serialized, created, block)) {
+                if (false == change_state(lock, id, created, block)) {
                     LogOutput(OT_METHOD)(__func__)(
                         ": Error updating created output state")
                         .Flush();
@@ -334,12 +343,10 @@ struct Output::Imp {
             return false;
         }
 
-        // NOTE do not call this function except for debugging: print(lock);
-        blockchain_.UpdateBalance(chain_, get_balance(lock));
+        if (false == write(lock)) { return false; }
 
-        for (const auto& [nym, balance] : get_balances(lock)) {
-            blockchain_.UpdateBalance(nym, chain_, balance);
-        }
+        // NOTE do not call this function except for debugging: print(lock);
+        publish_balances(lock);
 
         return true;
     }
@@ -432,14 +439,10 @@ struct Output::Imp {
             const auto& outpoint = *it;
 
             try {
-                auto& serialized = find_output(lock, outpoint);
+                const auto id = find_output(lock, outpoint);
 
                 if (false == change_state(
-                                 lock,
-                                 outpoint,
-                                 serialized,
-                                 TxoState::UnconfirmedNew,
-                                 blank_)) {
+                                 lock, id, TxoState::UnconfirmedNew, blank_)) {
                     LogOutput(OT_METHOD)(__func__)(
                         ": Error updating created output state")
                         .Flush();
@@ -493,12 +496,10 @@ struct Output::Imp {
             return false;
         }
 
-        print(lock);
-        blockchain_.UpdateBalance(chain_, get_balance(lock));
+        if (false == write(lock)) { return false; }
 
-        for (const auto& [nym, balance] : get_balances(lock)) {
-            blockchain_.UpdateBalance(nym, chain_, balance);
-        }
+        // NOTE do not call this function except for debugging: print(lock);
+        publish_balances(lock);
 
         return true;
     }
@@ -509,16 +510,31 @@ struct Output::Imp {
         auto& created = proposal_created_index_[id];
 
         for (const auto& id : reserved) {
-            if (false == change_state(
-                             lock,
-                             id,
-                             TxoState::UnconfirmedSpend,
-                             TxoState::ConfirmedNew)) {
-                LogOutput(OT_METHOD)(__func__)(": failed to reclaim outpoint ")(
-                    id.str())
-                    .Flush();
+            const auto it = [&] {
+                const auto output = output_ids_.find(id);
 
-                return false;
+                if (output_ids_.end() == output) { return reserved_.end(); }
+
+                return reserved_.find(output->second);
+            }();
+
+            // NOTE outputs which are no longer in reserved_ have been seen in
+            // a transaction so the spend is real and must not be reverted
+            if (reserved_.end() != it) {
+                if (false == change_state(
+                                 lock,
+                                 id,
+                                 TxoState::UnconfirmedSpend,
+                                 it->second,
+                                 false)) {
+                    LogOutput(OT_METHOD)(__func__)(
+                        ": failed to reclaim outpoint ")(id.str())
+                        .Flush();
+
+                    return false;
+                }
+
+                reserved_.erase(it);
             }
 
             proposal_reverse_index_.erase(id);
@@ -529,7 +545,8 @@ struct Output::Imp {
                              lock,
                              id,
                              TxoState::UnconfirmedNew,
-                             TxoState::OrphanedNew)) {
+                             TxoState::OrphanedNew,
+                             true)) {
                 LogOutput(OT_METHOD)(__func__)(
                     ": failed to orphan canceled outpoint ")(id.str())
                     .Flush();
@@ -541,56 +558,169 @@ struct Output::Imp {
         proposal_spent_index_.erase(id);
         proposal_created_index_.erase(id);
 
+        if (false == write(lock)) { return false; }
+
         return proposals_.CancelProposal(id);
     }
+    auto Load() noexcept -> std::optional<block::Height>
+    {
+        auto lock = eLock{lock_};
+        auto damaged = std::optional<block::Height>{};
+        auto entries = std::size_t{0};
+        // NOTE losing an unconfirmed entry does not affect scan progress but
+        // an unreadable entry could have been anything
+        const auto discard = [&](const block::Height height) {
+            if (0 > height) { return; }
+
+            damaged = std::min(damaged.value_or(height), height);
+        };
+        const auto replay = [&](const auto key, const auto value) -> bool {
+            std::memcpy(
+                &next_entry_,
+                key.data(),
+                std::min(key.size(), sizeof(next_entry_)));
+            ++next_entry_;
+            ++entries;
+
+            if (value.size() <= sizeof(Outpoint) + 1u) {
+                LogOutput(OT_METHOD)(__func__)(": Invalid journal entry")
+                    .Flush();
+                damaged = -1;
+
+                return true;
+            }
+
+            const auto outpoint = Outpoint{value.substr(0, sizeof(Outpoint))};
+            const auto state =
+                static_cast<TxoState>(value.at(sizeof(Outpoint)));
+            const auto position = blockchain::internal::Deserialize(
+                api_, value.substr(sizeof(Outpoint) + 1u));
+
+            if (damaged.has_value()) {
+                discard(position.first);
+
+                return true;
+            }
+
+            if (const auto it = output_ids_.find(outpoint);
+                output_ids_.end() != it) {
+                change_state(lock, it->second, state, position, false);
+
+                return true;
+            }
+
+            auto data = std::optional<proto::BlockchainTransactionOutput>{};
+            lmdb_.Load(
+                database::WalletOutputs, outpoint.Bytes(), [&](const auto in) {
+                    data = proto::Factory<proto::BlockchainTransactionOutput>(
+                        in.data(), in.size());
+                });
+
+            if ((false == data.has_value()) ||
+                (false == proto::Validate(data.value(), VERBOSE))) {
+                LogOutput(OT_METHOD)(__func__)(": Missing output ")(
+                    outpoint.str())
+                    .Flush();
+                discard(position.first);
+
+                return true;
+            }
+
+            add_output(lock, outpoint, state, position, data->value());
+
+            return true;
+        };
+        lmdb_.Read(
+            database::WalletOutputJournal,
+            replay,
+            storage::lmdb::LMDB::Dir::Forward);
+        const auto owners = [&](const auto key, const auto value) -> bool {
+            if ((key.size() != sizeof(Outpoint)) || (value.size() < 2u)) {
+                return true;
+            }
+
+            const auto it = output_ids_.find(Outpoint{key});
+
+            if (output_ids_.end() == it) { return true; }
+
+            const auto id = it->second;
+            const auto type = static_cast<Owner>(value.at(0));
+            const auto bytes = value.substr(1u);
+
+            switch (type) {
+                case Owner::Account: {
+                    auto account = api_.Factory().Identifier();
+                    account->Assign(bytes.data(), bytes.size());
+
+                    add_account(lock, id, account);
+                } break;
+                case Owner::Subchain: {
+                    auto subchain = api_.Factory().Identifier();
+                    subchain->Assign(bytes.data(), bytes.size());
+                    index_add(subchain_index_[subchain], id);
+                } break;
+                case Owner::Nym: {
+                    auto nym = api_.Factory().NymID();
+                    nym->Assign(bytes.data(), bytes.size());
+
+                    add_nym(lock, id, nym);
+                } break;
+                default: {
+                }
+            }
+
+            return true;
+        };
+        lmdb_.Read(
+            database::WalletOutputOwners,
+            owners,
+            storage::lmdb::LMDB::Dir::Forward);
+        changed_nyms_.clear();
+        const auto count = outputs_.outpoint_.size();
+        LogVerbose(OT_METHOD)(__func__)(": Loaded ")(count)(" outputs from ")(
+            entries)(" journal entries")
+            .Flush();
+
+        if (damaged.has_value() || need_compaction(lock)) { compact(lock); }
+
+        return damaged;
+    }
     auto ReserveUTXO(
         const identifier::Nym& spender,
         const Identifier& id,
         const Spend policy) noexcept -> std::optional<UTXO>
     {
-        // TODO implement smarter selection algorithms
         auto lock = eLock{lock_};
-        auto output = std::optional<UTXO>{std::nullopt};
-        const auto choose = [&](const auto outpoint) -> std::optional<UTXO> {
-            auto& serialized = find_output(lock, outpoint);
-            const auto& [state, position, data] = serialized;
+        const auto select = [&](const TxoState state) -> std::optional<UTXO> {
+            const auto& group = find_values(lock, spender, state);
 
-            if (false == owns(spender, data)) { return std::nullopt; }
+            if (group.empty()) {
+                LogTrace(OT_METHOD)(__func__)(
+                    ": No spendable outputs for this group")
+                    .Flush();
 
-            auto output = std::make_optional<UTXO>(outpoint, data);
-            const auto changed = change_state(
-                lock, outpoint, serialized, TxoState::UnconfirmedSpend, blank_);
+                return std::nullopt;
+            }
 
-            OT_ASSERT(changed);
+            // NOTE the largest output minimizes the number of inputs required
+            const auto output = group.crbegin()->second;
 
-            proposal_spent_index_[id].emplace(outpoint);
-            proposal_reverse_index_.emplace(outpoint, id);
-            LogVerbose(OT_METHOD)(__func__)(": Reserving output ")(
-                outpoint.str())
-                .Flush();
+            try {
 
-            return output;
-        };
-        const auto select = [&](const auto& group) -> std::optional<UTXO> {
-            for (const auto& outpoint : group) {
-                auto utxo = choose(outpoint);
+                return reserve(lock, id, output, load_output(lock, output));
+            } catch (const std::exception& e) {
+                LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
 
-                if (utxo.has_value()) { return utxo; }
+                return std::nullopt;
             }
-
-            LogTrace(OT_METHOD)(__func__)(
-                ": No spendable outputs for this group")
-                .Flush();
-
-            return std::nullopt;
         };
 
-        output = select(find_state(lock, TxoState::ConfirmedNew));
+        auto output = select(TxoState::ConfirmedNew);
 
         if (output.has_value()) { return output; }
 
         if (Spend::UnconfirmedToo == policy) {
-            output = select(find_state(lock, TxoState::UnconfirmedNew));
+            output = select(TxoState::UnconfirmedNew);
 
             if (output.has_value()) { return output; }
         }
@@ -601,31 +731,91 @@ struct Output::Imp {
 
         return output;
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& id,
+        const Spend policy,
+        const Selection& selection) noexcept -> std::vector<UTXO>
+    {
+        auto lock = eLock{lock_};
+        auto candidates = Candidates{};
+        auto chosen = Candidates{};
+        const auto attempt = [&](const TxoState state) {
+            add_candidates(lock, spender, state, selection, candidates);
+            chosen = SelectBnB(candidates, selection);
+
+            if (chosen.empty()) {
+                chosen = SelectKnapsack(
+                    candidates, selection, std::random_device{}());
+            }
+
+            return false == chosen.empty();
+        };
+
+        if ((false == attempt(TxoState::ConfirmedNew)) &&
+            (Spend::UnconfirmedToo == policy)) {
+            attempt(TxoState::UnconfirmedNew);
+        }
+
+        if (chosen.empty()) {
+            LogOutput(OT_METHOD)(__func__)(
+                ": Insufficient spendable outputs for specified nym")
+                .Flush();
+
+            return {};
+        }
+
+        const auto ids = [&] {
+            auto out = OutputIDs{};
+            out.reserve(chosen.size());
+
+            for (const auto& [value, output_id] : chosen) {
+                out.emplace_back(output_id);
+            }
+
+            return out;
+        }();
+        // NOTE every output is loaded before any is reserved so a failure
+        // leaves no partial reservation behind
+        auto data = std::vector<proto::BlockchainTransactionOutput>{};
+
+        try {
+            data = load_outputs(lock, ids);
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+            return {};
+        }
+
+        auto output = std::vector<UTXO>{};
+        output.reserve(ids.size());
+
+        for (auto i = std::size_t{0}; i < ids.size(); ++i) {
+            output.emplace_back(
+                reserve(lock, id, ids.at(i), std::move(data.at(i))));
+        }
+
+        return output;
+    }
     auto Rollback(
         const eLock& lock,
         const SubchainID& subchain,
         const block::Position& position) noexcept -> bool
     {
         // TODO rebroadcast transactions which have become unconfirmed
-        const auto outpoints = [&] {
-            auto out = std::vector<Outpoint>{};
+        const auto outputs = [&] {
+            auto out = OutputIDs{};
 
-            try {
-                for (const auto& outpoint : position_index_.at(position)) {
-                    if (belongs_to(lock, outpoint, subchain)) {
-                        insert_sorted(out, outpoint);
-                    }
-                }
-            } catch (...) {
+            for (const auto id : find_position(lock, position)) {
+                if (belongs_to(lock, id, subchain)) { out.emplace_back(id); }
             }
 
             return out;
         }();
 
-        for (const auto& id : outpoints) {
-            auto& serialized = find_output(lock, id);
+        for (const auto id : outputs) {
             const auto state = [&]() -> std::optional<TxoState> {
-                switch (std::get<0>(serialized)) {
+                switch (outputs_.state_.at(id)) {
                     case TxoState::ConfirmedNew:
                     case TxoState::OrphanedNew: {
 
@@ -644,8 +834,7 @@ struct Output::Imp {
             }();
 
             if (state.has_value() &&
-                (!change_state(
-                    lock, id, serialized, state.value(), position))) {
+                (!change_state(lock, id, state.value(), position))) {
                 LogOutput(OT_METHOD)(__func__)(
                     ": Failed to update output state")
                     .Flush();
@@ -653,10 +842,23 @@ struct Output::Imp {
                 return false;
             }
 
-            const auto& txid = api_.Factory().Data(id.Txid());
-            const auto& [opState, opPosition, data] = serialized;
+            const auto& txid =
+                api_.Factory().Data(outputs_.outpoint_.at(id).Txid());
+            const auto data =
+                [&]() -> std::optional<proto::BlockchainTransactionOutput> {
+                try {
+
+                    return load_output(lock, id);
+                } catch (const std::exception& e) {
+                    LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+                    return std::nullopt;
+                }
+            }();
+
+            if (false == data.has_value()) { return false; }
 
-            for (const auto& sKey : data.key()) {
+            for (const auto& sKey : data->key()) {
                 using Subchain = blockchain::crypto::Subchain;
                 blockchain_.Unconfirm(
                     {sKey.subaccount(),
@@ -674,17 +876,19 @@ struct Output::Imp {
             }
         }
 
-        return true;
+        return write(lock);
     }
 
     Imp(const api::Core& api,
         const api::client::internal::Blockchain& blockchain,
+        const storage::lmdb::LMDB& lmdb,
         const blockchain::Type chain,
         const wallet::SubchainData& subchains,
         wallet::Proposal& proposals,
         wallet::Transaction& transactions) noexcept
         : api_(api)
         , blockchain_(blockchain)
+        , lmdb_(lmdb)
         , chain_(chain)
         , subchains_(subchains)
         , proposals_(proposals)
@@ -698,14 +902,24 @@ struct Output::Imp {
         }())
         , lock_()
         , outputs_()
+        , output_ids_()
+        , positions_()
         , account_index_()
         , nym_index_()
         , position_index_()
         , proposal_created_index_()
         , proposal_spent_index_()
         , proposal_reverse_index_()
+        , reserved_()
         , state_index_()
         , subchain_index_()
+        , value_index_()
+        , totals_()
+        , account_totals_()
+        , nym_totals_()
+        , changed_nyms_()
+        , pending_()
+        , next_entry_(0)
     {
     }
 
@@ -715,57 +929,99 @@ private:
     using Outpoint = block::Outpoint;
     using Outpoints = std::set<Outpoint>;
     using TxoState = node::Wallet::TxoState;
-    using Output = std::
-        tuple<TxoState, block::Position, proto::BlockchainTransactionOutput>;
-    using OutputMap =
-        robin_hood::unordered_flat_map<Outpoint, std::unique_ptr<Output>>;
-    using AccountIndex = std::map<OTIdentifier, Outpoints>;
-    using NymIndex = std::map<OTNymID, Outpoints>;
-    using PositionIndex = std::map<block::Position, Outpoints>;
+    // NOTE outputs are numbered densely in the order they are created
+    using OutputID = std::uint32_t;
+    // NOTE kept sorted so indices can be searched and intersected directly
+    using OutputIDs = std::vector<OutputID>;
+    using PositionID = std::uint32_t;
+    using OutputMap = robin_hood::unordered_flat_map<Outpoint, OutputID>;
+    using AccountIndex = std::map<OTIdentifier, OutputIDs>;
+    using NymIndex = std::map<OTNymID, OutputIDs>;
+    using PositionIndex = std::vector<OutputIDs>;
     using ProposalIndex = std::map<OTIdentifier, Outpoints>;
     using ProposalReverseIndex = std::map<Outpoint, OTIdentifier>;
-    using StateIndex = std::map<TxoState, Outpoints>;
+    // NOTE the state of each reserved output before it was reserved.
+    // Proposals do not survive a restart so the journal only ever records
+    // this state for outputs which have not been seen in a transaction.
+    using Reservations = std::map<OutputID, TxoState>;
+    // NOTE outputs move between states constantly so these are kept in trees
+    // rather than sorted vectors
+    using StateIndex = std::map<TxoState, std::set<OutputID>>;
     using SubchainIndex =
-        robin_hood::unordered_flat_map<pSubchainID, Outpoints>;
-    using NymBalances = std::map<OTNymID, Balance>;
+        robin_hood::unordered_flat_map<pSubchainID, OutputIDs>;
+    // NOTE running sums of output values for each state
+    using Totals = std::map<TxoState, Amount>;
+    // NOTE keyed by owner and account since outputs of an account are not
+    // all associated with its owner
+    using AccountTotals =
+        std::map<std::pair<OTNymID, OTIdentifier>, Totals>;
+    using NymTotals = std::map<OTNymID, Totals>;
     using KeyID = blockchain::crypto::Key;
     using States = std::vector<TxoState>;
-    using Matches = std::vector<Outpoint>;
+    // NOTE sorted by value so the largest outputs can be found directly
+    using Values = std::set<std::pair<Amount, OutputID>>;
+    using ValueIndex = std::map<OTNymID, std::map<TxoState, Values>>;
+
+    // Each field is indexed by OutputID. The serialized output is only needed
+    // when an output is returned to a caller so it is loaded from the
+    // database on demand instead of being kept in memory.
+    struct Outputs {
+        std::vector<Outpoint> outpoint_{};
+        std::vector<Amount> value_{};
+        std::vector<TxoState> state_{};
+        std::vector<PositionID> position_{};
+        // NOTE owners of each output so a state change only visits the
+        // totals which contain it
+        std::vector<std::vector<OTIdentifier>> accounts_{};
+        std::vector<std::vector<OTNymID>> nyms_{};
+    };
+    // Block positions are shared by many outputs so each one is stored once
+    struct Positions {
+        std::vector<block::Position> list_{};
+        std::map<block::Position, PositionID> ids_{};
+    };
+    // Database records created since the last write. Every state transition
+    // is appended to the journal as an outpoint, state, and position.
+    struct Pending {
+        std::vector<std::pair<Space, Space>> outputs_{};
+        std::vector<std::pair<Space, Space>> owners_{};
+        std::vector<Space> journal_{};
+    };
+    enum class Owner : std::uint8_t {
+        Account = 0,
+        Subchain = 1,
+        Nym = 2,
+    };
 
     const api::Core& api_;
     const api::client::internal::Blockchain& blockchain_;
+    const storage::lmdb::LMDB& lmdb_;
     const blockchain::Type chain_;
     const wallet::SubchainData& subchains_;
     wallet::Proposal& proposals_;
     wallet::Transaction& transactions_;
     const block::Position blank_;
     mutable std::shared_mutex lock_;
-    OutputMap outputs_;
+    Outputs outputs_;
+    OutputMap output_ids_;
+    Positions positions_;
     AccountIndex account_index_;
     NymIndex nym_index_;
     PositionIndex position_index_;
     ProposalIndex proposal_created_index_;
     ProposalIndex proposal_spent_index_;
     ProposalReverseIndex proposal_reverse_index_;
+    Reservations reserved_;
     StateIndex state_index_;
     SubchainIndex subchain_index_;
+    ValueIndex value_index_;
+    Totals totals_;
+    AccountTotals account_totals_;
+    NymTotals nym_totals_;
+    std::set<OTNymID> changed_nyms_;
+    Pending pending_;
+    std::size_t next_entry_;
 
-    static auto owns(
-        const identifier::Nym& spender,
-        const proto::BlockchainTransactionOutput& output) noexcept -> bool
-    {
-        const auto id = spender.str();
-
-        for (const auto& key : output.key()) {
-            if (key.nym() == id) { return true; }
-        }
-
-        if (0 == output.key_size()) {
-            LogOutput(OT_METHOD)(__func__)(": No keys").Flush();
-        }
-
-        return false;
-    }
     static auto states(TxoState in) noexcept -> States
     {
         static const auto all = States{
@@ -781,23 +1037,72 @@ private:
 
         return States{in};
     }
+    static auto total(const Totals& totals, const TxoState state) noexcept
+        -> Amount
+    {
+        const auto it = totals.find(state);
 
-    auto belongs_to(
-        const eLock& lock,
-        const Outpoint& id,
-        const SubchainID& subchain) const noexcept -> bool
+        if (totals.end() == it) { return 0; }
+
+        return it->second;
+    }
+    template <typename T>
+    static auto index_add(std::vector<T>& index, const T& value) noexcept
+        -> bool
     {
-        const auto it1 = subchain_index_.find(subchain);
+        const auto it = std::lower_bound(index.begin(), index.end(), value);
 
-        if (subchain_index_.cend() == it1) { return false; }
+        if ((index.end() != it) && (*it == value)) { return false; }
 
-        const auto& vector = it1->second;
+        index.insert(it, value);
 
-        for (const auto& outpoint : vector) {
-            if (id == outpoint) { return true; }
-        }
+        return true;
+    }
+    template <typename T>
+    static auto index_add(std::set<T>& index, const T& value) noexcept -> bool
+    {
+        return index.emplace(value).second;
+    }
+    template <typename T>
+    static auto index_contains(
+        const std::vector<T>& index,
+        const T& value) noexcept -> bool
+    {
+        return std::binary_search(index.begin(), index.end(), value);
+    }
+    template <typename T>
+    static auto index_remove(std::vector<T>& index, const T& value) noexcept
+        -> bool
+    {
+        const auto it = std::lower_bound(index.begin(), index.end(), value);
 
-        return false;
+        if ((index.end() == it) || (*it != value)) { return false; }
+
+        index.erase(it);
+
+        return true;
+    }
+    template <typename T>
+    static auto index_remove(std::set<T>& index, const T& value) noexcept
+        -> bool
+    {
+        return 0 < index.erase(value);
+    }
+
+    auto belongs_to(
+        const eLock& lock,
+        const OutputID id,
+        const SubchainID& subchain) const noexcept -> bool
+    {
+        return index_contains(find_subchain(lock, subchain), id);
+    }
+    template <typename LockType>
+    auto need_compaction(const LockType& lock) const noexcept -> bool
+    {
+        const auto count = outputs_.outpoint_.size();
+
+        return (OT_WALLET_JOURNAL_COMPACT_THRESHOLD < next_entry_) &&
+               ((2u * count) < next_entry_);
     }
     auto effective_position(
         const TxoState state,
@@ -818,9 +1123,9 @@ private:
     }
     template <typename LockType>
     auto find_account(const LockType& lock, const AccountID& id) const noexcept
-        -> const Outpoints&
+        -> const OutputIDs&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = OutputIDs{};
 
         try {
 
@@ -832,9 +1137,9 @@ private:
     }
     template <typename LockType>
     auto find_nym(const LockType& lock, const identifier::Nym& id)
-        const noexcept -> const Outpoints&
+        const noexcept -> const OutputIDs&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = OutputIDs{};
 
         try {
 
@@ -846,15 +1151,26 @@ private:
     }
     template <typename LockType>
     auto find_output(const LockType& lock, const Outpoint& id) const
-        noexcept(false) -> const Output&
+        noexcept(false) -> OutputID
     {
-        return *outputs_.at(id);
+        return output_ids_.at(id);
+    }
+    template <typename LockType>
+    auto find_position(const LockType& lock, const block::Position& position)
+        const noexcept -> const OutputIDs&
+    {
+        static const auto empty = OutputIDs{};
+        const auto it = positions_.ids_.find(position);
+
+        if (positions_.ids_.end() == it) { return empty; }
+
+        return position_index_.at(it->second);
     }
     template <typename LockType>
     auto find_state(const LockType& lock, TxoState state) const noexcept
-        -> const Outpoints&
+        -> const StateIndex::mapped_type&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = StateIndex::mapped_type{};
 
         try {
 
@@ -866,9 +1182,9 @@ private:
     }
     template <typename LockType>
     auto find_subchain(const LockType& lock, const NodeID& id) const noexcept
-        -> const Outpoints&
+        -> const OutputIDs&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = OutputIDs{};
 
         try {
 
@@ -879,6 +1195,22 @@ private:
         }
     }
     template <typename LockType>
+    auto find_values(
+        const LockType& lock,
+        const identifier::Nym& id,
+        const TxoState state) const noexcept -> const Values&
+    {
+        static const auto empty = Values{};
+
+        try {
+
+            return value_index_.at(id).at(state);
+        } catch (...) {
+
+            return empty;
+        }
+    }
+    template <typename LockType>
     auto get_balance(const LockType& lock) const noexcept -> Balance
     {
         static const auto blank = api_.Factory().NymID();
@@ -899,51 +1231,29 @@ private:
         const identifier::Nym& owner,
         const AccountID& account) const noexcept -> Balance
     {
+        static const auto empty = Totals{};
         auto output = Balance{};
         auto& [confirmed, unconfirmed] = output;
-        const auto* pNym = owner.empty() ? nullptr : &owner;
-        const auto* pAcct = account.empty() ? nullptr : &account;
-        auto cb = [&](const auto previous, const auto& outpoint) -> auto
-        {
-            const auto& [state, position, data] = find_output(lock, outpoint);
+        const auto& totals = [&]() -> const Totals& {
+            if (false == account.empty()) {
+                const auto it = account_totals_.find({owner, account});
 
-            return previous + data.value();
-        };
+                return (account_totals_.end() == it) ? empty : it->second;
+            } else if (false == owner.empty()) {
+                const auto it = nym_totals_.find(owner);
 
-        const auto unconfirmedSpendTotal = [&] {
-            const auto txos =
-                match(lock, {TxoState::UnconfirmedSpend}, pNym, pAcct, nullptr);
+                return (nym_totals_.end() == it) ? empty : it->second;
+            } else {
 
-            return std::accumulate(
-                txos.begin(), txos.end(), std::uint64_t{0}, cb);
+                return totals_;
+            }
         }();
-
-        {
-            const auto txos =
-                match(lock, {TxoState::ConfirmedNew}, pNym, pAcct, nullptr);
-            confirmed =
-                unconfirmedSpendTotal +
-                std::accumulate(txos.begin(), txos.end(), std::uint64_t{0}, cb);
-        }
-
-        {
-            const auto txos =
-                match(lock, {TxoState::UnconfirmedNew}, pNym, pAcct, nullptr);
-            unconfirmed =
-                std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
-                unconfirmedSpendTotal;
-        }
-
-        return output;
-    }
-    template <typename LockType>
-    auto get_balances(const LockType& lock) const noexcept -> NymBalances
-    {
-        auto output = NymBalances{};
-
-        for (const auto& [nym, outpoints] : nym_index_) {
-            output[nym] = get_balance(lock, nym);
-        }
+        const auto unconfirmedSpendTotal =
+            total(totals, TxoState::UnconfirmedSpend);
+        confirmed =
+            unconfirmedSpendTotal + total(totals, TxoState::ConfirmedNew);
+        unconfirmed = confirmed + total(totals, TxoState::UnconfirmedNew) -
+                      unconfirmedSpendTotal;
 
         return output;
     }
@@ -956,10 +1266,20 @@ private:
     {
         const auto matches = match(lock, states, owner, account, subchain);
         auto output = std::vector<UTXO>{};
+        output.reserve(matches.size());
+
+        try {
+            auto data = load_outputs(lock, matches);
 
-        for (const auto& outpoint : matches) {
-            const auto& [state, position, data] = find_output(lock, outpoint);
-            output.emplace_back(outpoint, data);
+            for (auto i = std::size_t{0}; i < matches.size(); ++i) {
+                output.emplace_back(
+                    outputs_.outpoint_.at(matches.at(i)),
+                    std::move(data.at(i)));
+            }
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+            return {};
         }
 
         return output;
@@ -979,28 +1299,63 @@ private:
             pSub);
     }
     template <typename LockType>
-    auto has_account(
-        const LockType& lock,
-        const AccountID& id,
-        const Outpoint& outpoint) const noexcept -> bool
+    auto load_output(const LockType& lock, const OutputID id) const
+        noexcept(false) -> proto::BlockchainTransactionOutput
     {
-        return 0 < find_account<LockType>(lock, id).count(outpoint);
+        return std::move(load_outputs(lock, OutputIDs{id}).at(0));
     }
+    // NOTE records created by the current operation may not have been
+    // written yet
     template <typename LockType>
-    auto has_nym(
-        const LockType& lock,
-        const identifier::Nym& id,
-        const Outpoint& outpoint) const noexcept -> bool
+    auto load_outputs(const LockType& lock, const OutputIDs& ids) const
+        noexcept(false) -> std::vector<proto::BlockchainTransactionOutput>
     {
-        return 0 < find_nym<LockType>(lock, id).count(outpoint);
-    }
-    template <typename LockType>
-    auto has_subchain(
-        const LockType& lock,
-        const NodeID& id,
-        const Outpoint& outpoint) const noexcept -> bool
-    {
-        return 0 < find_subchain<LockType>(lock, id).count(outpoint);
+        auto output = std::vector<proto::BlockchainTransactionOutput>{};
+        output.resize(ids.size());
+        auto found = std::vector<bool>(ids.size(), false);
+        auto keys = std::vector<ReadView>{};
+        auto positions = std::vector<std::size_t>{};
+        const auto parse = [&](const std::size_t i, const ReadView bytes) {
+            output.at(i) = proto::Factory<proto::BlockchainTransactionOutput>(
+                bytes.data(), bytes.size());
+            found.at(i) = true;
+        };
+        const auto& pending = pending_.outputs_;
+
+        for (auto i = std::size_t{0}; i < ids.size(); ++i) {
+            const auto key = outputs_.outpoint_.at(ids.at(i)).Bytes();
+            const auto it = std::find_if(
+                pending.begin(), pending.end(), [&](const auto& record) {
+                    return key == reader(record.first);
+                });
+
+            if (pending.end() == it) {
+                keys.emplace_back(key);
+                positions.emplace_back(i);
+            } else {
+                parse(i, reader(it->second));
+            }
+        }
+
+        if (false == keys.empty()) {
+            lmdb_.Load(
+                database::WalletOutputs,
+                keys,
+                [&](const auto index, const auto bytes) {
+                    parse(positions.at(index), bytes);
+
+                    return true;
+                });
+        }
+
+        for (auto i = std::size_t{0}; i < ids.size(); ++i) {
+            if (false == found.at(i)) {
+                throw std::out_of_range{
+                    "Missing output " + outputs_.outpoint_.at(ids.at(i)).str()};
+            }
+        }
+
+        return output;
     }
     template <typename LockType>
     auto match(
@@ -1008,46 +1363,76 @@ private:
         const States states,
         const identifier::Nym* owner,
         const AccountID* account,
-        const NodeID* subchain) const noexcept -> Matches
+        const NodeID* subchain) const noexcept -> OutputIDs
     {
-        auto output = Matches{};
-        const auto allSubs = (nullptr == subchain);
-        const auto allAccts = (nullptr == account);
-        const auto allNyms = (nullptr == owner);
+        auto output = OutputIDs{};
+        // NOTE if a more specific conditions is requested then it's not
+        // necessary to test any more general conditions. A subchain match
+        // implies an account match implies a nym match
+        const auto* filter = [&]() -> const OutputIDs* {
+            if (nullptr != subchain) {
+
+                return &find_subchain(lock, *subchain);
+            } else if (nullptr != account) {
+
+                return &find_account(lock, *account);
+            } else if (nullptr != owner) {
+
+                return &find_nym(lock, *owner);
+            } else {
+
+                return nullptr;
+            }
+        }();
 
         for (const auto state : states) {
-            for (const auto& outpoint : find_state(lock, state)) {
-                // NOTE if a more specific conditions is requested then it's
-                // not necessary to test any more general conditions. A subchain
-                // match implies an account match implies a nym match
-                const auto goodSub =
-                    allSubs || has_subchain(lock, *subchain, outpoint);
-                const auto goodAcct = (!allSubs) || allAccts ||
-                                      has_account(lock, *account, outpoint);
-                const auto goodNym = (!allSubs) || (!allAccts) || allNyms ||
-                                     has_nym(lock, *owner, outpoint);
-
-                if (goodNym && goodAcct && goodSub) {
-                    output.emplace_back(outpoint);
-                }
+            const auto& ids = find_state(lock, state);
+
+            if (nullptr == filter) {
+                std::copy(ids.begin(), ids.end(), std::back_inserter(output));
+            } else {
+                std::set_intersection(
+                    ids.begin(),
+                    ids.end(),
+                    filter->begin(),
+                    filter->end(),
+                    std::back_inserter(output));
             }
         }
 
         return output;
     }
     template <typename LockType>
-    auto print(const LockType&) const noexcept -> void
+    auto print(const LockType& lock) const noexcept -> void
     {
         struct Output {
             std::stringstream text_{};
             std::size_t total_{};
         };
         auto output = std::map<TxoState, Output>{};
+        const auto all = [&] {
+            auto out = OutputIDs(outputs_.outpoint_.size());
+            std::iota(out.begin(), out.end(), OutputID{0});
+
+            return out;
+        }();
+        const auto data = [&] {
+            try {
+
+                return load_outputs(lock, all);
+            } catch (const std::exception& e) {
+                LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+                return std::vector<proto::BlockchainTransactionOutput>{};
+            }
+        }();
+
+        if (data.size() != all.size()) { return; }
 
-        for (const auto& data : outputs_) {
-            const auto& outpoint = data.first;
-            const auto& [state, position, proto] = *data.second;
-            auto& out = output[state];
+        for (const auto id : all) {
+            const auto& outpoint = outputs_.outpoint_.at(id);
+            const auto& proto = data.at(id);
+            auto& out = output[outputs_.state_.at(id)];
             out.text_ << "\n * " << outpoint.str() << ' ';
             out.text_ << " value: " << std::to_string(proto.value());
             out.total_ += proto.value();
@@ -1101,6 +1486,61 @@ private:
             .Flush();
     }
 
+    auto add_account(
+        const eLock& lock,
+        const OutputID id,
+        const AccountID& account) noexcept -> bool
+    {
+        if (false == index_add(account_index_[account], id)) { return false; }
+
+        const auto state = outputs_.state_.at(id);
+        const auto value = outputs_.value_.at(id);
+        outputs_.accounts_.at(id).emplace_back(account);
+
+        for (const auto& nym : outputs_.nyms_.at(id)) {
+            account_totals_[{nym, account}][state] += value;
+        }
+
+        return true;
+    }
+    auto add_candidates(
+        const eLock& lock,
+        const identifier::Nym& spender,
+        const TxoState state,
+        const Selection& selection,
+        Candidates& candidates) const noexcept -> void
+    {
+        for (const auto& [value, id] : find_values(lock, spender, state)) {
+            // NOTE outputs worth less than the fee to spend them are ignored
+            if (value <= selection.input_fee_) { continue; }
+
+            candidates.emplace_back(value - selection.input_fee_, id);
+        }
+
+        std::sort(
+            candidates.begin(),
+            candidates.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs > rhs; });
+    }
+    auto add_nym(
+        const eLock& lock,
+        const OutputID id,
+        const identifier::Nym& nym) noexcept -> bool
+    {
+        if (false == index_add(nym_index_[nym], id)) { return false; }
+
+        const auto state = outputs_.state_.at(id);
+        const auto value = outputs_.value_.at(id);
+        index_add(value_index_[nym][state], std::make_pair(value, id));
+        nym_totals_[nym][state] += value;
+        outputs_.nyms_.at(id).emplace_back(nym);
+
+        for (const auto& account : outputs_.accounts_.at(id)) {
+            account_totals_[{nym, account}][state] += value;
+        }
+
+        return true;
+    }
     auto associate(
         const eLock& lock,
         const Outpoint& outpoint,
@@ -1121,8 +1561,23 @@ private:
         OT_ASSERT(false == accountID.empty());
         OT_ASSERT(false == subchainID.empty());
 
-        account_index_[accountID].emplace(outpoint);
-        subchain_index_[subchainID].emplace(outpoint);
+        try {
+            const auto id = find_output(lock, outpoint);
+
+            if (index_add(subchain_index_[subchainID], id)) {
+                owner(lock, outpoint, Owner::Subchain, subchainID.Bytes());
+            }
+
+            if (add_account(lock, id, accountID)) {
+                owner(lock, outpoint, Owner::Account, accountID.Bytes());
+            }
+        } catch (...) {
+            LogOutput(OT_METHOD)(__func__)(": outpoint ")(outpoint.str())(
+                " does not exist")
+                .Flush();
+
+            return false;
+        }
 
         return true;
     }
@@ -1133,32 +1588,45 @@ private:
     {
         OT_ASSERT(false == nymID.empty());
 
-        nym_index_[nymID].emplace(outpoint);
+        try {
+            const auto id = find_output(lock, outpoint);
+
+            if (add_nym(lock, id, nymID)) {
+                changed_nyms_.emplace(nymID);
+                owner(lock, outpoint, Owner::Nym, nymID.Bytes());
+            }
+        } catch (...) {
+            LogOutput(OT_METHOD)(__func__)(": outpoint ")(outpoint.str())(
+                " does not exist")
+                .Flush();
+
+            return false;
+        }
 
         return true;
     }
     // Only used by CancelProposal
     auto change_state(
         const eLock& lock,
-        const Outpoint& id,
+        const Outpoint& outpoint,
         const TxoState oldState,
-        const TxoState newState) noexcept -> bool
+        const TxoState newState,
+        const bool persist) noexcept -> bool
     {
         try {
-            auto& serialized = find_output(lock, id);
-            const auto& [state, position, data] = serialized;
+            const auto id = find_output(lock, outpoint);
 
-            if (state != oldState) {
+            if (outputs_.state_.at(id) != oldState) {
                 LogOutput(OT_METHOD)(__func__)(
-                    ": incorrect state for outpoint ")(id.str())
+                    ": incorrect state for outpoint ")(outpoint.str())
                     .Flush();
 
                 return false;
             }
 
-            return change_state(lock, id, serialized, newState, blank_);
+            return change_state(lock, id, newState, blank_, persist);
         } catch (...) {
-            LogOutput(OT_METHOD)(__func__)(": outpoint ")(id.str())(
+            LogOutput(OT_METHOD)(__func__)(": outpoint ")(outpoint.str())(
                 " does not exist")
                 .Flush();
 
@@ -1167,16 +1635,16 @@ private:
     }
     auto change_state(
         const eLock& lock,
-        const Outpoint& id,
+        const Outpoint& outpoint,
         const TxoState newState,
         const block::Position newPosition) noexcept -> bool
     {
         try {
-            auto& serialized = find_output(lock, id);
 
-            return change_state(lock, id, serialized, newState, newPosition);
+            return change_state(
+                lock, find_output(lock, outpoint), newState, newPosition);
         } catch (...) {
-            LogOutput(OT_METHOD)(__func__)(": outpoint ")(id.str())(
+            LogOutput(OT_METHOD)(__func__)(": outpoint ")(outpoint.str())(
                 " does not exist")
                 .Flush();
 
@@ -1185,29 +1653,57 @@ private:
     }
     auto change_state(
         const eLock& lock,
-        const Outpoint& id,
-        Output& serialized,
+        const OutputID id,
         const TxoState newState,
-        const block::Position newPosition) noexcept -> bool
+        const block::Position& newPosition,
+        const bool persist = true) noexcept -> bool
     {
-        auto& [oldState, oldPosition, data] = serialized;
-        const auto effective =
-            effective_position(newState, oldPosition, newPosition);
+        // NOTE a persisted change to a reserved output means it was seen in a
+        // transaction, so the output is no longer only reserved
+        auto changed{persist && (0 < reserved_.erase(id))};
+        auto& oldState = outputs_.state_.at(id);
+        auto& oldPosition = outputs_.position_.at(id);
+        // NOTE copied since interning a new position may reallocate the list
+        const auto effective = block::Position{effective_position(
+            newState, positions_.list_.at(oldPosition), newPosition)};
 
         if (newState != oldState) {
-            auto& from = state_index_[oldState];
-            auto& to = state_index_[newState];
-            to.insert(from.extract(id));
+            index_remove(state_index_[oldState], id);
+            index_add(state_index_[newState], id);
+            const auto value = outputs_.value_.at(id);
+            const auto key = std::make_pair(value, id);
+            const auto move = [&](auto& totals) {
+                totals[oldState] -= value;
+                totals[newState] += value;
+            };
+            move(totals_);
+
+            for (const auto& nym : outputs_.nyms_.at(id)) {
+                auto& values = value_index_[nym];
+                index_remove(values[oldState], key);
+                index_add(values[newState], key);
+                move(nym_totals_[nym]);
+                changed_nyms_.emplace(nym);
+
+                for (const auto& account : outputs_.accounts_.at(id)) {
+                    move(account_totals_[{nym, account}]);
+                }
+            }
+
             oldState = newState;
+            changed = true;
         }
 
-        if (effective != oldPosition) {
-            auto& from = position_index_[oldPosition];
-            auto& to = position_index_[effective];
-            to.insert(from.extract(id));
-            oldPosition = effective;
+        if (effective != positions_.list_.at(oldPosition)) {
+            const auto position = intern(effective);
+            index_remove(position_index_.at(oldPosition), id);
+            index_add(position_index_.at(position), id);
+            oldPosition = position;
+            changed = true;
         }
 
+        if (changed && persist) { journal(lock, id); }
+
         return true;
     }
     auto check_proposals(
@@ -1260,60 +1756,257 @@ private:
     }
     auto create_state(
         const eLock& lock,
-        const Outpoint& id,
+        const Outpoint& outpoint,
         const TxoState state,
         const block::Position position,
         const block::bitcoin::Output& output) noexcept -> bool
     {
-        if (0 < outputs_.count(id)) {
+        if (0 < output_ids_.count(outpoint)) {
             LogOutput(OT_METHOD)(__func__)(": Outpoint already exists in db")
                 .Flush();
 
             return false;
         }
 
-        const auto& effective = effective_position(state, blank_, position);
+        if (std::numeric_limits<OutputID>::max() <=
+            outputs_.outpoint_.size()) {
+            LogOutput(OT_METHOD)(__func__)(": Too many outputs").Flush();
 
-        {
-            auto data = block::bitcoin::Output::SerializeType{};
+            return false;
+        }
 
-            if (false == output.Serialize(blockchain_, data)) {
-                LogOutput(OT_METHOD)(__func__)(": Failed to serialize output")
-                    .Flush();
+        auto data = block::bitcoin::Output::SerializeType{};
 
-                return false;
+        if (false == output.Serialize(blockchain_, data)) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to serialize output")
+                .Flush();
+
+            return false;
+        }
+
+        OT_ASSERT(proto::Validate(data, VERBOSE));
+
+        pending_.outputs_.emplace_back(
+            space(outpoint.Bytes()), space(proto::ToString(data)));
+        const auto id = add_output(
+            lock,
+            outpoint,
+            state,
+            effective_position(state, blank_, position),
+            Amount{data.value()});
+        journal(lock, id);
+
+        return true;
+    }
+    auto compact(const eLock& lock) noexcept -> void
+    {
+        try {
+            auto tx = lmdb_.TransactionRW();
+
+            if (false == lmdb_.Delete(database::WalletOutputJournal, tx)) {
+                throw std::runtime_error{"Failed to clear journal"};
             }
 
-            OT_ASSERT(proto::Validate(data, VERBOSE));
+            auto next = std::size_t{0};
+
+            for (auto id = OutputID{0}; id < outputs_.outpoint_.size(); ++id) {
+                const auto stored = lmdb_.Store(
+                    database::WalletOutputJournal,
+                    next++,
+                    reader(entry(lock, id)),
+                    tx);
+
+                if (false == stored.first) {
+                    throw std::runtime_error{"Failed to write journal"};
+                }
+            }
 
-            outputs_.emplace(
-                std::piecewise_construct,
-                std::forward_as_tuple(id),
-                std::forward_as_tuple(std::make_unique<Output>(
-                    state, effective, std::move(data))));
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{"Failed to commit journal"};
+            }
+
+            next_entry_ = next;
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
         }
+    }
+    auto entry(const eLock& lock, const OutputID id) const noexcept -> Space
+    {
+        const auto outpoint = outputs_.outpoint_.at(id).Bytes();
+        const auto position = blockchain::internal::Serialize(
+            positions_.list_.at(outputs_.position_.at(id)));
+        auto output = space(outpoint.size() + 1u + position.size());
+        auto it = output.data();
+        std::memcpy(it, outpoint.data(), outpoint.size());
+        std::advance(it, outpoint.size());
+        *it = static_cast<std::byte>([&] {
+            const auto reserved = reserved_.find(id);
+
+            if (reserved_.end() == reserved) { return outputs_.state_.at(id); }
+
+            return reserved->second;
+        }());
+        std::advance(it, 1);
+        std::memcpy(it, position.data(), position.size());
+
+        return output;
+    }
+    auto add_output(
+        const eLock& lock,
+        const Outpoint& outpoint,
+        const TxoState state,
+        const block::Position& position,
+        const Amount value) noexcept -> OutputID
+    {
+        const auto id = static_cast<OutputID>(outputs_.outpoint_.size());
+        const auto effective = intern(position);
+        outputs_.outpoint_.emplace_back(outpoint);
+        outputs_.value_.emplace_back(value);
+        outputs_.state_.emplace_back(state);
+        outputs_.position_.emplace_back(effective);
+        outputs_.accounts_.emplace_back();
+        outputs_.nyms_.emplace_back();
+        output_ids_.emplace(outpoint, id);
+        // NOTE ids are assigned in increasing order so these are appends
+        state_index_[state].emplace_hint(state_index_[state].end(), id);
+        index_add(position_index_.at(effective), id);
+        totals_[state] += value;
+
+        return id;
+    }
+    auto intern(const block::Position& position) noexcept -> PositionID
+    {
+        auto& [list, ids] = positions_;
 
-        state_index_[state].emplace(id);
-        position_index_[effective].emplace(id);
+        if (const auto it = ids.find(position); ids.end() != it) {
 
-        return true;
+            return it->second;
+        }
+
+        const auto id = static_cast<PositionID>(list.size());
+        list.emplace_back(position);
+        ids.emplace(position, id);
+        position_index_.emplace_back();
+
+        return id;
+    }
+    auto journal(const eLock& lock, const OutputID id) noexcept -> void
+    {
+        pending_.journal_.emplace_back(entry(lock, id));
+    }
+    auto owner(
+        const eLock& lock,
+        const Outpoint& outpoint,
+        const Owner type,
+        const ReadView id) noexcept -> void
+    {
+        auto value = space(1u + id.size());
+        value.at(0) = static_cast<std::byte>(type);
+        std::memcpy(std::next(value.data()), id.data(), id.size());
+        pending_.owners_.emplace_back(
+            space(outpoint.Bytes()), std::move(value));
     }
-    auto find_output(const eLock& lock, const Outpoint& id) noexcept(false)
-        -> Output&
+    auto publish_balances(const eLock& lock) noexcept -> void
     {
-        return *outputs_.at(id);
+        blockchain_.UpdateBalance(chain_, get_balance(lock));
+
+        for (const auto& nym : changed_nyms_) {
+            blockchain_.UpdateBalance(nym, chain_, get_balance(lock, nym));
+        }
+
+        changed_nyms_.clear();
+    }
+    auto reserve(
+        const eLock& lock,
+        const Identifier& proposal,
+        const OutputID id,
+        proto::BlockchainTransactionOutput&& data) noexcept -> UTXO
+    {
+        const auto& outpoint = outputs_.outpoint_.at(id);
+        auto output = UTXO{outpoint, std::move(data)};
+        reserved_.emplace(id, outputs_.state_.at(id));
+        // NOTE reservations are not persisted since proposals are not
+        const auto changed =
+            change_state(lock, id, TxoState::UnconfirmedSpend, blank_, false);
+
+        OT_ASSERT(changed);
+
+        proposal_spent_index_[proposal].emplace(outpoint);
+        proposal_reverse_index_.emplace(outpoint, proposal);
+        LogVerbose(OT_METHOD)(__func__)(": Reserving output ")(outpoint.str())
+            .Flush();
+
+        return output;
+    }
+    auto write(const eLock& lock) noexcept -> bool
+    {
+        auto& [outputs, owners, journal] = pending_;
+
+        if (outputs.empty() && owners.empty() && journal.empty()) {
+            return true;
+        }
+
+        try {
+            auto tx = lmdb_.TransactionRW();
+            const auto store = [&](const auto table, const auto& records) {
+                for (const auto& [key, value] : records) {
+                    const auto stored =
+                        lmdb_.Store(table, reader(key), reader(value), tx);
+
+                    if (false == stored.first) {
+                        throw std::runtime_error{"Failed to store record"};
+                    }
+                }
+            };
+            store(database::WalletOutputs, outputs);
+            store(database::WalletOutputOwners, owners);
+            auto next = next_entry_;
+
+            for (const auto& record : journal) {
+                const auto stored = lmdb_.Store(
+                    database::WalletOutputJournal, next++, reader(record), tx);
+
+                if (false == stored.first) {
+                    throw std::runtime_error{"Failed to append to journal"};
+                }
+            }
+
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{"Failed to commit transaction"};
+            }
+
+            next_entry_ = next;
+            outputs.clear();
+            owners.clear();
+            journal.clear();
+
+            if (need_compaction(lock)) { compact(lock); }
+
+            return true;
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+            return false;
+        }
     }
 };
 
 Output::Output(
     const api::Core& api,
     const api::client::internal::Blockchain& blockchain,
+    const storage::lmdb::LMDB& lmdb,
     const blockchain::Type chain,
     const wallet::SubchainData& subchains,
     wallet::Proposal& proposals,
     wallet::Transaction& transactions) noexcept
-    : imp_(std::make_unique<
-           Imp>(api, blockchain, chain, subchains, proposals, transactions))
+    : imp_(std::make_unique<Imp>(
+          api,
+          blockchain,
+          lmdb,
+          chain,
+          subchains,
+          proposals,
+          transactions))
 {
     OT_ASSERT(imp_);
 }
@@ -1404,6 +2097,11 @@ auto Output::GetUnspentOutputs(const NodeID& balanceNode) const noexcept
     return imp_->GetUnspentOutputs(balanceNode);
 }
 
+auto Output::Load() noexcept -> std::optional<block::Height>
+{
+    return imp_->Load();
+}
+
 auto Output::ReserveUTXO(
     const identifier::Nym& spender,
     const Identifier& proposal,
@@ -1412,6 +2110,15 @@ auto Output::ReserveUTXO(
     return imp_->ReserveUTXO(spender, proposal, policy);
 }
 
+auto Output::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& proposal,
+    const Spend policy,
+    const Selection& selection) noexcept -> std::vector<UTXO>
+{
+    return imp_->ReserveUTXOs(spender, proposal, policy, selection);
+}
+
 auto Output::Rollback(
     const eLock& lock,
     const SubchainID& subchain,
@@ -68,6 +68,14 @@ namespace proto
 class BlockchainTransactionProposal;
 }  // namespace proto
 
+namespace storage
+{
+namespace lmdb
+{
+class LMDB;
+}  // namespace lmdb
+}  // namespace storage
+
 class Identifier;
 }  // namespace opentxs
 
@@ -84,6 +92,7 @@ public:
     using FilterType = Parent::FilterType;
     using UTXO = Parent::UTXO;
     using Spend = Parent::Spend;
+    using Selection = Parent::Selection;
     using State = node::Wallet::TxoState;
 
     auto CancelProposal(const Identifier& id) noexcept -> bool;
@@ -119,10 +128,16 @@ public:
         const Identifier& proposalID,
         const proto::BlockchainTransactionProposal& proposal,
         const block::bitcoin::Transaction& transaction) noexcept -> bool;
+    auto Load() noexcept -> std::optional<block::Height>;
     auto ReserveUTXO(
         const identifier::Nym& spender,
         const Identifier& proposal,
         const Spend policy) noexcept -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const Selection& selection) noexcept -> std::vector<UTXO>;
     auto Rollback(
         const eLock& lock,
         const SubchainID& subchain,
@@ -131,6 +146,7 @@ public:
     Output(
         const api::Core& api,
         const api::client::internal::Blockchain& blockchain,
+        const storage::lmdb::LMDB& lmdb,
         const blockchain::Type chain,
         const wallet::SubchainData& subchains,
         wallet::Proposal& proposals,
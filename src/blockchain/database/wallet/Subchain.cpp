@@ -16,13 +16,16 @@
 #include <utility>
 #include <vector>
 
+#include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+#include "util/LMDB.hpp"
 
-// #define OT_METHOD "opentxs::blockchain::database::SubchainData::"
+#define OT_METHOD "opentxs::blockchain::database::SubchainData::"
 
 namespace opentxs::blockchain::database::wallet
 {
@@ -105,11 +108,30 @@ struct SubchainData::Imp {
 
             // FIXME use header oracle to set correct block hash if
             // scanned.first is modified
+            store_scanned(lock, subchain, scanned);
         } catch (...) {
         }
 
         return false;
     }
+    auto Rewind(const block::Height height) const noexcept -> bool
+    {
+        auto lock = Lock{lock_};
+        const auto blank = make_blank<block::Position>::value(api_);
+        auto output{true};
+
+        for (auto& [subchain, scanned] : last_scanned_) {
+            if (scanned.first <= height) { continue; }
+
+            LogOutput(OT_METHOD)(__func__)(": Discarding scan progress of ")(
+                subchain->str())(" beyond height ")(height)
+                .Flush();
+            scanned = blank;
+            output &= store_scanned(lock, subchain, scanned);
+        }
+
+        return output;
+    }
     auto SetDefaultFilterType(const FilterType type) const noexcept -> bool
     {
         auto lock = Lock{lock_};
@@ -184,6 +206,9 @@ struct SubchainData::Imp {
         const block::Position& position) const noexcept -> bool
     {
         auto lock = Lock{lock_};
+
+        if (false == store_scanned(lock, subchain, position)) { return false; }
+
         auto& map = last_scanned_;
         auto it = map.find(subchain);
 
@@ -204,8 +229,9 @@ struct SubchainData::Imp {
         return default_filter_type_;
     }
 
-    Imp(const api::Core& api) noexcept
+    Imp(const api::Core& api, const storage::lmdb::LMDB& lmdb) noexcept
         : api_(api)
+        , lmdb_(lmdb)
         , default_filter_type_()
         , current_version_(1)
         , lock_()
@@ -219,6 +245,7 @@ struct SubchainData::Imp {
     {
         // TODO persist default_filter_type_ and reindex various tables
         // if the type provided by the filter oracle has changed
+        load_scanned();
     }
 
 private:
@@ -238,6 +265,7 @@ private:
         std::map<pSubchainIndex, std::tuple<pNodeID, Subchain, FilterType>>;
 
     const api::Core& api_;
+    const storage::lmdb::LMDB& lmdb_;
     const FilterType default_filter_type_;
     const VersionNumber current_version_;
     mutable std::mutex lock_;
@@ -264,6 +292,23 @@ private:
     {
         return subchain_pattern_index_.at(subchain);
     }
+    auto load_scanned() noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        const auto cb = [&](const auto key, const auto value) -> bool {
+            auto subchain = api_.Factory().Identifier();
+            subchain->Assign(key.data(), key.size());
+            last_scanned_.emplace(
+                std::move(subchain),
+                blockchain::internal::Deserialize(api_, value));
+
+            return true;
+        };
+        lmdb_.Read(
+            database::WalletSubchainScanned,
+            cb,
+            storage::lmdb::LMDB::Dir::Forward);
+    }
     template <typename PatternList>
     auto load_patterns(
         const Lock& lock,
@@ -294,6 +339,24 @@ private:
 
         return output;
     }
+    auto store_scanned(
+        const Lock& lock,
+        const SubchainIndex& subchain,
+        const block::Position& position) const noexcept -> bool
+    {
+        const auto stored = lmdb_.Store(
+            database::WalletSubchainScanned,
+            subchain.Bytes(),
+            reader(blockchain::internal::Serialize(position)));
+
+        if (false == stored.first) {
+            LogOutput(OT_METHOD)(__func__)(
+                ": Failed to store scan progress for ")(subchain.str())
+                .Flush();
+        }
+
+        return stored.first;
+    }
     auto subchain_id(const NodeID& nodeID, const Subchain subchain)
         const noexcept -> pSubchainID
     {
@@ -360,8 +423,10 @@ private:
     }
 };
 
-SubchainData::SubchainData(const api::Core& api) noexcept
-    : imp_(std::make_unique<Imp>(api))
+SubchainData::SubchainData(
+    const api::Core& api,
+    const storage::lmdb::LMDB& lmdb) noexcept
+    : imp_(std::make_unique<Imp>(api, lmdb))
 {
     OT_ASSERT(imp_);
 }
@@ -407,6 +472,11 @@ auto SubchainData::Reorg(
     return imp_->Reorg(lock, subchain, lastGoodHeight);
 }
 
+auto SubchainData::Rewind(const block::Height height) const noexcept -> bool
+{
+    return imp_->Rewind(height);
+}
+
 auto SubchainData::SetDefaultFilterType(const FilterType type) const noexcept
     -> bool
 {
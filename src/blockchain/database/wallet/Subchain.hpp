@@ -23,6 +23,14 @@ namespace api
 {
 class Core;
 }  // namespace api
+
+namespace storage
+{
+namespace lmdb
+{
+class LMDB;
+}  // namespace lmdb
+}  // namespace storage
 }  // namespace opentxs
 
 namespace opentxs::blockchain::database::wallet
@@ -59,6 +67,7 @@ public:
         const Lock& lock,
         const SubchainIndex& subchain,
         const block::Height lastGoodHeight) const noexcept(false) -> bool;
+    auto Rewind(const block::Height height) const noexcept -> bool;
     auto SetDefaultFilterType(const FilterType type) const noexcept -> bool;
     auto SubchainAddElements(
         const SubchainIndex& subchain,
@@ -76,7 +85,9 @@ public:
         const block::Position& position) const noexcept -> bool;
     auto Type() const noexcept -> FilterType;
 
-    SubchainData(const api::Core& api) noexcept;
+    SubchainData(
+        const api::Core& api,
+        const storage::lmdb::LMDB& lmdb) noexcept;
 
     ~SubchainData();
 
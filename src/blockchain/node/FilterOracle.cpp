@@ -248,15 +248,26 @@ auto FilterOracle::compare_tips_to_checkpoint() noexcept -> void
     const auto headerTip = database_.FilterHeaderTip(default_type_);
     auto checkPosition{headerTip};
     auto changed{false};
+    auto checkpoints = std::vector<ChainMap::const_reverse_iterator>{};
+    auto hashes = std::vector<block::pHash>{};
 
     for (auto i{cp.crbegin()}; i != cp.crend(); ++i) {
         const auto& cpHeight = i->first;
 
-        if (cpHeight > checkPosition.first) { continue; }
+        if (cpHeight > headerTip.first) { continue; }
 
-        checkPosition = block::Position{cpHeight, header_.BestHash(cpHeight)};
-        const auto existingHeader = database_.LoadFilterHeader(
-            default_type_, checkPosition.second->Bytes());
+        checkpoints.emplace_back(i);
+        hashes.emplace_back(header_.BestHash(cpHeight));
+    }
+
+    const auto existing = database_.LoadFilterHeaders(default_type_, hashes);
+
+    OT_ASSERT(existing.size() == checkpoints.size());
+
+    for (auto n = std::size_t{0}; n < checkpoints.size(); ++n) {
+        const auto& i = checkpoints.at(n);
+        checkPosition = block::Position{i->first, hashes.at(n)};
+        const auto& existingHeader = existing.at(n);
 
         try {
             const auto& cpHeader = i->second.at(default_type_);
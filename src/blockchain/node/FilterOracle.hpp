@@ -149,6 +149,13 @@ public:
     {
         return database_.LoadFilterHeader(type, block.Bytes());
     }
+    auto LoadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const node::GCS>> final
+    {
+        return database_.LoadFilters(type, blocks);
+    }
     auto LoadFilterOrResetTip(
         const filter::Type type,
         const block::Position& position) const noexcept
@@ -176,10 +176,20 @@ private:
     auto download() noexcept -> void
     {
         auto work = NextBatch();
+        auto hashes = std::vector<block::pHash>{};
+        hashes.reserve(work.data_.size());
 
         for (const auto& task : work.data_) {
-            task->download(filter_.LoadFilter(type_, task->position_.second));
+            hashes.emplace_back(task->position_.second);
         }
+
+        auto filters = filter_.LoadFilters(type_, hashes);
+
+        OT_ASSERT(filters.size() == work.data_.size());
+
+        auto f = filters.begin();
+
+        for (const auto& task : work.data_) { task->download(std::move(*f++)); }
     }
     auto pipeline(const zmq::Message& in) noexcept -> void
     {
@@ -107,7 +107,7 @@ auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
 
     auto& [time, promise, future, queued] = pending->second;
     promise.set_value(std::move(in));
-    LogVerbose(OT_METHOD)(__func__)(": Cached block ")(id.asHex()).Flush();
+    OT_LOG_VERBOSE(OT_METHOD)(__func__)(": Cached block ")(id.asHex()).Flush();
     mem_.push(id, std::move(future));
     pending_.erase(pending);
     publish(pending_.size());
@@ -252,14 +252,14 @@ auto BlockOracle::Cache::StateMachine() const noexcept -> bool
         const auto timeout = download_timeout_ <= elapsed;
 
         if (timeout || (false == queued)) {
-            LogVerbose(OT_METHOD)(__func__)(": Requesting ")(
+            OT_LOG_VERBOSE(OT_METHOD)(__func__)(": Requesting ")(
                 DisplayString(chain_))(" block ")(hash->asHex())(" from peers")
                 .Flush();
             blockList.emplace_back(hash->Bytes());
             queued = true;
             time = now;
         } else {
-            LogVerbose(OT_METHOD)(__func__)(": ")(elapsed.count())(
+            OT_LOG_VERBOSE(OT_METHOD)(__func__)(": ")(elapsed.count())(
                 " milliseconds elapsed waiting for ")(DisplayString(chain_))(
                 " block ")(hash->asHex())
                 .Flush();
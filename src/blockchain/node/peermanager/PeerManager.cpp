@@ -11,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string_view>
+#include <utility>
 
 #include "core/Worker.hpp"
 #include "internal/api/network/Network.hpp"
@@ -177,9 +178,8 @@ auto PeerManager::BroadcastTransaction(
 
     if (false == tx.Serialize(writer(bytes)).has_value()) { return false; }
 
-    const auto view = reader(bytes);
     auto work = jobs_.Work(Task::BroadcastTransaction);
-    work->AddFrame(view.data(), view.size());
+    work->AddFrame(std::move(bytes));
     jobs_.Dispatch(work);
 
     return true;
@@ -30,21 +30,46 @@
 
 namespace opentxs::blockchain::node::wallet
 {
+using Event = SubchainStateData::Event;
 using Subchain = node::internal::WalletDatabase::Subchain;
 
 struct Account::Imp {
+    auto key_generated(const Identifier& subaccount) noexcept -> bool
+    {
+        auto ticket = gatekeeper_.get();
+
+        if (ticket) { return false; }
+
+        auto output{false};
+
+        for (auto* map : {&internal_, &external_, &outgoing_, &incoming_}) {
+            if (auto it = map->find(subaccount); map->end() != it) {
+                it->second.events_.Post(Event::key);
+                output = true;
+            }
+        }
+
+        return output;
+    }
     auto mempool(std::shared_ptr<const block::bitcoin::Transaction> tx) noexcept
         -> void
     {
-        for (const auto& account : ref_.GetHD()) {
-            get(account, Subchain::Internal, internal_).mempool_.Queue(tx);
-            get(account, Subchain::External, external_).mempool_.Queue(tx);
-        }
+        for_each([&](auto& subchain) {
+            subchain.mempool_.Queue(tx);
+            subchain.events_.Post(Event::mempool);
+        });
+    }
+    auto new_subaccount() noexcept -> void
+    {
+        auto ticket = gatekeeper_.get();
 
-        for (const auto& account : ref_.GetPaymentCode()) {
-            get(account, Subchain::Outgoing, outgoing_).mempool_.Queue(tx);
-            get(account, Subchain::Incoming, incoming_).mempool_.Queue(tx);
-        }
+        if (ticket) { return; }
+
+        instantiate_all();
+    }
+    auto notify(const Event type) noexcept -> void
+    {
+        for_each([&](auto& subchain) { subchain.events_.Post(type); });
     }
     auto reorg(const block::Position& parent) noexcept -> bool
     {
@@ -54,26 +79,10 @@ struct Account::Imp {
 
         auto output{false};
 
-        for (const auto& account : ref_.GetHD()) {
-            const auto& id = account.ID();
-            LogVerbose(OT_METHOD)(__func__)(": Processing HD account ")(id)
-                .Flush();
-            output |= get(account, Subchain::Internal, internal_)
-                          .reorg_.Queue(parent);
-            output |= get(account, Subchain::External, external_)
-                          .reorg_.Queue(parent);
-        }
-
-        for (const auto& account : ref_.GetPaymentCode()) {
-            const auto& id = account.ID();
-            LogVerbose(OT_METHOD)(__func__)(
-                ": Processing payment code account ")(id)
-                .Flush();
-            output |= get(account, Subchain::Outgoing, outgoing_)
-                          .reorg_.Queue(parent);
-            output |= get(account, Subchain::Incoming, incoming_)
-                          .reorg_.Queue(parent);
-        }
+        for_each([&](auto& subchain) {
+            output |= subchain.reorg_.Queue(parent);
+            subchain.events_.Post(Event::reorg);
+        });
 
         return output;
     }
@@ -93,26 +102,9 @@ struct Account::Imp {
 
         auto output{false};
 
-        for (const auto& account : ref_.GetHD()) {
-            const auto& id = account.ID();
-            LogVerbose(OT_METHOD)(__func__)(": Processing HD account ")(id)
-                .Flush();
-            output |= get(account, Subchain::Internal, internal_)
-                          .state_machine(enabled);
-            output |= get(account, Subchain::External, external_)
-                          .state_machine(enabled);
-        }
-
-        for (const auto& account : ref_.GetPaymentCode()) {
-            const auto& id = account.ID();
-            LogVerbose(OT_METHOD)(__func__)(
-                ": Processing payment code account ")(id)
-                .Flush();
-            output |= get(account, Subchain::Outgoing, outgoing_)
-                          .state_machine(enabled);
-            output |= get(account, Subchain::Incoming, incoming_)
-                          .state_machine(enabled);
-        }
+        for_each([&](auto& subchain) {
+            output |= subchain.state_machine(enabled);
+        });
 
         return output;
     }
@@ -168,6 +160,13 @@ private:
     Outstanding jobs_;
     Gatekeeper gatekeeper_;
 
+    template <typename F>
+    auto for_each(F action) noexcept -> void
+    {
+        for (auto* map : {&internal_, &external_, &outgoing_, &incoming_}) {
+            for (auto& [id, subchain] : *map) { action(subchain); }
+        }
+    }
     auto get(
         const crypto::Deterministic& account,
         const Subchain subchain,
@@ -200,6 +199,26 @@ private:
 
         return it->second;
     }
+    // NOTE newly instantiated subchains start with every event pending
+    auto instantiate_all() noexcept -> void
+    {
+        for (const auto& account : ref_.GetHD()) {
+            const auto& id = account.ID();
+            LogVerbose(OT_METHOD)(__func__)(": Processing HD account ")(id)
+                .Flush();
+            get(account, Subchain::Internal, internal_);
+            get(account, Subchain::External, external_);
+        }
+
+        for (const auto& account : ref_.GetPaymentCode()) {
+            const auto& id = account.ID();
+            LogVerbose(OT_METHOD)(__func__)(
+                ": Processing payment code account ")(id)
+                .Flush();
+            get(account, Subchain::Outgoing, outgoing_);
+            get(account, Subchain::Incoming, incoming_);
+        }
+    }
 };
 
 Account::Account(
@@ -230,12 +249,32 @@ Account::Account(Account&& rhs) noexcept
     OT_ASSERT(imp_);
 }
 
+auto Account::block_downloaded() noexcept -> void
+{
+    imp_->notify(Event::block);
+}
+
+auto Account::filter_tip() noexcept -> void
+{
+    imp_->notify(Event::filter);
+}
+
+auto Account::key_generated(const Identifier& subaccount) noexcept -> bool
+{
+    return imp_->key_generated(subaccount);
+}
+
 auto Account::mempool(
     std::shared_ptr<const block::bitcoin::Transaction> tx) noexcept -> void
 {
     imp_->mempool(tx);
 }
 
+auto Account::new_subaccount() noexcept -> void
+{
+    imp_->new_subaccount();
+}
+
 auto Account::reorg(const block::Position& parent) noexcept -> bool
 {
     return imp_->reorg(parent);
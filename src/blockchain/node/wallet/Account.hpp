@@ -70,6 +70,7 @@ class Push;
 }  // namespace zeromq
 }  // namespace network
 
+class Identifier;
 class Outstanding;
 }  // namespace opentxs
 
@@ -80,8 +81,12 @@ class Account
 public:
     using BalanceTree = crypto::Account;
 
+    auto block_downloaded() noexcept -> void;
+    auto filter_tip() noexcept -> void;
+    auto key_generated(const Identifier& subaccount) noexcept -> bool;
     auto mempool(std::shared_ptr<const block::bitcoin::Transaction> tx) noexcept
         -> void;
+    auto new_subaccount() noexcept -> void;
     auto reorg(const block::Position& parent) noexcept -> bool;
     auto shutdown() noexcept -> void;
     auto state_machine(bool enabled) noexcept -> bool;
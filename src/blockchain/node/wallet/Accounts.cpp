@@ -73,16 +73,73 @@ struct Accounts::Imp {
 
         return Add(id);
     }
+    auto BlockDownloaded() noexcept -> void
+    {
+        auto ticket = gatekeeper_.get();
+
+        if (ticket) { return; }
+
+        for (auto& [code, account] : payment_codes_) {
+            account.events_.Post(Event::block);
+        }
+
+        for (auto& [nym, account] : map_) { account.block_downloaded(); }
+    }
+    auto FilterTip(const filter::Type type) noexcept -> void
+    {
+        if (filter_type_ != type) { return; }
+
+        auto ticket = gatekeeper_.get();
+
+        if (ticket) { return; }
+
+        for (auto& [code, account] : payment_codes_) {
+            account.events_.Post(Event::filter);
+        }
+
+        for (auto& [nym, account] : map_) { account.filter_tip(); }
+    }
+    auto KeyGenerated(const Identifier& subaccount) noexcept -> void
+    {
+        auto ticket = gatekeeper_.get();
+
+        if (ticket) { return; }
+
+        for (auto& [nym, account] : map_) {
+            if (account.key_generated(subaccount)) { return; }
+        }
+
+        // NOTE keys may be generated for a subaccount before its creation
+        // notification arrives
+        for (auto& [nym, account] : map_) { account.new_subaccount(); }
+    }
     auto Mempool(
         std::shared_ptr<const block::bitcoin::Transaction>&& tx) noexcept
         -> void
     {
         for (auto& [code, account] : payment_codes_) {
             account.mempool_.Queue(tx);
+            account.events_.Post(Event::mempool);
         }
 
         for (auto& [nym, account] : map_) { account.mempool(tx); }
     }
+    auto NewSubaccount(const identifier::Nym& owner) noexcept -> void
+    {
+        {
+            auto ticket = gatekeeper_.get();
+
+            if (ticket) { return; }
+
+            if (auto it = map_.find(owner); map_.end() != it) {
+                it->second.new_subaccount();
+
+                return;
+            }
+        }
+
+        Add(owner);
+    }
     auto Reorg(const block::Position& parent) noexcept -> bool
     {
         auto ticket = gatekeeper_.get();
@@ -95,6 +152,7 @@ struct Accounts::Imp {
 
         for (auto& [code, account] : payment_codes_) {
             output |= account.reorg_.Queue(parent);
+            account.events_.Post(Event::reorg);
         }
 
         return output;
@@ -151,6 +209,7 @@ struct Accounts::Imp {
 
 private:
     using AccountMap = std::map<OTNymID, wallet::Account>;
+    using Event = SubchainStateData::Event;
     using PCMap = std::map<OTIdentifier, NotificationStateData>;
 
     const api::Core& api_;
@@ -224,12 +283,32 @@ auto Accounts::Add(const zmq::Frame& message) noexcept -> bool
     return imp_->Add(message);
 }
 
+auto Accounts::BlockDownloaded() noexcept -> void
+{
+    imp_->BlockDownloaded();
+}
+
+auto Accounts::FilterTip(const filter::Type type) noexcept -> void
+{
+    imp_->FilterTip(type);
+}
+
+auto Accounts::KeyGenerated(const Identifier& subaccount) noexcept -> void
+{
+    imp_->KeyGenerated(subaccount);
+}
+
 auto Accounts::Mempool(
     std::shared_ptr<const block::bitcoin::Transaction>&& tx) noexcept -> void
 {
     imp_->Mempool(std::move(tx));
 }
 
+auto Accounts::NewSubaccount(const identifier::Nym& owner) noexcept -> void
+{
+    imp_->NewSubaccount(owner);
+}
+
 auto Accounts::Reorg(const block::Position& parent) noexcept -> bool
 {
     return imp_->Reorg(parent);
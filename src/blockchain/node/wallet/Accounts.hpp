@@ -10,6 +10,7 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
 
 namespace opentxs
 {
@@ -63,6 +64,8 @@ class Push;
 class Frame;
 }  // namespace zeromq
 }  // namespace network
+
+class Identifier;
 }  // namespace opentxs
 
 namespace opentxs::blockchain::node::wallet
@@ -72,9 +75,13 @@ class Accounts
 public:
     auto Add(const identifier::Nym& nym) noexcept -> bool;
     auto Add(const network::zeromq::Frame& message) noexcept -> bool;
+    auto BlockDownloaded() noexcept -> void;
+    auto FilterTip(const filter::Type type) noexcept -> void;
+    auto KeyGenerated(const Identifier& subaccount) noexcept -> void;
     auto Mempool(
         std::shared_ptr<const block::bitcoin::Transaction>&& tx) noexcept
         -> void;
+    auto NewSubaccount(const identifier::Nym& owner) noexcept -> void;
     auto Reorg(const block::Position& parent) noexcept -> bool;
 
     auto shutdown() noexcept -> void;
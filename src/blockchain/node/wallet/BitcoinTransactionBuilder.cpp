@@ -10,12 +10,14 @@
 #include <boost/endian/buffers.hpp>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <iosfwd>
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <sstream>
@@ -27,6 +29,7 @@
 
 #include "Proto.hpp"
 #include "internal/api/client/Client.hpp"
+#include "internal/api/network/Network.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
@@ -41,6 +44,8 @@
 #include "opentxs/api/client/Contacts.hpp"
 #include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/crypto/Hash.hpp"  // IWYU pragma: keep
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/block/bitcoin/Script.hpp"
@@ -63,6 +68,7 @@
 #include "opentxs/protobuf/BlockchainTransactionProposedNotification.pb.h"
 #include "opentxs/protobuf/BlockchainTransactionProposedOutput.pb.h"
 #include "opentxs/protobuf/HDPath.pb.h"
+#include "util/ParallelFor.hpp"
 #include "util/ScopeGuard.hpp"
 
 #define OT_METHOD                                                              \
@@ -77,6 +83,16 @@ struct BitcoinTransactionBuilder::Imp {
     {
         return input_value_ > (output_value_ + required_fee());
     }
+    auto SelectionTarget() const noexcept -> Selection
+    {
+        auto output = Selection{};
+        // NOTE IsFunded requires the input value to exceed the required amount
+        output.target_ = output_value_ + required_fee() + 1u;
+        output.input_fee_ = input_fee();
+        output.change_threshold_ = dust();
+
+        return output;
+    }
     auto Spender() const noexcept -> const identifier::Nym&
     {
         return sender_->ID();
@@ -418,20 +434,33 @@ struct BitcoinTransactionBuilder::Imp {
     }
     auto SignInputs() noexcept -> bool
     {
-        auto index = int{-1};
-        auto txcopy = Transaction{};
-        auto bip143 = std::optional<bitcoin::Bip143Hashes>{};
-
-        for (const auto& [input, value] : inputs_) {
-            if (false == sign_input(++index, *input, txcopy, bip143)) {
-                LogOutput(OT_METHOD)(__func__)(": Failed to sign input ")(index)
-                    .Flush();
-
-                return false;
-            }
-        }
+        auto bip143 = Bip143{};
+        auto legacy = Legacy{};
+
+        if (false == init_signing(bip143, legacy)) { return false; }
+
+        auto failed = std::atomic<bool>{false};
+        ParallelFor(
+            inputs_.size(),
+            1,
+            [this](auto job) {
+                return api_.Network().Asio().Internal().PostCPU(
+                    std::move(job));
+            },
+            [&](const auto index, const auto) {
+                if (failed.load()) { return; }
+
+                auto& input = *inputs_.at(index).first;
+
+                if (false == sign_input(index, input, bip143, legacy)) {
+                    LogOutput(OT_METHOD)(__func__)(": Failed to sign input ")(
+                        index)
+                        .Flush();
+                    failed.store(true);
+                }
+            });
 
-        return true;
+        return false == failed.load();
     }
 
     Imp(const api::Core& api,
@@ -496,8 +525,10 @@ private:
     using Input = std::unique_ptr<block::bitcoin::internal::Input>;
     using Output = std::unique_ptr<block::bitcoin::internal::Output>;
     using Bip143 = std::optional<bitcoin::Bip143Hashes>;
+    using Legacy = std::optional<bitcoin::LegacyPreimages>;
     using Hash = std::array<std::byte, 32>;
 
+    static constexpr auto p2pkh_input_bytes_ = std::size_t{148};
     static constexpr auto p2pkh_output_bytes_ = std::size_t{34};
 
     const api::Core& api_;
@@ -831,10 +862,19 @@ private:
                outputs.Size() + output_total_ + p2pkh_output_bytes_;
     }
     auto dust() const noexcept -> std::size_t
+    {
+        // NOTE change worth less than the fee to spend it is not worth creating
+        return static_cast<std::size_t>(input_fee());
+    }
+    auto fee(const std::size_t bytes) const noexcept -> Amount
+    {
+        return (bytes * fee_rate_) / 1000;
+    }
+    auto input_fee() const noexcept -> Amount
     {
         // TODO this should account for script type
 
-        return std::size_t{148} * fee_rate_ / 1000;
+        return fee(p2pkh_input_bytes_);
     }
     auto get_private_key(
         const opentxs::crypto::key::EllipticCurve& pubkey,
@@ -964,55 +1004,112 @@ private:
 
         return true;
     }
-    auto init_txcopy(Transaction& txcopy) const noexcept -> bool
+    auto init_legacy(Legacy& legacy) const noexcept -> bool
     {
-        if (txcopy) { return true; }
-
-        auto inputCopy = std::vector<Input>{};
-        std::transform(
-            std::begin(inputs_),
-            std::end(inputs_),
-            std::back_inserter(inputCopy),
-            [](const auto& input) -> auto {
-                return input.first->SignatureVersion();
-            });
-        auto inputs = factory::BitcoinTransactionInputs(std::move(inputCopy));
+        if (legacy.has_value()) { return true; }
 
-        if (false == bool(inputs)) {
-            LogOutput(OT_METHOD)(__func__)(": Failed to construct inputs")
-                .Flush();
+        auto success{false};
+        const auto postcondition = ScopeGuard{[&]() {
+            if (false == success) { legacy = std::nullopt; }
+        }};
+        legacy.emplace();
 
-            return {};
+        OT_ASSERT(legacy.has_value());
+
+        auto& output = legacy.value();
+        output.version_ = version_;
+        output.locktime_ = lock_time_;
+        output.inputs_.reserve(inputs_.size());
+
+        for (const auto& [input, value] : inputs_) {
+            const auto blank = input->SignatureVersion();
+
+            OT_ASSERT(blank);
+
+            auto& bytes = output.inputs_.emplace_back();
+
+            if (false == blank->Serialize(writer(bytes)).has_value()) {
+                LogOutput(OT_METHOD)(__func__)(": Failed to serialize input")
+                    .Flush();
+
+                return false;
+            }
         }
 
-        auto outputCopy = std::vector<Output>{};
-        std::transform(
-            std::begin(outputs_),
-            std::end(outputs_),
-            std::back_inserter(outputCopy),
-            [](const auto& output) -> auto { return output->clone(); });
-        auto outputs =
-            factory::BitcoinTransactionOutputs(std::move(outputCopy));
+        {
+            const auto count = bitcoin::CompactSize{outputs_.size()};
+            auto& preimage = output.outputs_;
+            preimage = space(count.Size() + output_total_);
+            auto it = preimage.data();
 
-        if (false == bool(outputs)) {
-            LogOutput(OT_METHOD)(__func__)(": Failed to construct outputs")
-                .Flush();
+            if (false == count.Encode(preallocated(count.Size(), it))) {
+                LogOutput(OT_METHOD)(__func__)(
+                    ": Failed to encode output count")
+                    .Flush();
 
-            return {};
+                return false;
+            }
+
+            std::advance(it, count.Size());
+
+            for (const auto& output : outputs_) {
+                const auto size = output->CalculateSize();
+
+                if (false ==
+                    output->Serialize(preallocated(size, it)).has_value()) {
+                    LogOutput(OT_METHOD)(__func__)(
+                        ": Failed to serialize output")
+                        .Flush();
+
+                    return false;
+                }
+
+                std::advance(it, size);
+            }
         }
 
-        txcopy = factory::BitcoinTransaction(
-            api_,
-            crypto_,
-            chain_,
-            Clock::now(),
-            version_,
-            lock_time_,
-            false,
-            std::move(inputs),
-            std::move(outputs));
+        success = true;
 
-        return bool(txcopy);
+        return true;
+    }
+    auto init_signing(Bip143& bip143, Legacy& legacy) const noexcept -> bool
+    {
+        for (const auto& [input, value] : inputs_) {
+            const auto bip143Sighash = [&] {
+                switch (chain_) {
+                    case Type::BitcoinCash:
+                    case Type::BitcoinCash_testnet3: {
+
+                        return true;
+                    }
+                    default: {
+                        const auto segwit = is_segwit(*input);
+
+                        if (segwit) { segwit_ = true; }
+
+                        return segwit;
+                    }
+                }
+            }();
+
+            if (bip143Sighash) {
+                if (false == init_bip143(bip143)) {
+                    LogOutput(OT_METHOD)(__func__)(
+                        ": Error instantiating bip143")
+                        .Flush();
+
+                    return false;
+                }
+            } else if (false == init_legacy(legacy)) {
+                LogOutput(OT_METHOD)(__func__)(
+                    ": Error instantiating legacy preimages")
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        return true;
     }
     auto print() const noexcept -> std::string
     {
@@ -1042,15 +1139,12 @@ private:
 
         return text.str();
     }
-    auto required_fee() const noexcept -> Amount
-    {
-        return (bytes() * fee_rate_) / 1000;
-    }
+    auto required_fee() const noexcept -> Amount { return fee(bytes()); }
     auto sign_input(
-        const int index,
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Transaction& txcopy,
-        Bip143& bip143) const noexcept -> bool
+        const Bip143& bip143,
+        const Legacy& legacy) const noexcept -> bool
     {
         switch (chain_) {
             case Type::BitcoinCash:
@@ -1070,7 +1164,7 @@ private:
                     return sign_input_segwit(index, input, bip143);
                 }
 
-                return sign_input_btc(index, input, txcopy);
+                return sign_input_btc(index, input, legacy);
             }
             case Type::Unknown:
             case Type::Ethereum_frontier:
@@ -1083,16 +1177,11 @@ private:
         }
     }
     auto sign_input_bch(
-        const int index,
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
+        const Bip143& bip143) const noexcept -> bool
     {
-        if (false == init_bip143(bip143)) {
-            LogOutput(OT_METHOD)(__func__)(": Error instantiating bip143")
-                .Flush();
-
-            return false;
-        }
+        OT_ASSERT(bip143.has_value());
 
         const auto sigHash = blockchain::bitcoin::SigHash{chain_};
         const auto preimage = bip143->Preimage(
@@ -1101,44 +1190,33 @@ private:
         return add_signatures(reader(preimage), sigHash, input);
     }
     auto sign_input_btc(
-        const int index,
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Transaction& txcopy) const noexcept -> bool
+        const Legacy& legacy) const noexcept -> bool
     {
-        if (false == init_txcopy(txcopy)) {
-            LogOutput(OT_METHOD)(__func__)(": Error instantiating txcopy")
-                .Flush();
-
-            return false;
-        }
+        OT_ASSERT(legacy.has_value());
 
         const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        auto preimage = txcopy->GetPreimageBTC(index, sigHash);
 
-        if (0 == preimage.size()) {
-            LogOutput(OT_METHOD)(__func__)(": Error obtaining signing preimage")
+        try {
+            const auto preimage = legacy->Preimage(index, sigHash, input);
+
+            return add_signatures(reader(preimage), sigHash, input);
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(
+                ": Error obtaining signing preimage: ")(e.what())
                 .Flush();
 
             return false;
         }
-
-        std::copy(sigHash.begin(), sigHash.end(), std::back_inserter(preimage));
-
-        return add_signatures(reader(preimage), sigHash, input);
     }
     auto sign_input_segwit(
-        const int index,
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
+        const Bip143& bip143) const noexcept -> bool
     {
-        if (false == init_bip143(bip143)) {
-            LogOutput(OT_METHOD)(__func__)(": Error instantiating bip143")
-                .Flush();
-
-            return false;
-        }
+        OT_ASSERT(bip143.has_value());
 
-        segwit_ = true;
         const auto sigHash = blockchain::bitcoin::SigHash{chain_};
         const auto preimage = bip143->Preimage(
             index, outputs_.size(), version_, lock_time_, sigHash, input);
@@ -1295,6 +1373,11 @@ auto BitcoinTransactionBuilder::SignInputs() noexcept -> bool
 {
     return imp_->SignInputs();
 }
+
+auto BitcoinTransactionBuilder::SelectionTarget() const noexcept -> Selection
+{
+    return imp_->SelectionTarget();
+}
 auto BitcoinTransactionBuilder::Spender() const noexcept
     -> const identifier::Nym&
 {
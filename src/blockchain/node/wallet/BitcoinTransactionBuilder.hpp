@@ -110,8 +110,10 @@ public:
     using Transaction = std::unique_ptr<block::bitcoin::internal::Transaction>;
     using KeyID = blockchain::crypto::Key;
     using Proposal = proto::BlockchainTransactionProposal;
+    using Selection = node::internal::WalletDatabase::Selection;
 
     auto IsFunded() const noexcept -> bool;
+    auto SelectionTarget() const noexcept -> Selection;
     auto Spender() const noexcept -> const identifier::Nym&;
 
     auto AddChange(const Proposal& proposal) noexcept -> bool;
@@ -251,8 +251,25 @@ private:
             return output;
         }
 
+        using Spend = node::internal::WalletDatabase::Spend;
+
+        for (const auto& utxo : db_.ReserveUTXOs(
+                 builder.Spender(),
+                 id,
+                 Spend::ConfirmedOnly,
+                 builder.SelectionTarget())) {
+            if (false == builder.AddInput(utxo)) {
+                LogOutput(OT_METHOD)(__func__)(": Failed to add input").Flush();
+                output = BuildResult::PermanentFailure;
+                rc = SendResult::InputCreationError;
+
+                return output;
+            }
+        }
+
+        // NOTE selection estimates the size of each input so additional
+        // inputs may still be required
         while (false == builder.IsFunded()) {
-            using Spend = node::internal::WalletDatabase::Spend;
             auto utxo =
                 db_.ReserveUTXO(builder.Spender(), id, Spend::ConfirmedOnly);
 
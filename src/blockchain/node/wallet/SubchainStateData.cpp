@@ -8,6 +8,7 @@
 #include "blockchain/node/wallet/SubchainStateData.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <future>
 #include <iterator>
@@ -40,6 +41,8 @@
 #include "util/JobCounter.hpp"
 #include "util/ScopeGuard.hpp"
 
+#define OT_SUBCHAIN_SCAN_BATCH 1000
+
 #define OT_METHOD "opentxs::blockchain::node::wallet::SubchainStateData::"
 
 namespace opentxs::blockchain::node::wallet
@@ -67,6 +70,7 @@ SubchainStateData::SubchainStateData(
     , running_(false)
     , mempool_()
     , reorg_()
+    , events_()
     , last_indexed_(db.SubchainLastIndexed(index_))
     , last_scanned_(db.SubchainLastScanned(index_))
     , blocks_to_request_()
@@ -147,8 +151,103 @@ auto SubchainStateData::ReorgQueue::Next() noexcept -> block::Position
     return output;
 }
 
+SubchainStateData::EventQueue::EventQueue() noexcept
+    : lock_()
+    , pending_(true)
+    , posted_()
+    , stats_()
+{
+    const auto now = Clock::now();
+
+    for (auto& time : posted_) { time = now; }
+}
+
+auto SubchainStateData::EventQueue::Pending() const noexcept -> bool
+{
+    return pending_.load();
+}
+
+auto SubchainStateData::EventQueue::Post(const Event type) noexcept -> void
+{
+    auto lock = Lock{lock_};
+    auto& posted = posted_.at(static_cast<std::size_t>(type));
+
+    // NOTE latency is measured from the oldest unhandled occurrence
+    if (false == posted.has_value()) { posted = Clock::now(); }
+
+    pending_.store(true);
+}
+
+auto SubchainStateData::EventQueue::Record(
+    const Event type,
+    const Time posted) noexcept -> std::chrono::microseconds
+{
+    const auto latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - posted);
+    auto lock = Lock{lock_};
+    auto& stats = stats_.at(static_cast<std::size_t>(type));
+    ++stats.count_;
+    stats.total_ += latency;
+    stats.max_ = std::max(stats.max_, latency);
+
+    return latency;
+}
+
+auto SubchainStateData::EventQueue::Run(
+    const bool enabled,
+    const Handler& handler) noexcept -> void
+{
+    static constexpr auto order = std::array<std::pair<Event, bool>, count_>{{
+        {Event::reorg, true},
+        {Event::blocks, true},
+        {Event::key, false},
+        {Event::mempool, false},
+        {Event::filter, true},
+        {Event::block, true},
+    }};
+
+    // NOTE idle subchains return here without consulting any oracle
+    if (false == Pending()) { return; }
+
+    for (const auto& [type, network] : order) {
+        if (network && (false == enabled)) { continue; }
+
+        const auto posted = Take(type);
+
+        if (false == posted.has_value()) { continue; }
+
+        if (handler(type, posted.value())) { return; }
+    }
+}
+
+auto SubchainStateData::EventQueue::Statistics(const Event type) const noexcept
+    -> Stats
+{
+    auto lock = Lock{lock_};
+
+    return stats_.at(static_cast<std::size_t>(type));
+}
+
+auto SubchainStateData::EventQueue::Take(const Event type) noexcept
+    -> std::optional<Time>
+{
+    auto lock = Lock{lock_};
+    auto& posted = posted_.at(static_cast<std::size_t>(type));
+    auto output{posted};
+    posted.reset();
+    pending_.store(std::any_of(
+        posted_.begin(), posted_.end(), [](const auto& time) {
+            return time.has_value();
+        }));
+
+    return output;
+}
+
 auto SubchainStateData::check_blocks() noexcept -> bool
 {
+    if (blocks_to_request_.empty()) { return false; }
+
     auto h{blocks_to_request_.begin()};
     auto futures = node_.BlockOracle().LoadBitcoin(blocks_to_request_);
 
@@ -169,12 +268,17 @@ auto SubchainStateData::check_blocks() noexcept -> bool
     }
 
     blocks_to_request_.clear();
+    // NOTE blocks which are already cached will never produce a download
+    // notification
+    events_.Post(Event::block);
 
     return false;
 }
 
 auto SubchainStateData::check_mempool() noexcept -> void
 {
+    if (mempool_.Empty()) { return; }
+
     const auto targets = get_account_targets();
     const auto [elements, utxos, patterns] = targets;
     const auto parsed = block::Block::ParsedPatterns{elements};
@@ -205,8 +309,10 @@ auto SubchainStateData::check_process() noexcept -> bool
 
     const auto& [id, future] = *process_block_queue_.front();
 
+    // NOTE a block download notification will arrive if the block is not
+    // ready yet so there is no reason to wait for it here
     if (std::future_status::ready ==
-        future.wait_for(std::chrono::milliseconds(1))) {
+        future.wait_for(std::chrono::milliseconds(0))) {
         LogVerbose(OT_METHOD)(__func__)(": ")(name_)(" ready to process block")
             .Flush();
         static constexpr auto job{"process"};
@@ -395,6 +501,49 @@ auto SubchainStateData::get_targets(
     translate(utxos, outpoints);
 }
 
+auto SubchainStateData::handle(const Event type, const Time posted) noexcept
+    -> bool
+{
+    const auto output = [&] {
+        switch (type) {
+            case Event::reorg: {
+
+                return check_reorg();
+            }
+            case Event::blocks: {
+
+                return check_blocks();
+            }
+            case Event::key: {
+
+                return check_index();
+            }
+            case Event::mempool: {
+                check_mempool();
+
+                return false;
+            }
+            case Event::filter: {
+
+                return check_scan();
+            }
+            case Event::block: {
+
+                return check_process();
+            }
+            default: {
+                OT_FAIL;
+            }
+        }
+    }();
+    const auto latency = events_.Record(type, posted);
+    LogTrace(OT_METHOD)(__func__)(": ")(name_)(" handled ")(print(type))(
+        " event after ")(latency.count())(" microseconds")
+        .Flush();
+
+    return output;
+}
+
 auto SubchainStateData::index_element(
     const filter::Type type,
     const blockchain::crypto::Element& input,
@@ -442,6 +591,39 @@ auto SubchainStateData::init() noexcept -> void
     mempool_.Queue(std::move(transactions));
 }
 
+auto SubchainStateData::print(const Event type) noexcept -> const char*
+{
+    switch (type) {
+        case Event::reorg: {
+
+            return "reorg";
+        }
+        case Event::blocks: {
+
+            return "block request";
+        }
+        case Event::key: {
+
+            return "new key";
+        }
+        case Event::mempool: {
+
+            return "mempool";
+        }
+        case Event::filter: {
+
+            return "filter tip";
+        }
+        case Event::block: {
+
+            return "block downloaded";
+        }
+        default: {
+            OT_FAIL;
+        }
+    }
+}
+
 auto SubchainStateData::process() noexcept -> void
 {
     const auto start = Clock::now();
@@ -494,13 +676,14 @@ auto SubchainStateData::process() noexcept -> void
     const auto position = header.Position();
     handle_confirmed_matches(block, position, confirmed);
     const auto [balance, unconfirmed] = db_.GetBalance();
-    LogVerbose(OT_METHOD)(__func__)(": ")(name_)(" block ")(block.ID().asHex())(
-        " processed in ")(std::chrono::duration_cast<std::chrono::milliseconds>(
-                              Clock::now() - start)
-                              .count())(" milliseconds. ")(general.size())(
-        " of ")(potential.size())(
-        " potential matches confirmed. Wallet balance is:  ")(
-        unconfirmed)(" (")(balance)(" confirmed)")
+    OT_LOG_VERBOSE(OT_METHOD)(__func__)(": ")(name_)(" block ")(
+        block.ID().asHex())(" processed in ")(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - start)
+            .count())(" milliseconds. ")(general.size())(" of ")(
+        potential.size())(
+        " potential matches confirmed. Wallet balance is:  ")(unconfirmed)(
+        " (")(balance)(" confirmed)")
         .Flush();
     db_.SubchainMatchBlock(index_, tested, blockHash.Bytes());
 
@@ -526,20 +709,29 @@ auto SubchainStateData::queue_work(const Task task, const char* log) noexcept
         switch (task) {
             case Task::index: {
                 index();
+                events_.Post(Event::filter);
             } break;
             case Task::scan: {
                 scan();
+                events_.Post(Event::filter);
             } break;
             case Task::process: {
                 process();
+                events_.Post(Event::block);
+                events_.Post(Event::filter);
             } break;
             case Task::reorg: {
                 reorg();
+                events_.Post(Event::filter);
             } break;
             default: {
                 OT_FAIL;
             }
         }
+
+        if (false == blocks_to_request_.empty()) {
+            events_.Post(Event::blocks);
+        }
     });
 
     if (queued) {
@@ -549,7 +741,28 @@ auto SubchainStateData::queue_work(const Task task, const char* log) noexcept
         LogDebug(OT_METHOD)(__func__)(": ")(name_)(" failed to queue ")(
             log)(" job")
             .Flush();
+        // NOTE leave the triggering event pending so the job is retried
+        events_.Post([&] {
+            switch (task) {
+                case Task::index: {
 
+                    return Event::key;
+                }
+                case Task::scan: {
+
+                    return Event::filter;
+                }
+                case Task::process: {
+
+                    return Event::block;
+                }
+                case Task::reorg:
+                default: {
+
+                    return Event::reorg;
+                }
+            }
+        }());
         running_.store(false);
     }
 
@@ -617,43 +830,61 @@ auto SubchainStateData::scan() noexcept -> void
     const auto [elements, utxos, patterns] = get_account_targets();
     auto highestTested = last_scanned_.value_or(null_position_);
     auto atLeastOnce{false};
-    auto blockHash = api_.Factory().Data();
     auto cache = decltype(blocks_to_request_){};
+    auto interrupted{false};
 
-    for (auto i{startHeight}; i <= stopHeight; ++i) {
-        blockHash = headers.BestHash(i);
-        const auto pFilter = filters.LoadFilterOrResetTip(
-            filter_type_, block::Position{i, blockHash});
+    for (auto height{startHeight};
+         (false == interrupted) && (height <= stopHeight);) {
+        const auto count = static_cast<std::size_t>(std::min<block::Height>(
+            stopHeight - height + 1, OT_SUBCHAIN_SCAN_BATCH));
+        const auto hashes = headers.BestHashes(height, count);
 
-        if (false == bool(pFilter)) {
-            LogVerbose(OT_METHOD)(__func__)(": ")(name_)(" filter at height ")(
-                i)(" not found ")
-                .Flush();
+        if (hashes.empty()) { break; }
 
-            break;
-        }
+        auto loaded = filters.LoadFilters(filter_type_, hashes);
 
-        atLeastOnce = true;
-        highestTested.first = i;
-        highestTested.second = blockHash;
-        const auto& filter = *pFilter;
-        auto matches = filter.Match(patterns);
-        const auto size{matches.size()};
-
-        if (0 < matches.size()) {
-            LogVerbose(OT_METHOD)(__func__)(": ")(name_)(" GCS for block ")(
-                blockHash->asHex())(" at height ")(
-                i)(" matches at least one of the ")(patterns.size())(
-                " target elements for ")(id_)
-                .Flush();
-            const auto [untested, retest] = get_block_targets(blockHash, utxos);
-            matches = filter.Match(retest);
-            LogVerbose(OT_METHOD)(__func__)(": ")(name_)(" ")(matches.size())(
-                " of ")(size)(" matches are new")
-                .Flush();
+        OT_ASSERT(loaded.size() == hashes.size());
+
+        for (auto j = std::size_t{0}; j < hashes.size(); ++j, ++height) {
+            const auto& blockHash = hashes.at(j);
+            auto& pFilter = loaded.at(j);
+
+            if (false == bool(pFilter)) {
+                // NOTE resets the filter tip if the filter is really missing
+                pFilter = filters.LoadFilterOrResetTip(
+                    filter_type_, block::Position{height, blockHash});
+            }
+
+            if (false == bool(pFilter)) {
+                LogVerbose(OT_METHOD)(__func__)(": ")(name_)(
+                    " filter at height ")(height)(" not found ")
+                    .Flush();
+                interrupted = true;
+
+                break;
+            }
+
+            atLeastOnce = true;
+            highestTested.first = height;
+            highestTested.second = blockHash;
+            const auto& filter = *pFilter;
+            auto matches = filter.Match(patterns);
+            const auto size{matches.size()};
 
             if (0 < matches.size()) {
-                cache.emplace_back(std::move(blockHash));
+                LogVerbose(OT_METHOD)(__func__)(": ")(name_)(
+                    " GCS for block ")(blockHash->asHex())(" at height ")(
+                    height)(" matches at least one of the ")(patterns.size())(
+                    " target elements for ")(id_)
+                    .Flush();
+                const auto [untested, retest] =
+                    get_block_targets(blockHash, utxos);
+                matches = filter.Match(retest);
+                LogVerbose(OT_METHOD)(__func__)(": ")(name_)(" ")(
+                    matches.size())(" of ")(size)(" matches are new")
+                    .Flush();
+
+                if (0 < matches.size()) { cache.emplace_back(blockHash); }
             }
         }
     }
@@ -700,19 +931,9 @@ auto SubchainStateData::state_machine(bool enabled) noexcept -> bool
         return false;
     }
 
-    if (enabled) {
-        if (check_reorg()) { return false; }
-        if (check_blocks()) { return false; }
-    }
-
-    if (check_index()) { return false; }
-
-    check_mempool();
-
-    if (enabled) {
-        if (check_scan()) { return false; }
-        if (check_process()) { return false; }
-    }
+    events_.Run(enabled, [this](const auto type, const auto posted) {
+        return handle(type, posted);
+    });
 
     return false;
 }
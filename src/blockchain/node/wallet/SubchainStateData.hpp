@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -134,6 +138,53 @@ public:
         std::queue<block::Position> parents_{};
     };
 
+    // NOTE each event advances exactly one phase of the state machine
+    enum class Event : std::size_t {
+        reorg = 0,    // check_reorg
+        blocks = 1,   // check_blocks
+        key = 2,      // check_index
+        mempool = 3,  // check_mempool
+        filter = 4,   // check_scan
+        block = 5,    // check_process
+    };
+
+    struct EventQueue {
+        using Handler =
+            std::function<bool(const Event type, const Time posted)>;
+
+        struct Stats {
+            std::size_t count_{};
+            std::chrono::microseconds total_{};
+            std::chrono::microseconds max_{};
+        };
+
+        auto Pending() const noexcept -> bool;
+        auto Statistics(const Event type) const noexcept -> Stats;
+
+        auto Post(const Event type) noexcept -> void;
+        auto Record(const Event type, const Time posted) noexcept
+            -> std::chrono::microseconds;
+        // Takes each pending event in state machine order and passes it to
+        // the handler, stopping after the first handler which returns true.
+        // Events which require network activity stay pending while the
+        // chain is not enabled.
+        auto Run(const bool enabled, const Handler& handler) noexcept
+            -> void;
+        auto Take(const Event type) noexcept -> std::optional<Time>;
+
+        // NOTE every event starts out pending so that the first pass
+        // performs a full check of the subchain
+        EventQueue() noexcept;
+
+    private:
+        static constexpr auto count_ = std::size_t{6};
+
+        mutable std::mutex lock_;
+        std::atomic<bool> pending_;
+        std::array<std::optional<Time>, count_> posted_;
+        std::array<Stats, count_> stats_;
+    };
+
     const OTNymID owner_;
     const crypto::SubaccountType account_type_;
     const OTIdentifier id_;
@@ -145,6 +196,7 @@ public:
     std::atomic<bool> running_;
     MempoolQueue mempool_;
     ReorgQueue reorg_;
+    EventQueue events_;
     std::optional<Bip32Index> last_indexed_;
     std::optional<block::Position> last_scanned_;
     std::vector<block::pHash> blocks_to_request_;
@@ -214,6 +266,8 @@ protected:
 private:
     block::Position last_reported_;
 
+    static auto print(const Event type) noexcept -> const char*;
+
     auto get_targets(
         const Patterns& elements,
         const std::vector<WalletDatabase::UTXO>& utxos,
@@ -231,6 +285,7 @@ private:
     auto check_process() noexcept -> bool;
     auto check_reorg() noexcept -> bool;
     auto check_scan() noexcept -> bool;
+    auto handle(const Event type, const Time posted) noexcept -> bool;
     virtual auto handle_confirmed_matches(
         const block::bitcoin::Block& block,
         const block::Position& position,
@@ -23,9 +23,12 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/core/Flag.hpp"
+#include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -76,6 +79,8 @@ Wallet::Wallet(
         shutdown,
         api.Endpoints().BlockchainReorg(),
         api.Endpoints().NymCreated(),
+        api.Endpoints().BlockchainAccountCreated(),
+        api.Endpoints().BlockchainBlockDownloadQueue(),
         api.Endpoints().InternalBlockchainFilterUpdated(chain),
         crypto_.KeyEndpoint(),
         api.Endpoints().BlockchainMempool(),
@@ -192,10 +197,24 @@ auto Wallet::pipeline(const zmq::Message& in) noexcept -> void
             OT_ASSERT(1 < body.size());
 
             accounts_.Add(body.at(1));
-            [[fallthrough]];
-        }
-        case Work::key:
-        case Work::filter:
+            do_work();
+        } break;
+        case Work::account: {
+            process_account(in);
+            do_work();
+        } break;
+        case Work::download: {
+            process_download(in);
+            do_work();
+        } break;
+        case Work::key: {
+            process_key(in);
+            do_work();
+        } break;
+        case Work::filter: {
+            process_filter(in);
+            do_work();
+        } break;
         case Work::statemachine: {
             do_work();
         } break;
@@ -207,6 +226,80 @@ auto Wallet::pipeline(const zmq::Message& in) noexcept -> void
     }
 }
 
+auto Wallet::process_account(const zmq::Message& in) noexcept -> void
+{
+    const auto body = in.Body();
+
+    if (5 > body.size()) {
+        LogOutput(OT_METHOD)(__func__)(": Invalid message").Flush();
+
+        OT_FAIL;
+    }
+
+    const auto chain = body.at(1).as<blockchain::Type>();
+
+    if (chain_ != chain) { return; }
+
+    auto owner = api_.Factory().NymID();
+    owner->Assign(body.at(2).Bytes());
+
+    if (owner->empty()) { return; }
+
+    accounts_.NewSubaccount(owner);
+}
+
+auto Wallet::process_download(const zmq::Message& in) noexcept -> void
+{
+    const auto body = in.Body();
+
+    if (2 > body.size()) {
+        LogOutput(OT_METHOD)(__func__)(": Invalid message").Flush();
+
+        OT_FAIL;
+    }
+
+    const auto chain = body.at(1).as<blockchain::Type>();
+
+    if (chain_ != chain) { return; }
+
+    accounts_.BlockDownloaded();
+}
+
+auto Wallet::process_filter(const zmq::Message& in) noexcept -> void
+{
+    const auto body = in.Body();
+
+    if (2 > body.size()) {
+        LogOutput(OT_METHOD)(__func__)(": Invalid message").Flush();
+
+        OT_FAIL;
+    }
+
+    accounts_.FilterTip(body.at(1).as<filter::Type>());
+}
+
+auto Wallet::process_key(const zmq::Message& in) noexcept -> void
+{
+    const auto body = in.Body();
+
+    if (3 > body.size()) {
+        LogOutput(OT_METHOD)(__func__)(": Invalid message").Flush();
+
+        OT_FAIL;
+    }
+
+    const auto chain = body.at(1).as<blockchain::Type>();
+
+    if (chain_ != chain) { return; }
+
+    auto account = api_.Factory().Identifier();
+    account->Assign(body.at(2).Bytes());
+
+    if (account->empty()) { return; }
+
+    accounts_.KeyGenerated(account);
+}
+
 auto Wallet::process_mempool(const zmq::Message& in) noexcept -> void
 {
     const auto body = in.Body();
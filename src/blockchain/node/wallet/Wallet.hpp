@@ -146,6 +146,8 @@ private:
     enum class Work : OTZMQWorkType {
         shutdown = value(WorkType::Shutdown),
         nym = value(WorkType::NymCreated),
+        account = value(WorkType::BlockchainAccountCreated),
+        download = value(WorkType::BlockchainBlockDownloadQueue),
         block = value(WorkType::BlockchainNewHeader),
         reorg = value(WorkType::BlockchainReorg),
         mempool = value(WorkType::BlockchainMempoolUpdated),
@@ -168,6 +170,10 @@ private:
 
     auto convert(const DBUTXOs& in) const noexcept -> std::vector<UTXO>;
     auto pipeline(const zmq::Message& in) noexcept -> void;
+    auto process_account(const zmq::Message& in) noexcept -> void;
+    auto process_download(const zmq::Message& in) noexcept -> void;
+    auto process_filter(const zmq::Message& in) noexcept -> void;
+    auto process_key(const zmq::Message& in) noexcept -> void;
     auto process_mempool(const zmq::Message& in) noexcept -> void;
     auto process_reorg(const zmq::Message& in) noexcept -> void;
     auto shutdown(std::promise<void>& promise) noexcept -> void;
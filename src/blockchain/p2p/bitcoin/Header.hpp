@@ -60,6 +60,7 @@ public:
 
         BitcoinFormat(const Data& in) noexcept(false);
         BitcoinFormat(const zmq::Frame& in) noexcept(false);
+        BitcoinFormat(const ReadView in) noexcept(false);
         BitcoinFormat(
             const blockchain::Type network,
             const bitcoin::Command command,
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iterator>
 #include <stdexcept>
 #include <tuple>
@@ -295,7 +296,7 @@ auto Peer::broadcast_transaction(zmq::Message& in) noexcept -> void
     send(msg.Encode());
 }
 
-auto Peer::get_body_size(const zmq::Frame& header) const noexcept -> std::size_t
+auto Peer::get_body_size(const ReadView header) const noexcept -> std::size_t
 {
     OT_ASSERT(HeaderType::Size() == header.size());
 
@@ -917,10 +918,13 @@ auto Peer::process_getcfheaders(
     const auto previous = fromGenesis ? ReadView{blank.data(), blank.size()}
                                       : previousHeader->Bytes();
 
-    for (auto i{start}; i < blocks.size(); ++i) {
-        const auto& blockHash = blocks.at(i);
-        const auto pFilter = fOracle.LoadFilter(filterType, blockHash);
+    const auto filters = fOracle.LoadFilters(
+        filterType,
+        std::vector<block::pHash>{
+            std::next(blocks.begin(), static_cast<std::ptrdiff_t>(start)),
+            blocks.end()});
 
+    for (const auto& pFilter : filters) {
         if (false == bool(pFilter)) { break; }
 
         const auto& filter = *pFilter;
@@ -1008,17 +1012,12 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    auto data = std::vector<std::unique_ptr<const node::GCS>>{};
-    data.reserve(count);
-    const auto& filters = network_.FilterOracle();
     const auto type = message.Type();
     const auto hashes = headers_.BestHashes(startHeight, stopHash);
-
-    for (const auto& hash : hashes) {
-        const auto& pGCS = data.emplace_back(filters.LoadFilter(type, hash));
-
-        if (!pGCS) { break; }
-    }
+    auto data = network_.FilterOracleInternal().LoadFilters(type, hashes);
+    const auto missing = std::find_if(
+        data.begin(), data.end(), [](const auto& pGCS) { return !pGCS; });
+    data.erase(missing, data.end());
 
     if (data.size() != count) {
         LogOutput(OT_METHOD)(__func__)(
@@ -1396,14 +1395,25 @@ auto Peer::process_message(const zmq::Message& message) noexcept -> void
 
     const auto body = message.Body();
 
-    if (3 > body.size()) {
+    if ((3 > body.size()) || (0 == (body.size() % 2))) {
         LogOutput(OT_METHOD)(__func__)(": Invalid message").Flush();
 
         OT_FAIL;
     }
 
-    const auto& headerBytes = body.at(1);
-    const auto& payloadBytes = body.at(2);
+    // NOTE the connection manager may deliver several messages at once as
+    // consecutive header / payload frame pairs
+    for (auto i = std::size_t{1}; i < body.size(); i += 2) {
+        if (false == running_.get()) { return; }
+
+        if (false == process_message(body.at(i), body.at(i + 1))) { return; }
+    }
+}
+
+auto Peer::process_message(
+    const zmq::Frame& headerBytes,
+    const zmq::Frame& payloadBytes) noexcept -> bool
+{
     auto pHeader = std::unique_ptr<HeaderType>{
         factory::BitcoinP2PHeader(api_, headerBytes)};
 
@@ -1413,7 +1423,7 @@ auto Peer::process_message(const zmq::Message& message) noexcept -> void
             .Flush();
         disconnect();
 
-        return;
+        return false;
     }
 
     auto& header = *pHeader;
@@ -1424,7 +1434,7 @@ auto Peer::process_message(const zmq::Message& message) noexcept -> void
             .Flush();
         disconnect();
 
-        return;
+        return false;
     }
 
     const auto command = header.Command();
@@ -1435,7 +1445,7 @@ auto Peer::process_message(const zmq::Message& message) noexcept -> void
             .Flush();
         disconnect();
 
-        return;
+        return false;
     }
 
     LogVerbose(OT_METHOD)(__func__)(": Received ")(DisplayString(chain_))(" ")(
@@ -1452,9 +1462,9 @@ auto Peer::process_message(const zmq::Message& message) noexcept -> void
         LogOutput(OT_METHOD)(__func__)(": No handler for command ")(
             unknown->str())
             .Flush();
-
-        return;
     }
+
+    return true;
 }
 
 auto Peer::process_notfound(
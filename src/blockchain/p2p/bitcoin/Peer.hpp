@@ -163,7 +163,7 @@ private:
 
     auto broadcast_inv(
         std::vector<blockchain::bitcoin::Inventory>&& inv) noexcept -> void;
-    auto get_body_size(const zmq::Frame& header) const noexcept
+    auto get_body_size(const ReadView header) const noexcept
         -> std::size_t final;
 
     auto broadcast_block(zmq::Message& message) noexcept -> void final;
@@ -172,6 +172,9 @@ private:
     auto ping() noexcept -> void final;
     auto pong() noexcept -> void final;
     auto process_message(const zmq::Message& message) noexcept -> void final;
+    auto process_message(
+        const zmq::Frame& headerBytes,
+        const zmq::Frame& payloadBytes) noexcept -> bool;
     auto reconcile_mempool() noexcept -> void;
     auto request_addresses() noexcept -> void final;
     auto request_block(zmq::Message& message) noexcept -> void final;
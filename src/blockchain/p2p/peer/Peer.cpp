@@ -625,10 +625,10 @@ auto Peer::transmit(zmq::Message& message) noexcept -> void
     auto success = bool{false};
     auto postcondition =
         ScopeGuard{[&] { send_promises_.SetPromise(index, success); }};
-    LogTrace(OT_METHOD)(__func__)(": Sending ")(payload.size())(
+    OT_LOG_TRACE(OT_METHOD)(__func__)(": Sending ")(payload.size())(
         " byte message:")
         .Flush();
-    LogTrace(Data::Factory(payload)->asHex()).Flush();
+    OT_LOG_TRACE(Data::Factory(payload)->asHex()).Flush();
     auto promise = std::make_unique<SendPromise>();
 
     OT_ASSERT(promise);
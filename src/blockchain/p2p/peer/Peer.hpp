@@ -183,7 +183,7 @@ public:
     {
         return state_.connect_.future_;
     }
-    virtual auto get_body_size(const zmq::Frame& header) const noexcept
+    virtual auto get_body_size(const ReadView header) const noexcept
         -> std::size_t = 0;
     auto HandshakeComplete() const noexcept -> Handshake final
     {
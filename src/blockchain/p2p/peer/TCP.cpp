@@ -8,11 +8,13 @@
 #include "blockchain/p2p/peer/Peer.hpp"  // IWYU pragma: associated
 
 #include <boost/asio.hpp>
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <vector>
 
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
-#include "opentxs/api/Factory.hpp"
 #include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/core/Flag.hpp"
@@ -28,6 +30,10 @@
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/util/WorkType.hpp"
 
+// NOTE the receive buffer is refilled in chunks of at least this size so that
+// a burst of small messages is delivered to the framer by a single read
+#define OT_BLOCKCHAIN_PEER_READ_BYTES 65536
+
 #define OT_METHOD                                                              \
     "opentxs::blockchain::p2p::implementation::TCPConnectionManager::"
 
@@ -45,7 +51,7 @@ struct TCPConnectionManager : virtual public Peer::ConnectionManager {
     const std::size_t header_bytes_;
     std::promise<void> connection_id_promise_;
     network::asio::Socket socket_;
-    OTData header_;
+    Space rx_buffer_;
     OTZMQListenCallback cb_;
     OTZMQDealerSocket dealer_;
 
@@ -142,29 +148,15 @@ struct TCPConnectionManager : virtual public Peer::ConnectionManager {
             case Peer::Task::Disconnect: {
                 parent_.on_pipeline(Peer::Task::Disconnect, {});
             } break;
-            case Peer::Task::Header: {
+            case Peer::Task::Stream: {
                 OT_ASSERT(1 < body.size());
 
-                const auto& messageHeader = body.at(1);
-                const auto size = parent_.get_body_size(messageHeader);
-
-                if (0 < size) {
-                    header_->Assign(messageHeader.Bytes());
-                    receive(static_cast<OTZMQWorkType>(Peer::Task::Body), size);
-                    parent_.on_pipeline(Peer::Task::Header, {});
-                } else {
-                    parent_.on_pipeline(
-                        Peer::Task::ReceiveMessage,
-                        {messageHeader.Bytes(), {}});
-                    run();
-                }
-            } break;
-            case Peer::Task::Body: {
-                OT_ASSERT(1 < body.size());
-
-                parent_.on_pipeline(
-                    Peer::Task::ReceiveMessage,
-                    {header_->Bytes(), body.at(1).Bytes()});
+                const auto bytes = body.at(1).Bytes();
+                rx_buffer_.insert(
+                    rx_buffer_.end(),
+                    reinterpret_cast<const std::byte*>(bytes.data()),
+                    reinterpret_cast<const std::byte*>(bytes.data()) +
+                        bytes.size());
                 run();
             } break;
             default: {
@@ -172,16 +164,75 @@ struct TCPConnectionManager : virtual public Peer::ConnectionManager {
             }
         }
     }
-    auto receive(const OTZMQWorkType type, const std::size_t bytes) noexcept
-        -> void
+    // Deliver every complete message in the receive buffer as one batch and
+    // return the number of bytes required to complete the next message
+    auto frame() noexcept -> std::size_t
+    {
+        auto batch = std::vector<ReadView>{};
+        auto needed = header_bytes_;
+        auto position = std::size_t{0};
+
+        while (true) {
+            const auto available = rx_buffer_.size() - position;
+
+            if (available < header_bytes_) {
+                needed = header_bytes_ - available;
+
+                break;
+            }
+
+            const auto* start =
+                reinterpret_cast<const char*>(rx_buffer_.data()) + position;
+            const auto header = ReadView{start, header_bytes_};
+            const auto size = parent_.get_body_size(header);
+            const auto total = header_bytes_ + size;
+
+            if (available < total) {
+                needed = total - available;
+
+                break;
+            }
+
+            batch.emplace_back(header);
+            batch.emplace_back(
+                (0 < size) ? ReadView{start + header_bytes_, size}
+                           : ReadView{});
+            position += total;
+        }
+
+        if (0 < batch.size()) {
+            parent_.on_pipeline(Peer::Task::ReceiveMessage, batch);
+        } else if (position < rx_buffer_.size()) {
+            // NOTE a large message is still arriving
+            parent_.on_pipeline(Peer::Task::Header, {});
+        }
+
+        compact(position);
+
+        return needed;
+    }
+    auto compact(const std::size_t consumed) noexcept -> void
     {
-        socket_.Receive(reader(connection_id_), type, bytes);
+        if (0 == consumed) { return; }
+
+        const auto remaining = rx_buffer_.size() - consumed;
+
+        if (0 < remaining) {
+            std::memmove(
+                rx_buffer_.data(), rx_buffer_.data() + consumed, remaining);
+        }
+
+        rx_buffer_.resize(remaining);
     }
     auto run() noexcept -> void
     {
+        const auto needed = frame();
+
         if (running_) {
-            receive(
-                static_cast<OTZMQWorkType>(Peer::Task::Header), header_bytes_);
+            socket_.ReceiveSome(
+                reader(connection_id_),
+                static_cast<OTZMQWorkType>(Peer::Task::Stream),
+                std::max<std::size_t>(needed, OT_BLOCKCHAIN_PEER_READ_BYTES));
         }
     }
     auto shutdown_external() noexcept -> void final { socket_.Close(); }
@@ -208,9 +259,9 @@ struct TCPConnectionManager : virtual public Peer::ConnectionManager {
         , header_bytes_(headerSize)
         , connection_id_promise_()
         , socket_(api_.Network().Asio().MakeSocket(endpoint_))
-        , header_([&] {
-            auto out = api_.Factory().Data();
-            out->SetSize(headerSize);
+        , rx_buffer_([&] {
+            auto out = Space{};
+            out.reserve(OT_BLOCKCHAIN_PEER_READ_BYTES);
 
             return out;
         }())
@@ -265,9 +316,9 @@ protected:
         , header_bytes_(headerSize)
         , connection_id_promise_()
         , socket_(std::move(socket))
-        , header_([&] {
-            auto out = api_.Factory().Data();
-            out->SetSize(headerSize);
+        , rx_buffer_([&] {
+            auto out = Space{};
+            out.reserve(OT_BLOCKCHAIN_PEER_READ_BYTES);
 
             return out;
         }())
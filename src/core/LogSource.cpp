@@ -11,8 +11,13 @@
 #include <chrono>
 #include <cstdlib>
 #include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <thread>
+#include <utility>
 
 #include "opentxs/OT.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -45,10 +50,72 @@ auto stack_trace() noexcept -> std::string
     return output.str();
 }
 
+struct LogSource::Buffers {
+    std::mutex lock_{};
+    std::map<const Buffer*, std::shared_ptr<Buffer>> map_{};
+};
+
+struct LogSource::Buffer {
+    // Owns the buffer of the current thread and releases it when the thread
+    // exits. Shutdown only closes the socket so the buffer stays valid for
+    // as long as its thread might still be using it.
+    struct Handle {
+        std::shared_ptr<Buffer> buffer_{};
+
+        ~Handle()
+        {
+            if (false == bool(buffer_)) { return; }
+
+            auto& buffers = LogSource::buffers();
+            Lock lock(buffers.lock_);
+            buffers.map_.erase(buffer_.get());
+        }
+    };
+
+    const std::string id_;
+    std::stringstream text_;
+
+    auto Close() noexcept -> void
+    {
+        Lock lock(lock_);
+        socket_.reset();
+    }
+    auto Reset() noexcept -> void
+    {
+        text_.str({});
+        text_.clear();
+    }
+    auto Send(zmq::Message& message) noexcept -> bool
+    {
+        Lock lock(lock_);
+
+        if (false == socket_.has_value()) { return false; }
+
+        return socket_.value()->Send(message);
+    }
+
+    Buffer() noexcept
+        : id_([] {
+            auto convert = std::stringstream{};
+            convert << std::hex << std::this_thread::get_id();
+
+            return convert.str();
+        }())
+        , text_()
+        , lock_()
+        , socket_(Context().ZMQ().PushSocket(
+              zmq::socket::Socket::Direction::Connect))
+    {
+        socket_.value()->Start(LOG_SINK);
+    }
+
+private:
+    std::mutex lock_;
+    std::optional<OTZMQPushSocket> socket_;
+};
+
 std::atomic<int> LogSource::verbosity_{0};
 std::atomic<bool> LogSource::running_{true};
-std::mutex LogSource::buffer_lock_{};
-std::map<std::thread::id, LogSource::Source> LogSource::buffer_{};
 
 LogSource::LogSource(const int logLevel) noexcept
     : level_(logLevel)
@@ -67,11 +134,11 @@ auto LogSource::operator()(char* in) const noexcept -> const LogSource&
 
 auto LogSource::operator()(const char* in) const noexcept -> const LogSource&
 {
-    if (verbosity_.load() < level_) { return *this; }
+    if (false == Enabled()) { return *this; }
 
-    std::string id{};
+    auto* buffer = get_buffer();
 
-    if (running_.load()) { std::get<1>(get_buffer(id)) << in; }
+    if (nullptr != buffer) { buffer->text_ << in; }
 
     return *this;
 }
@@ -125,6 +192,8 @@ auto LogSource::operator()(const OTIdentifier& in) const noexcept
 auto LogSource::operator()(const Identifier& in) const noexcept
     -> const LogSource&
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
@@ -136,6 +205,8 @@ auto LogSource::operator()(const OTNymID& in) const noexcept -> const LogSource&
 auto LogSource::operator()(const identifier::Nym& in) const noexcept
     -> const LogSource&
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
@@ -148,6 +219,8 @@ auto LogSource::operator()(const OTServerID& in) const noexcept
 auto LogSource::operator()(const identifier::Server& in) const noexcept
     -> const LogSource&
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
@@ -160,11 +233,15 @@ auto LogSource::operator()(const OTUnitID& in) const noexcept
 auto LogSource::operator()(const identifier::UnitDefinition& in) const noexcept
     -> const LogSource&
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
 auto LogSource::operator()(const Time in) const noexcept -> const LogSource&
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(formatTimestamp(in));
 }
 
@@ -173,61 +250,59 @@ void LogSource::Assert(
     const std::size_t line,
     const char* message) const noexcept
 {
-    {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "OT ASSERT";
+    if (auto* buffer = get_buffer(); nullptr != buffer) {
+        auto& text = buffer->text_;
+        buffer->Reset();
+        text << "OT ASSERT";
 
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
+        if (nullptr != file) { text << " in " << file << " line " << line; }
 
-        if (nullptr != message) { buffer << ": " << message; }
+        if (nullptr != message) { text << ": " << message; }
 
-        buffer << "\n" << boost::stacktrace::stacktrace();
+        text << "\n" << boost::stacktrace::stacktrace();
     }
 
     send(true);
     abort();
 }
 
+// NOTE thread_local handles of threads which exit after static destruction
+// still unregister their buffers, so the registry is intentionally leaked
+auto LogSource::buffers() noexcept -> Buffers&
+{
+    static auto* output = new Buffers{};
+
+    return *output;
+}
+
 void LogSource::Flush() const noexcept { send(false); }
 
-auto LogSource::get_buffer(std::string& out) noexcept -> LogSource::Source&
+// NOTE each thread caches a pointer to its own buffer so the global lock is
+// only taken when a thread logs for the first time or exits
+auto LogSource::get_buffer() noexcept -> LogSource::Buffer*
 {
-    const auto id = std::this_thread::get_id();
-    std::stringstream convert{};
-    convert << std::hex << id;
-    out = convert.str();
-    auto it = buffer_.find(id);
-
-    if (buffer_.end() == it) {
-        Lock lock(buffer_lock_);
-        auto inner = buffer_.emplace(
-            id,
-            Source{
-                Context().ZMQ().PushSocket(
-                    zmq::socket::Socket::Direction::Connect),
-                std::stringstream{}});
-        auto& source = std::get<0>(inner)->second;
-        auto& socket = std::get<0>(source).get();
-        socket.Start(LOG_SINK);
-
-        return source;
+    thread_local auto handle = Buffer::Handle{};
+
+    if (false == running_.load()) { return nullptr; }
+
+    if (false == bool(handle.buffer_)) {
+        handle.buffer_ = std::make_shared<Buffer>();
+        auto& buffers = LogSource::buffers();
+        Lock lock(buffers.lock_);
+        buffers.map_.emplace(handle.buffer_.get(), handle.buffer_);
     }
 
-    return it->second;
+    return handle.buffer_.get();
 }
 
 void LogSource::send(const bool terminate) const noexcept
 {
-    if (running_.load()) {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
+    if (auto* buffer = get_buffer(); nullptr != buffer) {
         auto message = zmq::Message::Factory();
         message->PrependEmptyFrame();
         message->AddFrame(level_);
-        message->AddFrame(buffer.str());
-        message->AddFrame(id);
+        message->AddFrame(buffer->text_.str());
+        message->AddFrame(buffer->id_);
         auto promise = std::promise<void>{};
         auto future = promise.get_future();
         const auto* pPromise = &promise;
@@ -238,8 +313,11 @@ void LogSource::send(const bool terminate) const noexcept
             promise.set_value();
         }
 
-        socket->Send(message);
-        buffer = std::stringstream{};
+        if ((false == buffer->Send(message)) && terminate) {
+            promise.set_value();
+        }
+
+        buffer->Reset();
         future.wait_for(std::chrono::seconds(10));
     }
 
@@ -254,7 +332,14 @@ void LogSource::SetVerbosity(const int level) noexcept
 void LogSource::Shutdown() noexcept
 {
     running_.store(false);
-    buffer_.clear();
+    auto& buffers = LogSource::buffers();
+    Lock lock(buffers.lock_);
+
+    // NOTE threads which passed the running_ check before it was cleared may
+    // still hold their buffer, so only the sockets are released here
+    for (auto& [key, buffer] : buffers.map_) { buffer->Close(); }
+
+    buffers.map_.clear();
 }
 
 auto LogSource::StartLog(
@@ -269,17 +354,16 @@ void LogSource::Trace(
     const std::size_t line,
     const char* message) const noexcept
 {
-    {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "Stack trace requested";
+    if (auto* buffer = get_buffer(); nullptr != buffer) {
+        auto& text = buffer->text_;
+        buffer->Reset();
+        text << "Stack trace requested";
 
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
+        if (nullptr != file) { text << " in " << file << " line " << line; }
 
-        if (nullptr != message) { buffer << ": " << message; }
+        if (nullptr != message) { text << ": " << message; }
 
-        buffer << "\n" << stack_trace();
+        text << "\n" << stack_trace();
     }
 
     send(false);
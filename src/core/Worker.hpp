@@ -9,10 +9,12 @@
 #include <functional>
 #include <future>
 
+#include "internal/api/network/Network.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Log.hpp"
@@ -20,6 +22,7 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
+#include "util/Timer.hpp"
 #include "util/Work.hpp"
 
 namespace opentxs
@@ -63,7 +66,8 @@ protected:
 
     auto do_work() noexcept
     {
-        rate_limit_state_machine();
+        if (rate_limit_state_machine()) { return; }
+
         state_machine_queued_.store(false);
         repeat(downcast().state_machine());
     }
@@ -75,6 +79,7 @@ protected:
     }
     auto stop_worker() noexcept -> std::shared_future<void>
     {
+        rate_limit_timer_.Cancel();
         pipeline_->Close();
 
         if (running_.get()) { downcast().shutdown(shutdown_promise_); }
@@ -92,6 +97,7 @@ protected:
         , shutdown_(shutdown_promise_.get_future())
         , last_executed_(Clock::now())
         , state_machine_queued_(false)
+        , rate_limit_timer_(api.Network().Asio().Internal().GetTimer())
     {
     }
 
@@ -101,13 +107,27 @@ private:
     std::shared_future<void> shutdown_;
     Time last_executed_;
     mutable std::atomic<bool> state_machine_queued_;
+    Timer rate_limit_timer_;
 
-    auto rate_limit_state_machine() const noexcept
+    // NOTE instead of blocking the pipeline thread until the rate limit
+    // expires the state machine signal is deferred with a timer. The queued
+    // flag remains set in the meantime so that triggers are coalesced.
+    auto rate_limit_state_machine() noexcept -> bool
     {
-        const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+        const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
             rate_limit_ - (Clock::now() - last_executed_));
 
-        if (0 < wait.count()) { Sleep(wait); }
+        if (0 >= wait.count()) { return false; }
+
+        rate_limit_timer_.SetRelative(wait);
+        rate_limit_timer_.Wait([this] {
+            if (false == running_.get()) { return; }
+
+            auto work = MakeWork(OT_ZMQ_STATE_MACHINE_SIGNAL);
+            pipeline_->Push(work);
+        });
+
+        return true;
     }
 
     inline auto downcast() noexcept -> Child&
@@ -564,41 +564,49 @@ auto PaymentCode::DecodeNotificationElements(
     }
 }
 
-auto PaymentCode::derive_keys(
-    const opentxs::PaymentCode& other,
-    const Bip32Index local,
-    const Bip32Index remote,
-    const PasswordPrompt& reason) const noexcept(false)
-    -> std::pair<ECKey, ECKey>
+auto PaymentCode::derive_local(
+    const Bip32Index index,
+    const PasswordPrompt& reason) const noexcept(false) -> ECKey
 {
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
-    auto output = std::pair<ECKey, ECKey>{};
-    auto& [localPrivate, remotePublic] = output;
-
-    if (key_) {
-        localPrivate = key_->ChildKey(local, reason);
-
-        if (!localPrivate) {
-            throw std::runtime_error("Failed to derive local private key");
-        }
-    } else {
+    if (false == bool(key_)) {
         throw std::runtime_error("Failed to obtain local hd key");
     }
 
-    if (const auto pKey = other.Key(); pKey) {
-        const auto& key = *pKey;
+    auto output = key_->ChildKey(index, reason);
 
-        OT_ASSERT(0 < key.Chaincode(reason).size());
+    if (!output) {
+        throw std::runtime_error("Failed to derive local private key");
+    }
 
-        remotePublic = key.ChildKey(remote, reason);
+    return output;
+#else
+    throw std::runtime_error("Missing secp256k1 support");
+#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+}
 
-        if (!remotePublic) {
-            throw std::runtime_error("Failed to derive remote public key");
-        }
-    } else {
+auto PaymentCode::derive_remote(
+    const opentxs::PaymentCode& other,
+    const Bip32Index index,
+    const PasswordPrompt& reason) const noexcept(false) -> ECKey
+{
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    const auto pKey = other.Key();
+
+    if (false == bool(pKey)) {
         throw std::runtime_error("Failed to obtain remote hd key");
     }
 
+    const auto& key = *pKey;
+
+    OT_ASSERT(0 < key.Chaincode(reason).size());
+
+    auto output = key.ChildKey(index, reason);
+
+    if (!output) {
+        throw std::runtime_error("Failed to derive remote public key");
+    }
+
     return output;
 #else
     throw std::runtime_error("Missing secp256k1 support");
@@ -738,38 +746,46 @@ auto PaymentCode::Incoming(
     const PasswordPrompt& reason,
     const std::uint8_t version) const noexcept -> ECKey
 {
-    try {
-        const auto effective = effective_version(version);
-        const auto [pPrivate, pPublic] = derive_keys(sender, index, 0, reason);
-        const auto& localPrivate = *pPrivate;
-        const auto& remotePublic = *pPublic;
+    auto keys = Incoming(sender, index, 1u, chain, reason, version);
 
-        switch (effective) {
-            case 1:
-            case 2: {
-                const auto secret = shared_secret_payment_v1(
-                    localPrivate, remotePublic, reason);
+    if (1u != keys.size()) { return {}; }
 
-                return localPrivate.IncrementPrivate(secret, reason);
-            }
-            case 3: {
-                const auto secret = shared_secret_payment_v3(
-                    localPrivate, remotePublic, chain, reason);
+    return std::move(keys.front());
+}
 
-                return localPrivate.IncrementPrivate(secret, reason);
-            }
-            default: {
-                const auto error = std::string{"Unsupported version "} +
-                                   std::to_string(effective);
+auto PaymentCode::Incoming(
+    const opentxs::PaymentCode& sender,
+    const Bip32Index first,
+    const std::size_t count,
+    const blockchain::Type chain,
+    const PasswordPrompt& reason,
+    const std::uint8_t version) const noexcept -> std::vector<ECKey>
+{
+    auto output = std::vector<ECKey>{};
 
-                throw std::runtime_error{error};
-            }
+    try {
+        const auto effective = effective_version(version);
+        // NOTE the sender's notification key is the same for every index so
+        // it is only derived once per batch
+        const auto pPublic = derive_remote(sender, 0, reason);
+        const auto& remotePublic = *pPublic;
+        output.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto index = static_cast<Bip32Index>(first + i);
+            const auto pPrivate = derive_local(index, reason);
+            const auto& localPrivate = *pPrivate;
+            const auto secret = shared_secret_payment(
+                effective, localPrivate, remotePublic, chain, reason);
+            output.emplace_back(localPrivate.IncrementPrivate(secret, reason));
         }
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
 
         return {};
     }
+
+    return output;
 }
 
 auto PaymentCode::Key() const noexcept -> HDKey
@@ -885,43 +901,50 @@ auto PaymentCode::Outgoing(
     const PasswordPrompt& reason,
     const std::uint8_t version) const noexcept -> ECKey
 {
+    auto keys = Outgoing(recipient, index, 1u, chain, reason, version);
+
+    if (1u != keys.size()) { return {}; }
+
+    return std::move(keys.front());
+}
+
+auto PaymentCode::Outgoing(
+    const opentxs::PaymentCode& recipient,
+    const Bip32Index first,
+    const std::size_t count,
+    const blockchain::Type chain,
+    const PasswordPrompt& reason,
+    const std::uint8_t version) const noexcept -> std::vector<ECKey>
+{
+    auto output = std::vector<ECKey>{};
+
     try {
         if (false == key_->HasPrivate()) {
             throw std::runtime_error{"Private key missing"};
         }
 
         const auto effective = effective_version(version, recipient.Version());
-        const auto [pPrivate, pPublic] =
-            derive_keys(recipient, 0, index, reason);
+        // NOTE the local notification key is the same for every index so it is
+        // only derived once per batch
+        const auto pPrivate = derive_local(0, reason);
         const auto& localPrivate = *pPrivate;
-        const auto& remotePublic = *pPublic;
-
-        switch (effective) {
-            case 1:
-            case 2: {
-                const auto secret = shared_secret_payment_v1(
-                    localPrivate, remotePublic, reason);
-
-                return remotePublic.IncrementPublic(secret);
-            }
-            case 3: {
-                const auto secret = shared_secret_payment_v3(
-                    localPrivate, remotePublic, chain, reason);
-
-                return remotePublic.IncrementPublic(secret);
-            }
-            default: {
-                const auto error = std::string{"Unsupported version "} +
-                                   std::to_string(effective);
-
-                throw std::runtime_error{error};
-            }
+        output.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto index = static_cast<Bip32Index>(first + i);
+            const auto pPublic = derive_remote(recipient, index, reason);
+            const auto& remotePublic = *pPublic;
+            const auto secret = shared_secret_payment(
+                effective, localPrivate, remotePublic, chain, reason);
+            output.emplace_back(remotePublic.IncrementPublic(secret));
         }
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
 
         return {};
     }
+
+    return output;
 }
 
 auto PaymentCode::postprocess(const Secret& in) const noexcept(false)
@@ -978,6 +1001,30 @@ auto PaymentCode::shared_secret_mask_v1(
     return output;
 }
 
+auto PaymentCode::shared_secret_payment(
+    const VersionType version,
+    const crypto::key::EllipticCurve& local,
+    const crypto::key::EllipticCurve& remote,
+    const blockchain::Type chain,
+    const PasswordPrompt& reason) const noexcept(false) -> OTSecret
+{
+    switch (version) {
+        case 1:
+        case 2: {
+            return shared_secret_payment_v1(local, remote, reason);
+        }
+        case 3: {
+            return shared_secret_payment_v3(local, remote, chain, reason);
+        }
+        default: {
+            const auto error =
+                std::string{"Unsupported version "} + std::to_string(version);
+
+            throw std::runtime_error{error};
+        }
+    }
+}
+
 auto PaymentCode::shared_secret_payment_v1(
     const crypto::key::EllipticCurve& local,
     const crypto::key::EllipticCurve& remote,
@@ -14,6 +14,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Types.hpp"
@@ -286,6 +287,14 @@ public:
         const blockchain::Type chain,
         const PasswordPrompt& reason,
         const std::uint8_t version) const noexcept -> ECKey final;
+    auto Incoming(
+        const opentxs::PaymentCode& sender,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version) const noexcept
+        -> std::vector<ECKey> final;
     auto Key() const noexcept -> HDKey final;
     auto Locator(const AllocateOutput destination, const std::uint8_t version)
         const noexcept -> bool final;
@@ -295,6 +304,14 @@ public:
         const blockchain::Type chain,
         const PasswordPrompt& reason,
         const std::uint8_t version) const noexcept -> ECKey final;
+    auto Outgoing(
+        const opentxs::PaymentCode& recipient,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version) const noexcept
+        -> std::vector<ECKey> final;
     auto Serialize(AllocateOutput destination) const noexcept -> bool final;
     auto Serialize(Serialized& serialized) const noexcept -> bool final;
     auto Sign(
@@ -391,12 +408,12 @@ private:
     {
         return new PaymentCode(*this);
     }
-    auto derive_keys(
+    auto derive_local(const Bip32Index index, const PasswordPrompt& reason)
+        const noexcept(false) -> ECKey;
+    auto derive_remote(
         const opentxs::PaymentCode& other,
-        const Bip32Index local,
-        const Bip32Index remote,
-        const PasswordPrompt& reason) const noexcept(false)
-        -> std::pair<ECKey, ECKey>;
+        const Bip32Index index,
+        const PasswordPrompt& reason) const noexcept(false) -> ECKey;
     auto effective_version(VersionType in) const noexcept(false) -> VersionType
     {
         return effective_version(in, version_);
@@ -425,6 +442,12 @@ private:
         const crypto::key::EllipticCurve& remote,
         const blockchain::Type chain,
         const PasswordPrompt& reason) const noexcept(false) -> OTSecret;
+    auto shared_secret_payment(
+        const VersionType version,
+        const crypto::key::EllipticCurve& local,
+        const crypto::key::EllipticCurve& remote,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason) const noexcept(false) -> OTSecret;
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
     auto unblind_v1(
         const ReadView in,
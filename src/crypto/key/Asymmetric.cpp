@@ -43,7 +43,6 @@
 #include "opentxs/protobuf/Ciphertext.pb.h"
 #include "opentxs/protobuf/Enums.pb.h"
 #include "opentxs/protobuf/Signature.pb.h"
-#include "util/Container.hpp"
 
 template class opentxs::Pimpl<opentxs::crypto::key::Asymmetric>;
 
@@ -567,27 +566,6 @@ auto Asymmetric::has_private(const Lock&) const noexcept -> bool
     return has_private_;
 }
 
-auto Asymmetric::hashtype_map() noexcept -> const HashTypeMap&
-{
-    static const auto map = HashTypeMap{
-        {crypto::HashType::Error, proto::HASHTYPE_ERROR},
-        {crypto::HashType::None, proto::HASHTYPE_NONE},
-        {crypto::HashType::Sha256, proto::HASHTYPE_SHA256},
-        {crypto::HashType::Sha512, proto::HASHTYPE_SHA512},
-        {crypto::HashType::Blake2b160, proto::HASHTYPE_BLAKE2B160},
-        {crypto::HashType::Blake2b256, proto::HASHTYPE_BLAKE2B256},
-        {crypto::HashType::Blake2b512, proto::HASHTYPE_BLAKE2B512},
-        {crypto::HashType::Ripemd160, proto::HASHTYPE_RIPEMD160},
-        {crypto::HashType::Sha1, proto::HASHTYPE_SHA1},
-        {crypto::HashType::Sha256D, proto::HASHTYPE_SHA256D},
-        {crypto::HashType::Sha256DC, proto::HASHTYPE_SHA256DC},
-        {crypto::HashType::Bitcoin, proto::HASHTYPE_BITCOIN},
-        {crypto::HashType::SipHash24, proto::HASHTYPE_SIPHASH24},
-    };
-
-    return map;
-}
-
 auto Asymmetric::NewSignature(
     const Identifier& credentialID,
     const crypto::SignatureRole role,
@@ -598,8 +576,8 @@ auto Asymmetric::NewSignature(
     output.set_credentialid(credentialID.str());
     output.set_role(translate(role));
     output.set_hashtype(
-        (crypto::HashType::Error == hash) ? translate(SigHashType())
-                                          : translate(hash));
+        opentxs::crypto::key::internal::translate(
+            (crypto::HashType::Error == hash) ? SigHashType() : hash));
     output.clear_signature();
 
     return output;
@@ -752,31 +730,6 @@ auto Asymmetric::translate(const crypto::SignatureRole in) noexcept
     }
 }
 
-auto Asymmetric::translate(const crypto::HashType in) noexcept
-    -> proto::HashType
-{
-    try {
-        return hashtype_map().at(in);
-    } catch (...) {
-        return proto::HASHTYPE_ERROR;
-    }
-}
-
-auto Asymmetric::translate(const proto::HashType in) noexcept
-    -> crypto::HashType
-{
-    static const auto map = reverse_arbitrary_map<
-        crypto::HashType,
-        proto::HashType,
-        HashTypeReverseMap>(hashtype_map());
-
-    try {
-        return map.at(in);
-    } catch (...) {
-        return crypto::HashType::Error;
-    }
-}
-
 auto Asymmetric::TransportKey(
     Data& publicKey,
     Secret& privateKey,
@@ -805,7 +758,7 @@ auto Asymmetric::Verify(const Data& plaintext, const proto::Signature& sig)
         plaintext.Bytes(),
         PublicKey(),
         sig.signature(),
-        translate(sig.hashtype()));
+        opentxs::crypto::key::internal::translate(sig.hashtype()));
 
     if (false == output) {
         LogOutput(OT_METHOD)(__func__)(": Invalid signature").Flush();
@@ -239,8 +239,6 @@ protected:
         OTSecret&& newSecretKey) noexcept;
 
 private:
-    using HashTypeMap = std::map<crypto::HashType, proto::HashType>;
-    using HashTypeReverseMap = std::map<proto::HashType, crypto::HashType>;
     using SignatureRoleMap =
         std::map<crypto::SignatureRole, proto::SignatureRole>;
 
@@ -253,14 +251,9 @@ private:
 
     auto SerializeKeyToData(const proto::AsymmetricKey& rhs) const -> OTData;
 
-    static auto hashtype_map() noexcept -> const HashTypeMap&;
     static auto signaturerole_map() noexcept -> const SignatureRoleMap&;
     static auto translate(const crypto::SignatureRole in) noexcept
         -> proto::SignatureRole;
-    static auto translate(const crypto::HashType in) noexcept
-        -> proto::HashType;
-    static auto translate(const proto::HashType in) noexcept
-        -> crypto::HashType;
 
     auto get_password(
         const Lock& lock,
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"               // IWYU pragma: associated
 #include "internal/crypto/key/Key.hpp"  // IWYU pragma: associated
 
+#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/crypto/key/asymmetric/Algorithm.hpp"
 #include "opentxs/crypto/key/symmetric/Algorithm.hpp"
 #include "opentxs/crypto/key/symmetric/Source.hpp"
@@ -28,6 +29,27 @@ auto asymmetricalgorithm_map() noexcept -> const AsymmetricAlgorithmMap&
     return map;
 }
 
+auto hashtype_map() noexcept -> const HashTypeMap&
+{
+    static const auto map = HashTypeMap{
+        {crypto::HashType::Error, proto::HASHTYPE_ERROR},
+        {crypto::HashType::None, proto::HASHTYPE_NONE},
+        {crypto::HashType::Sha256, proto::HASHTYPE_SHA256},
+        {crypto::HashType::Sha512, proto::HASHTYPE_SHA512},
+        {crypto::HashType::Blake2b160, proto::HASHTYPE_BLAKE2B160},
+        {crypto::HashType::Blake2b256, proto::HASHTYPE_BLAKE2B256},
+        {crypto::HashType::Blake2b512, proto::HASHTYPE_BLAKE2B512},
+        {crypto::HashType::Ripemd160, proto::HASHTYPE_RIPEMD160},
+        {crypto::HashType::Sha1, proto::HASHTYPE_SHA1},
+        {crypto::HashType::Sha256D, proto::HASHTYPE_SHA256D},
+        {crypto::HashType::Sha256DC, proto::HASHTYPE_SHA256DC},
+        {crypto::HashType::Bitcoin, proto::HASHTYPE_BITCOIN},
+        {crypto::HashType::SipHash24, proto::HASHTYPE_SIPHASH24},
+    };
+
+    return map;
+}
+
 auto mode_map() noexcept -> const ModeMap&
 {
     static const auto map = ModeMap{
@@ -102,6 +124,15 @@ auto translate(const asymmetric::Role in) noexcept -> proto::KeyRole
     }
 }
 
+auto translate(const crypto::HashType in) noexcept -> proto::HashType
+{
+    try {
+        return hashtype_map().at(in);
+    } catch (...) {
+        return proto::HASHTYPE_ERROR;
+    }
+}
+
 auto translate(symmetric::Source in) noexcept -> proto::SymmetricKeyType
 {
     try {
@@ -134,6 +165,20 @@ auto translate(proto::AsymmetricKeyType in) noexcept -> asymmetric::Algorithm
     }
 }
 
+auto translate(const proto::HashType in) noexcept -> crypto::HashType
+{
+    static const auto map = reverse_arbitrary_map<
+        crypto::HashType,
+        proto::HashType,
+        HashTypeReverseMap>(hashtype_map());
+
+    try {
+        return map.at(in);
+    } catch (...) {
+        return crypto::HashType::Error;
+    }
+}
+
 auto translate(const proto::KeyMode in) noexcept -> asymmetric::Mode
 {
     static const auto map =
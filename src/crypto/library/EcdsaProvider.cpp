@@ -7,6 +7,10 @@
 #include "1_Internal.hpp"                    // IWYU pragma: associated
 #include "crypto/library/EcdsaProvider.hpp"  // IWYU pragma: associated
 
+#include <cstdint>
+
+#include "util/ParallelFor.hpp"
+
 // #define OT_METHOD "opentxs::crypto::implementation::EcdsaProvider::"
 
 namespace opentxs::crypto::implementation
@@ -15,4 +19,41 @@ EcdsaProvider::EcdsaProvider(const api::Crypto& crypto)
     : crypto_(crypto)
 {
 }
+
+auto EcdsaProvider::verify_batch(
+    const std::size_t count,
+    const Executor& executor,
+    const Chunk& chunk) const noexcept -> std::vector<bool>
+{
+    auto results = std::vector<std::uint8_t>(count, 0);
+    ParallelFor(
+        count,
+        batch_size_,
+        executor,
+        [&](const auto first, const auto last) {
+            chunk(first, last, results);
+        });
+
+    return {results.begin(), results.end()};
+}
+
+auto EcdsaProvider::VerifyBatch(
+    const std::vector<Verification>& items,
+    const crypto::HashType hashType,
+    const Executor& executor) const noexcept -> std::vector<bool>
+{
+    return verify_batch(
+        items.size(),
+        executor,
+        [&](const auto first, const auto last, auto& results) {
+            for (auto i{first}; i < last; ++i) {
+                const auto& [plaintext, key, signature] = items.at(i);
+
+                try {
+                    results.at(i) = Verify(plaintext, key, signature, hashType);
+                } catch (...) {
+                }
+            }
+        });
+}
 }  // namespace opentxs::crypto::implementation
@@ -5,6 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 #include "opentxs/Bytes.hpp"
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/crypto/library/EcdsaProvider.hpp"
@@ -40,12 +45,30 @@ public:
     {
         return false;
     }
+    auto VerifyBatch(
+        const std::vector<Verification>& items,
+        const crypto::HashType hashType,
+        const Executor& executor) const noexcept -> std::vector<bool> override;
 
     ~EcdsaProvider() override = default;
 
 protected:
+    // Verifies items [first, last) and writes one result per item
+    using Chunk = std::function<void(
+        const std::size_t first,
+        const std::size_t last,
+        std::vector<std::uint8_t>& results)>;
+
+    // Number of items verified by a job before it claims more work
+    static constexpr auto batch_size_ = std::size_t{64};
+
     const api::Crypto& crypto_;
 
+    auto verify_batch(
+        const std::size_t count,
+        const Executor& executor,
+        const Chunk& chunk) const noexcept -> std::vector<bool>;
+
     EcdsaProvider(const api::Crypto& crypto);
 
 private:
@@ -0,0 +1,119 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "crypto/library/secp256k1/PubkeyCache.hpp"  // IWYU pragma: associated
+
+extern "C" {
+#include <secp256k1.h>
+}
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::crypto::implementation
+{
+PubkeyCache::PubkeyCache(const std::size_t capacity) noexcept
+    : shard_capacity_(std::max(capacity / shard_count_, std::size_t{1}))
+    , shards_()
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+{
+}
+
+auto PubkeyCache::parse(
+    const secp256k1_context* context,
+    const ReadView bytes) noexcept(false) -> ::secp256k1_pubkey
+{
+    if (nullptr == bytes.data() || 0 == bytes.size()) {
+        throw std::runtime_error("Missing public key");
+    }
+
+    auto output = ::secp256k1_pubkey{};
+
+    if (1 != ::secp256k1_ec_pubkey_parse(
+                 context,
+                 &output,
+                 reinterpret_cast<const unsigned char*>(bytes.data()),
+                 bytes.size())) {
+        throw std::runtime_error("Invalid public key");
+    }
+
+    return output;
+}
+
+auto PubkeyCache::Parse(
+    const secp256k1_context* context,
+    const ReadView bytes) const noexcept(false) -> ::secp256k1_pubkey
+{
+    // NOTE uncompressed keys are cheap to parse and are not cached
+    if (compressed_size_ != bytes.size()) { return parse(context, bytes); }
+
+    auto key = Key{};
+    std::memcpy(key.data(), bytes.data(), key.size());
+    auto& shard = this->shard(key);
+
+    {
+        auto lock = Lock{shard.lock_};
+
+        if (auto it = shard.index_.find(key); shard.index_.end() != it) {
+            // NOTE move the entry to the front of the list
+            shard.lru_.splice(shard.lru_.begin(), shard.lru_, it->second);
+            ++hits_;
+
+            return it->second->second;
+        }
+    }
+
+    ++misses_;
+    const auto output = parse(context, bytes);
+    auto lock = Lock{shard.lock_};
+
+    if (0 < shard.index_.count(key)) { return output; }
+
+    try {
+        shard.lru_.emplace_front(key, output);
+        shard.index_.emplace(key, shard.lru_.begin());
+    } catch (...) {
+
+        return output;
+    }
+
+    while (shard.index_.size() > shard_capacity_) {
+        shard.index_.erase(shard.lru_.back().first);
+        shard.lru_.pop_back();
+        ++evictions_;
+    }
+
+    return output;
+}
+
+auto PubkeyCache::shard(const Key& key) const noexcept -> Shard&
+{
+    return shards_.at(KeyHash{}(key) % shard_count_);
+}
+
+auto PubkeyCache::Statistics() const noexcept -> Stats
+{
+    auto output = Stats{};
+    output.hits_ = hits_.load();
+    output.misses_ = misses_.load();
+    output.evictions_ = evictions_.load();
+    output.capacity_ = shard_capacity_ * shard_count_;
+
+    for (const auto& shard : shards_) {
+        auto lock = Lock{shard.lock_};
+        output.keys_ += shard.index_.size();
+    }
+
+    return output;
+}
+
+PubkeyCache::~PubkeyCache() = default;
+}  // namespace opentxs::crypto::implementation
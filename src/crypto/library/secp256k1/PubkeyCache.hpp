@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+extern "C" {
+#include <secp256k1.h>
+}
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "internal/crypto/library/Secp256k1.hpp"
+#include "opentxs/Bytes.hpp"
+
+namespace opentxs::crypto::implementation
+{
+// Bounded cache of parsed public keys keyed by their compressed
+// serialization. Decompressing a key requires a modular square root, and the
+// same keys are parsed repeatedly by payment code derivation, notification
+// scanning and signature verification.
+class PubkeyCache
+{
+public:
+    using Stats = crypto::Secp256k1::PubkeyCacheStats;
+
+    static constexpr std::size_t compressed_size_{33};
+
+    // Throws std::runtime_error if the key is invalid
+    auto Parse(const secp256k1_context* context, const ReadView bytes) const
+        noexcept(false) -> ::secp256k1_pubkey;
+    auto Statistics() const noexcept -> Stats;
+
+    PubkeyCache(const std::size_t capacity) noexcept;
+
+    ~PubkeyCache();
+
+private:
+    static constexpr std::size_t shard_count_{16};
+
+    using Key = std::array<std::byte, compressed_size_>;
+
+    struct KeyHash {
+        auto operator()(const Key& key) const noexcept -> std::size_t
+        {
+            // NOTE the x coordinate is uniformly distributed
+            auto output = std::size_t{};
+            std::memcpy(&output, std::next(key.data()), sizeof(output));
+
+            return output;
+        }
+    };
+
+    struct Shard {
+        using LRU = std::list<std::pair<Key, ::secp256k1_pubkey>>;
+
+        mutable std::mutex lock_{};
+        mutable LRU lru_{};
+        std::unordered_map<Key, LRU::iterator, KeyHash> index_{};
+    };
+
+    const std::size_t shard_capacity_;
+    mutable std::array<Shard, shard_count_> shards_;
+    mutable std::atomic<std::size_t> hits_;
+    mutable std::atomic<std::size_t> misses_;
+    mutable std::atomic<std::size_t> evictions_;
+
+    static auto parse(const secp256k1_context* context, const ReadView bytes)
+        noexcept(false) -> ::secp256k1_pubkey;
+
+    auto shard(const Key& key) const noexcept -> Shard&;
+
+    PubkeyCache() = delete;
+    PubkeyCache(const PubkeyCache&) = delete;
+    PubkeyCache(PubkeyCache&&) = delete;
+    auto operator=(const PubkeyCache&) -> PubkeyCache& = delete;
+    auto operator=(PubkeyCache&&) -> PubkeyCache& = delete;
+};
+}  // namespace opentxs::crypto::implementation
@@ -19,7 +19,8 @@ extern "C" {
 #include <memory>
 #include <stdexcept>
 #include <string>
-#include <string_view>
+#include <tuple>
+#include <vector>
 
 #include "crypto/library/EcdsaProvider.hpp"
 #include "internal/crypto/library/Factory.hpp"
@@ -33,6 +34,9 @@ extern "C" {
 #include "opentxs/core/Secret.hpp"
 #include "opentxs/crypto/SecretStyle.hpp"
 
+// Maximum number of parsed public keys retained by the cache
+#define OT_SECP256K1_PUBKEY_CACHE_SIZE 16384
+
 #define OT_METHOD "opentxs::crypto::implementation::Secp256k1::"
 
 extern "C" {
@@ -77,6 +81,7 @@ Secp256k1::Secp256k1(
     , context_(secp256k1_context_create(
           SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY))
     , ssl_(ssl)
+    , pubkeys_(OT_SECP256K1_PUBKEY_CACHE_SIZE)
 {
 }
 
@@ -111,19 +116,16 @@ auto Secp256k1::PubkeyAdd(
     }
 
     auto parsed = ::secp256k1_pubkey{};
-    auto rc = 1 == ::secp256k1_ec_pubkey_parse(
-                       context_,
-                       &parsed,
-                       reinterpret_cast<const unsigned char*>(pubkey.data()),
-                       pubkey.size());
 
-    if (false == rc) {
+    try {
+        parsed = parsed_public_key(pubkey);
+    } catch (...) {
         LogOutput(OT_METHOD)(__func__)(": Invalid public key").Flush();
 
         return false;
     }
 
-    rc = 1 == ::secp256k1_ec_pubkey_tweak_add(
+    auto rc = 1 == ::secp256k1_ec_pubkey_tweak_add(
                   context_,
                   &parsed,
                   reinterpret_cast<const unsigned char*>(scalar.data()));
@@ -300,11 +302,9 @@ auto Secp256k1::SharedSecret(
 
     auto key = ::secp256k1_pubkey{};
 
-    if (1 != ::secp256k1_ec_pubkey_parse(
-                 context_,
-                 &key,
-                 reinterpret_cast<const unsigned char*>(pub.data()),
-                 pub.size())) {
+    try {
+        key = parsed_public_key(pub);
+    } catch (...) {
         LogOutput(OT_METHOD)(__func__)(": Invalid public key").Flush();
 
         return false;
@@ -501,6 +501,36 @@ auto Secp256k1::Verify(
     }
 }
 
+auto Secp256k1::VerifyBatch(
+    const std::vector<Verification>& items,
+    const crypto::HashType type,
+    const Executor& executor) const noexcept -> std::vector<bool>
+{
+    return verify_batch(
+        items.size(),
+        executor,
+        [&](const auto first, const auto last, auto& results) {
+            for (auto i{first}; i < last; ++i) {
+                const auto& [plaintext, key, signature] = items.at(i);
+
+                try {
+                    const auto digest = hash(type, plaintext);
+                    const auto sig = parsed_signature(signature);
+                    const auto pubkey = parsed_public_key(key);
+                    results.at(i) =
+                        1 == ::secp256k1_ecdsa_verify(
+                                 context_,
+                                 &sig,
+                                 reinterpret_cast<const unsigned char*>(
+                                     digest->data()),
+                                 &pubkey);
+                } catch (const std::exception& e) {
+                    LogVerbose(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+                }
+            }
+        });
+}
+
 auto Secp256k1::hash(const crypto::HashType type, const ReadView data) const
     noexcept(false) -> OTData
 {
@@ -539,21 +569,7 @@ void Secp256k1::Init()
 auto Secp256k1::parsed_public_key(const ReadView bytes) const noexcept(false)
     -> ::secp256k1_pubkey
 {
-    if (nullptr == bytes.data() || 0 == bytes.size()) {
-        throw std::runtime_error("Missing public key");
-    }
-
-    auto output = ::secp256k1_pubkey{};
-
-    if (1 != ::secp256k1_ec_pubkey_parse(
-                 context_,
-                 &output,
-                 reinterpret_cast<const unsigned char*>(bytes.data()),
-                 bytes.size())) {
-        throw std::runtime_error("Invalid public key");
-    }
-
-    return output;
+    return pubkeys_.Parse(context_, bytes);
 }
 
 auto Secp256k1::parsed_signature(const ReadView bytes) const noexcept(false)
@@ -11,10 +11,12 @@ extern "C" {
 #include <cstddef>
 #include <iosfwd>
 #include <optional>
+#include <vector>
 
 #include "Proto.hpp"
 #include "crypto/library/AsymmetricProvider.hpp"
 #include "crypto/library/EcdsaProvider.hpp"
+#include "crypto/library/secp256k1/PubkeyCache.hpp"
 #include "internal/crypto/library/Secp256k1.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Version.hpp"
@@ -63,6 +65,10 @@ public:
         const ReadView pubkey,
         const ReadView scalar,
         const AllocateOutput result) const noexcept -> bool final;
+    auto PubkeyCacheStatistics() const noexcept -> PubkeyCacheStats final
+    {
+        return pubkeys_.Statistics();
+    }
     auto RandomKeypair(
         const AllocateOutput privateKey,
         const AllocateOutput publicKey,
@@ -95,6 +101,10 @@ public:
         const ReadView theKey,
         const ReadView signature,
         const crypto::HashType hashType) const -> bool final;
+    auto VerifyBatch(
+        const std::vector<Verification>& items,
+        const crypto::HashType hashType,
+        const Executor& executor) const noexcept -> std::vector<bool> final;
 
     void Init() final;
 
@@ -109,6 +119,7 @@ private:
 
     secp256k1_context* context_;
     const api::crypto::Util& ssl_;
+    const PubkeyCache pubkeys_;
 
     static auto blank_private() noexcept -> ReadView;
 
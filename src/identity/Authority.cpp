@@ -8,6 +8,7 @@
 #include "identity/Authority.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <map>
@@ -20,12 +21,15 @@
 #include <vector>
 
 #include "2_Factory.hpp"
+#include "internal/api/network/Network.hpp"
 #include "internal/crypto/key/Key.hpp"
 #include "internal/identity/Identity.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
@@ -34,11 +38,14 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/crypto/SignatureRole.hpp"
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/crypto/key/Asymmetric.hpp"
 #include "opentxs/crypto/key/Keypair.hpp"
 #include "opentxs/crypto/key/Symmetric.hpp"
+#include "opentxs/crypto/library/AsymmetricProvider.hpp"
+#include "opentxs/crypto/library/EcdsaProvider.hpp"
 #include "opentxs/identity/Source.hpp"
 #include "opentxs/identity/credential/Key.hpp"
 #include "opentxs/identity/credential/Verification.hpp"
@@ -1263,6 +1270,81 @@ auto Authority::Verify(const proto::Verification& item) const -> bool
         crypto::key::asymmetric::Role::Sign);
 }
 
+auto Authority::VerifyBatch(const std::vector<proto::Verification>& items)
+    const -> std::vector<bool>
+{
+    using Provider = std::pair<const crypto::EcdsaProvider*, crypto::HashType>;
+    using Batch = std::pair<
+        std::vector<crypto::EcdsaProvider::Verification>,
+        std::vector<std::size_t>>;
+
+    auto output = std::vector<bool>(items.size(), false);
+    // NOTE the batches refer to these so they must not reallocate
+    auto plaintexts = std::vector<OTData>{};
+    auto signatures = std::vector<proto::Signature>{};
+    auto batches = std::map<Provider, Batch>{};
+    plaintexts.reserve(items.size());
+    signatures.reserve(items.size());
+
+    for (auto i = std::size_t{0}; i < items.size(); ++i) {
+        auto serialized = credential::Verification::SigningForm(items.at(i));
+        auto& signature = *serialized.mutable_sig();
+        const auto& sig = signatures.emplace_back(signature);
+        signature.clear_signature();
+        const auto& plaintext =
+            plaintexts.emplace_back(api_.Factory().Data(serialized));
+        const auto& signerID = sig.credentialid();
+
+        if (signerID == GetMasterCredID()->str()) { continue; }
+
+        const auto* credential = dynamic_cast<const credential::Key*>(
+            get_secondary_credential(signerID));
+
+        if (nullptr == credential) { continue; }
+
+        try {
+            const auto& key =
+                credential->GetKeypair(crypto::key::asymmetric::Role::Sign)
+                    .GetPublicKey();
+
+            if (false == key.HasPublic()) { continue; }
+
+            const auto* ecdsa =
+                dynamic_cast<const crypto::EcdsaProvider*>(&key.engine());
+
+            if (nullptr == ecdsa) {
+                output.at(i) = Verify(items.at(i));
+
+                continue;
+            }
+
+            auto& [batch, index] = batches[Provider{
+                ecdsa,
+                opentxs::crypto::key::internal::translate(sig.hashtype())}];
+            batch.emplace_back(
+                plaintext->Bytes(), key.PublicKey(), sig.signature());
+            index.emplace_back(i);
+        } catch (...) {
+        }
+    }
+
+    const auto executor = [this](auto&& job) {
+        return api_.Network().Asio().Internal().PostCPU(std::move(job));
+    };
+
+    for (const auto& [provider, data] : batches) {
+        const auto& [ecdsa, hash] = provider;
+        const auto& [batch, index] = data;
+        const auto results = ecdsa->VerifyBatch(batch, hash, executor);
+
+        for (auto i = std::size_t{0}; i < results.size(); ++i) {
+            output.at(index.at(i)) = results.at(i);
+        }
+    }
+
+    return output;
+}
+
 auto Authority::VerifyInternally() const -> bool
 {
     if (false == bool(master_)) {
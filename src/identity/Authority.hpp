@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Proto.hpp"
 #include "internal/identity/Identity.hpp"
@@ -176,6 +177,8 @@ public:
         const proto::Signature& sig,
         const opentxs::crypto::key::asymmetric::Role key) const -> bool final;
     auto Verify(const proto::Verification& item) const -> bool final;
+    auto VerifyBatch(const std::vector<proto::Verification>& items) const
+        -> std::vector<bool> final;
     auto VerifyInternally() const -> bool final;
 
     auto AddChildKeyCredential(
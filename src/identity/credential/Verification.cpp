@@ -7,9 +7,11 @@
 #include "1_Internal.hpp"                        // IWYU pragma: associated
 #include "identity/credential/Verification.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "2_Factory.hpp"
 #include "identity/credential/Base.hpp"
@@ -197,17 +199,20 @@ auto Verification::verify_internally(const Lock& lock) const -> bool
     // Perform common Credential verifications
     if (!Base::verify_internally(lock)) { return false; }
 
+    auto claims = std::vector<proto::Verification>{};
+
     for (auto& nym : data_.internal().identity()) {
-        for (auto& claim : nym.verification()) {
-            bool valid = parent_.Verify(claim);
+        for (auto& claim : nym.verification()) { claims.emplace_back(claim); }
+    }
 
-            if (!valid) {
-                LogOutput(OT_METHOD)(__func__)(": Invalid claim verification.")
-                    .Flush();
+    // NOTE every claim is signed by this authority so the signatures are
+    // checked together
+    const auto valid = parent_.VerifyBatch(claims);
 
-                return false;
-            }
-        }
+    if (valid.end() != std::find(valid.begin(), valid.end(), false)) {
+        LogOutput(OT_METHOD)(__func__)(": Invalid claim verification.").Flush();
+
+        return false;
     }
 
     return true;
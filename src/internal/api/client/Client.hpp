@@ -148,7 +148,8 @@ struct Blockchain : virtual public api::client::Blockchain {
     /// Throws std::runtime_error if type is invalid
     virtual auto Contacts() const noexcept -> const api::client::Contacts& = 0;
     virtual auto KeyEndpoint() const noexcept -> const std::string& = 0;
-    virtual auto KeyGenerated(const Chain chain) const noexcept -> void = 0;
+    virtual auto KeyGenerated(const Chain chain, const Identifier& account)
+        const noexcept -> void = 0;
     virtual auto NewNym(const identifier::Nym& id) const noexcept -> void = 0;
     virtual bool ProcessContact(const Contact& contact) const noexcept = 0;
     virtual bool ProcessMergedContact(
@@ -16,6 +16,7 @@
 #include "opentxs/network/asio/Endpoint.hpp"
 #include "opentxs/network/asio/Socket.hpp"
 #include "opentxs/network/blockchain/sync/State.hpp"
+#include "util/Timer.hpp"
 #include "util/Work.hpp"
 
 namespace boost
@@ -81,6 +82,7 @@ struct Asio {
 
     virtual auto Connect(const ReadView id, Socket& socket) noexcept
         -> bool = 0;
+    virtual auto GetTimer() noexcept -> Timer = 0;
     virtual auto IOContext() noexcept -> boost::asio::io_context& = 0;
     virtual auto PostIO(Callback cb) noexcept -> bool = 0;
     virtual auto PostCPU(Callback cb) noexcept -> bool = 0;
@@ -89,6 +91,11 @@ struct Asio {
         const OTZMQWorkType type,
         const std::size_t bytes,
         Socket& socket) noexcept -> bool = 0;
+    virtual auto ReceiveSome(
+        const ReadView id,
+        const OTZMQWorkType type,
+        const std::size_t bytes,
+        Socket& socket) noexcept -> bool = 0;
 
     virtual ~Asio() = default;
 
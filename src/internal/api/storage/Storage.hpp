@@ -5,6 +5,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "opentxs/api/storage/Storage.hpp"
 
 namespace opentxs
@@ -20,9 +23,26 @@ class Symmetric;
 
 namespace opentxs::api::storage
 {
+struct GarbageCollection {
+    bool running_{};
+    bool paused_{};
+    // Number of completed collection cycles
+    std::uint64_t generation_{};
+    // Objects processed during the current or most recent cycle
+    std::size_t visited_{};
+    // Objects which were already processed earlier in the same cycle
+    std::size_t skipped_{};
+    std::size_t failed_{};
+};
+
 class StorageInternal : virtual public Storage
 {
 public:
+    virtual auto GarbageCollectionStatus() const noexcept
+        -> GarbageCollection = 0;
+    virtual void PauseGarbageCollection() const noexcept = 0;
+    virtual void ResumeGarbageCollection() const noexcept = 0;
+
     virtual void InitBackup() = 0;
     virtual void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) = 0;
     virtual void start() = 0;
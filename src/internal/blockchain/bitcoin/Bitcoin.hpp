@@ -178,4 +178,20 @@ private:
         const std::size_t total,
         const SigHash& sigHash) noexcept -> std::unique_ptr<Hash>;
 };
+
+// Pre-BIP143 signature preimages differ only in the script of the input being
+// signed, so every other part of the transaction is serialized once and
+// reused for all inputs
+struct LegacyPreimages {
+    be::little_int32_buf_t version_{};
+    std::vector<Space> inputs_{};
+    Space outputs_{};
+    be::little_uint32_buf_t locktime_{};
+
+    auto Preimage(
+        const std::size_t index,
+        const SigHash& sigHash,
+        const block::bitcoin::internal::Input& input) const noexcept(false)
+        -> Space;
+};
 }  // namespace opentxs::blockchain::bitcoin
@@ -232,7 +232,9 @@ struct Script : virtual public bitcoin::Script {
 struct Transaction : virtual public bitcoin::Transaction {
     using SigHash = blockchain::bitcoin::SigOption;
 
-    virtual auto GetPreimageBTC(
+    // Reference implementation of the pre-BIP143 signing preimage, without
+    // the trailing sighash type. Signing uses bitcoin::LegacyPreimages.
+    virtual auto ForTestingOnlyGetPreimageBTC(
         const std::size_t index,
         const blockchain::bitcoin::SigHash& hashType) const noexcept
         -> Space = 0;
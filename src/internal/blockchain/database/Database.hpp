@@ -47,6 +47,10 @@ enum Table {
     BlockHeaderDisconnected = 5,
     BlockFilterBest = 6,
     BlockFilterHeaderBest = 7,
+    WalletOutputs = 8,
+    WalletOutputJournal = 9,
+    WalletOutputOwners = 10,
+    WalletSubchainScanned = 11,
 };
 
 enum class Key : std::size_t {
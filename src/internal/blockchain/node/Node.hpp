@@ -286,6 +286,16 @@ struct FilterDatabase {
         const noexcept -> Hash = 0;
     virtual auto LoadFilterHeader(const filter::Type type, const ReadView block)
         const noexcept -> Hash = 0;
+    // Results are returned in the order requested. Missing items are
+    // represented by an empty hash or a null filter.
+    virtual auto LoadFilterHeaders(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<Hash> = 0;
+    virtual auto LoadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const node::GCS>> = 0;
     virtual auto SetFilterHeaderTip(
         const filter::Type type,
         const block::Position& position) const noexcept -> bool = 0;
@@ -314,6 +324,10 @@ struct FilterOracle : virtual public node::FilterOracle {
     virtual auto GetFilterJob() const noexcept -> CfilterJob = 0;
     virtual auto GetHeaderJob() const noexcept -> CfheaderJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    virtual auto LoadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const node::GCS>> = 0;
     virtual auto LoadFilterOrResetTip(
         const filter::Type type,
         const block::Position& position) const noexcept
@@ -432,6 +446,7 @@ struct PeerManager {
         JobAvailableCfheaders = OT_ZMQ_INTERNAL_SIGNAL + 4,
         JobAvailableCfilters = OT_ZMQ_INTERNAL_SIGNAL + 5,
         JobAvailableBlock = OT_ZMQ_INTERNAL_SIGNAL + 6,
+        Stream = OT_ZMQ_INTERNAL_SIGNAL + 125,
         Body = OT_ZMQ_INTERNAL_SIGNAL + 126,
         Header = OT_ZMQ_INTERNAL_SIGNAL + 127,
         Heartbeat = OT_ZMQ_HEARTBEAT_SIGNAL,
@@ -589,6 +604,17 @@ struct WalletDatabase {
         UnconfirmedToo = true,
     };
 
+    struct Selection {
+        // The effective value of the selected inputs must be at least this
+        // amount
+        Amount target_{};
+        // Fee required to spend one additional input
+        Amount input_fee_{};
+        // Largest excess which may be given up as fee instead of being
+        // returned as change
+        Amount change_threshold_{};
+    };
+
     virtual auto AddConfirmedTransaction(
         const NodeID& balanceNode,
         const Subchain subchain,
@@ -658,6 +684,12 @@ struct WalletDatabase {
         const identifier::Nym& spender,
         const Identifier& proposal,
         const Spend policy) const noexcept -> std::optional<UTXO> = 0;
+    // Returns an empty vector if no input set covers the target
+    virtual auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const Selection& selection) const noexcept -> std::vector<UTXO> = 0;
     virtual auto SetDefaultFilterType(const FilterType type) const noexcept
         -> bool = 0;
     virtual auto SubchainAddElements(
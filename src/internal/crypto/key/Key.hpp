@@ -7,6 +7,7 @@
 
 #include <map>
 
+#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/crypto/key/asymmetric/Algorithm.hpp"
 #include "opentxs/crypto/key/asymmetric/Mode.hpp"
 #include "opentxs/crypto/key/asymmetric/Role.hpp"
@@ -20,6 +21,8 @@ using AsymmetricAlgorithmMap =
     std::map<asymmetric::Algorithm, proto::AsymmetricKeyType>;
 using AsymmetricAlgorithmReverseMap =
     std::map<proto::AsymmetricKeyType, asymmetric::Algorithm>;
+using HashTypeMap = std::map<crypto::HashType, proto::HashType>;
+using HashTypeReverseMap = std::map<proto::HashType, crypto::HashType>;
 using ModeMap = std::map<asymmetric::Mode, proto::KeyMode>;
 using ModeReverseMap = std::map<proto::KeyMode, asymmetric::Mode>;
 using RoleMap = std::map<asymmetric::Role, proto::KeyRole>;
@@ -32,6 +35,7 @@ using SymmetricAlgorithmReverseMap =
     std::map<proto::SymmetricMode, symmetric::Algorithm>;
 
 auto asymmetricalgorithm_map() noexcept -> const AsymmetricAlgorithmMap&;
+auto hashtype_map() noexcept -> const HashTypeMap&;
 auto mode_map() noexcept -> const ModeMap&;
 auto role_map() noexcept -> const RoleMap&;
 auto source_map() noexcept -> const SourceMap&;
@@ -39,8 +43,10 @@ auto symmetricalgorithm_map() noexcept -> const SymmetricAlgorithmMap&;
 auto translate(asymmetric::Algorithm in) noexcept -> proto::AsymmetricKeyType;
 auto translate(asymmetric::Mode in) noexcept -> proto::KeyMode;
 auto translate(asymmetric::Role in) noexcept -> proto::KeyRole;
+auto translate(crypto::HashType in) noexcept -> proto::HashType;
 auto translate(symmetric::Source in) noexcept -> proto::SymmetricKeyType;
 auto translate(symmetric::Algorithm in) noexcept -> proto::SymmetricMode;
+auto translate(proto::HashType in) noexcept -> crypto::HashType;
 auto translate(proto::KeyMode in) noexcept -> asymmetric::Mode;
 auto translate(proto::KeyRole in) noexcept -> asymmetric::Role;
 auto translate(proto::AsymmetricKeyType in) noexcept -> asymmetric::Algorithm;
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "opentxs/crypto/library/AsymmetricProvider.hpp"
 #include "opentxs/crypto/library/EcdsaProvider.hpp"
 
@@ -13,6 +15,16 @@ namespace opentxs::crypto
 class Secp256k1 : virtual public EcdsaProvider
 {
 public:
+    struct PubkeyCacheStats {
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t evictions_{};
+        std::size_t keys_{};
+        std::size_t capacity_{};
+    };
+
+    virtual auto PubkeyCacheStatistics() const noexcept -> PubkeyCacheStats = 0;
+
     virtual void Init() = 0;
 
     ~Secp256k1() override = default;
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "opentxs/identity/Authority.hpp"
 #include "opentxs/identity/Nym.hpp"
 
@@ -17,6 +19,11 @@ namespace credential
 class Primary;
 }  // namespace credential
 }  // namespace identity
+
+namespace proto
+{
+class Verification;
+}  // namespace proto
 }  // namespace opentxs
 
 namespace opentxs::identity::internal
@@ -26,6 +33,9 @@ struct Authority : virtual public identity::Authority {
         -> VersionNumber;
 
     virtual auto GetMasterCredential() const -> const credential::Primary& = 0;
+    // Checks each item as Verify(item) would and returns one result per item
+    virtual auto VerifyBatch(const std::vector<proto::Verification>& items)
+        const -> std::vector<bool> = 0;
     virtual auto WriteCredentials() const -> bool = 0;
 
     ~Authority() override = default;
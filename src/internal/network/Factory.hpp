@@ -6,8 +6,10 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "Proto.hpp"
+#include "opentxs/Bytes.hpp"
 
 namespace opentxs
 {
@@ -34,6 +36,8 @@ auto ZMQFrame(std::size_t size) noexcept -> network::zeromq::Frame*;
 auto ZMQFrame(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Frame*;
 auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame*;
+auto ZMQFrame(Space&& data) noexcept -> network::zeromq::Frame*;
+auto ZMQFrame(std::string&& data) noexcept -> network::zeromq::Frame*;
 auto ZMQMessage() noexcept -> network::zeromq::Message*;
 auto ZMQMessage(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Message*;
@@ -59,6 +59,14 @@ auto Socket::Imp::Receive(
     return asio_.Receive(id, type, bytes, *this);
 }
 
+auto Socket::Imp::ReceiveSome(
+    const ReadView id,
+    const OTZMQWorkType type,
+    const std::size_t bytes) noexcept -> bool
+{
+    return asio_.ReceiveSome(id, type, bytes, *this);
+}
+
 auto Socket::Imp::Transmit(const ReadView data, Notification notifier) noexcept
     -> bool
 {
@@ -114,6 +122,14 @@ auto Socket::Receive(
     return imp_->Receive(id, type, bytes);
 }
 
+auto Socket::ReceiveSome(
+    const ReadView id,
+    const OTZMQWorkType type,
+    const std::size_t bytes) noexcept -> bool
+{
+    return imp_->ReceiveSome(id, type, bytes);
+}
+
 auto Socket::Transmit(const ReadView data, Notification notifier) noexcept
     -> bool
 {
@@ -55,6 +55,10 @@ struct Socket::Imp {
         const ReadView notify,
         const OTZMQWorkType type,
         const std::size_t bytes) noexcept -> bool;
+    auto ReceiveSome(
+        const ReadView notify,
+        const OTZMQWorkType type,
+        const std::size_t bytes) noexcept -> bool;
     auto Transmit(const ReadView data, Notification notifier) noexcept -> bool;
 
     Imp(const Endpoint& endpoint, Asio& asio) noexcept;
@@ -8,6 +8,7 @@
 #include "network/zeromq/Context.hpp"  // IWYU pragma: associated
 
 #include <zmq.h>
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
@@ -44,6 +45,7 @@
 template class opentxs::Pimpl<opentxs::network::zeromq::Context>;
 
 #define INPROC_PREFIX "inproc://opentxs/"
+#define OT_ZMQ_REACTOR_THREADS 4u
 #define PATH_SEPERATOR "/"
 #define OT_METHOD "opentxs::network::zeromq::Context::"
 
@@ -121,8 +123,18 @@ auto Context::Z85ToRaw(
 
 namespace opentxs::network::zeromq::implementation
 {
+auto Reactor::Get(const zeromq::Context& context) noexcept -> Reactor*
+{
+    const auto* imp = dynamic_cast<const Context*>(&context);
+
+    if (nullptr == imp) { return nullptr; }
+
+    return imp->reactor_.get();
+}
+
 Context::Context() noexcept
     : context_(::zmq_ctx_new())
+    , reactor_()
 {
     assert(nullptr != context_);
     assert(1 == ::zmq_has("curve"));
@@ -141,6 +153,12 @@ Context::Context() noexcept
         ::zmq_ctx_set(context_, ZMQ_MAX_SOCKETS, sockets);
 
     assert(0 == init);
+
+    // NOTE listening sockets share this many poller threads instead of
+    // running one thread each
+    const auto pollers = std::clamp(
+        std::thread::hardware_concurrency() / 2u, 1u, OT_ZMQ_REACTOR_THREADS);
+    reactor_ = std::make_unique<implementation::Reactor>(context_, pollers);
 }
 
 Context::operator void*() const noexcept
@@ -360,6 +378,8 @@ auto Context::TaggedReply(
 
 Context::~Context()
 {
+    if (reactor_) { reactor_->Stop(); }
+
     if (nullptr != context_) {
         zmq_ctx_shutdown(context_);
         auto promise = std::promise<void>{};
@@ -8,10 +8,12 @@
 #include <cstddef>
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
 #include "Proto.hpp"
 #include "internal/network/Factory.hpp"
+#include "network/zeromq/Reactor.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -140,8 +142,10 @@ public:
 
 private:
     friend network::zeromq::Context* opentxs::factory::ZMQContext() noexcept;
+    friend implementation::Reactor;
 
     void* context_{nullptr};
+    std::unique_ptr<implementation::Reactor> reactor_;
 
     auto clone() const noexcept -> Context* final { return new Context; }
 
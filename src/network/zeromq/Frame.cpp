@@ -8,6 +8,8 @@
 #include "network/zeromq/Frame.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <memory>
+#include <utility>
 
 #include "internal/network/Factory.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -36,8 +38,30 @@ auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame*
 {
     return new ReturnType(data);
 }
+
+auto ZMQFrame(Space&& data) noexcept -> network::zeromq::Frame*
+{
+    return new ReturnType(std::move(data));
+}
+
+auto ZMQFrame(std::string&& data) noexcept -> network::zeromq::Frame*
+{
+    return new ReturnType(std::move(data));
+}
 }  // namespace opentxs::factory
 
+namespace
+{
+// NOTE buffers smaller than this are cheaper to copy than to hand over
+constexpr auto zero_copy_threshold_ = std::size_t{64};
+
+template <typename Buffer>
+auto release_buffer(void*, void* hint) noexcept -> void
+{
+    std::unique_ptr<Buffer>{static_cast<Buffer*>(hint)}.reset();
+}
+}  // namespace
+
 namespace opentxs::network::zeromq::implementation
 {
 Frame::Frame() noexcept
@@ -72,6 +96,18 @@ Frame::Frame(const void* data, const std::size_t bytes) noexcept
     }
 }
 
+Frame::Frame(Space&& input) noexcept
+    : Frame()
+{
+    take(std::move(input));
+}
+
+Frame::Frame(std::string&& input) noexcept
+    : Frame()
+{
+    take(std::move(input));
+}
+
 Frame::operator std::string() const noexcept { return std::string{Bytes()}; }
 
 auto Frame::Bytes() const noexcept -> ReadView
@@ -83,7 +119,47 @@ auto Frame::Bytes() const noexcept -> ReadView
 
 auto Frame::clone() const noexcept -> Frame*
 {
-    return new Frame(zmq_msg_data(&message_), zmq_msg_size(&message_));
+    auto output = std::unique_ptr<Frame>{new Frame()};
+
+    OT_ASSERT(output);
+
+    // NOTE zmq_msg_copy shares the underlying buffer by reference count
+    // instead of duplicating it
+    const auto copied = zmq_msg_copy(&output->message_, &message_);
+
+    OT_ASSERT(0 == copied);
+
+    return output.release();
+}
+
+template <typename Buffer>
+auto Frame::take(Buffer&& input) noexcept -> void
+{
+    const auto bytes = input.size();
+
+    if (zero_copy_threshold_ > bytes) {
+        const auto init = zmq_msg_init_size(&message_, bytes);
+
+        OT_ASSERT(0 == init);
+
+        if (0u < bytes) {
+            std::memcpy(zmq_msg_data(&message_), input.data(), bytes);
+        }
+
+        return;
+    }
+
+    auto buffer = std::make_unique<Buffer>(std::move(input));
+
+    OT_ASSERT(buffer);
+
+    auto* data = const_cast<void*>(static_cast<const void*>(buffer->data()));
+    const auto init = zmq_msg_init_data(
+        &message_, data, bytes, &release_buffer<Buffer>, buffer.get());
+
+    OT_ASSERT(0 == init);
+
+    buffer.release();
 }
 
 Frame::~Frame() { zmq_msg_close(&message_); }
@@ -45,15 +45,23 @@ private:
         const std::size_t) noexcept;
     friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
         const ProtobufType&) noexcept;
+    friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
+        Space&&) noexcept;
+    friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
+        std::string&&) noexcept;
     friend network::zeromq::Frame;
 
     mutable zmq_msg_t message_;
 
     auto clone() const noexcept -> Frame* final;
+    template <typename Buffer>
+    auto take(Buffer&& input) noexcept -> void;
 
     Frame() noexcept;
     explicit Frame(const ProtobufType& input) noexcept;
     explicit Frame(const std::size_t bytes) noexcept;
+    explicit Frame(Space&& input) noexcept;
+    explicit Frame(std::string&& input) noexcept;
     Frame(const void* data, const std::size_t bytes) noexcept;
     Frame(const Frame&) = delete;
     Frame(Frame&&) = delete;
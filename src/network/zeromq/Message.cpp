@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <utility>
 
 #include "internal/network/Factory.hpp"
@@ -95,6 +96,24 @@ auto Message::AddFrame(const void* input, const std::size_t size) -> Frame&
     return frame;
 }
 
+auto Message::AddFrame(Space&& input) -> Frame&
+{
+    auto& frame = messages_.emplace_back(factory::ZMQFrame(std::move(input)));
+
+    if (total_.has_value()) { total_.value() += frame->size(); }
+
+    return frame;
+}
+
+auto Message::AddFrame(std::string&& input) -> Frame&
+{
+    auto& frame = messages_.emplace_back(factory::ZMQFrame(std::move(input)));
+
+    if (total_.has_value()) { total_.value() += frame->size(); }
+
+    return frame;
+}
+
 auto Message::AddFrame(const ProtobufType& input) -> Frame&
 {
     auto& frame = messages_.emplace_back(factory::ZMQFrame(input));
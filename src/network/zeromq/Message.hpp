@@ -5,10 +5,11 @@
 
 #pragma once
 
+#include <boost/container/small_vector.hpp>
 #include <cstddef>
 #include <iosfwd>
 #include <optional>
-#include <vector>
+#include <string>
 
 #include "Proto.hpp"
 #include "internal/network/Factory.hpp"
@@ -40,6 +41,8 @@ public:
     auto AddFrame() -> Frame& final;
     auto AddFrame(const ProtobufType& input) -> Frame& final;
     auto AddFrame(const void* input, const std::size_t size) -> Frame& final;
+    auto AddFrame(Space&& input) -> Frame& final;
+    auto AddFrame(std::string&& input) -> Frame& final;
     auto AppendBytes() noexcept -> AllocateOutput final;
     auto at(const std::size_t index) -> Frame& final;
 
@@ -53,7 +56,10 @@ public:
     ~Message() override = default;
 
 protected:
-    std::vector<OTZMQFrame> messages_{};
+    // NOTE most messages contain only a handful of frames
+    using Frames = boost::container::small_vector<OTZMQFrame, 8>;
+
+    Frames messages_{};
 
     auto body_position() const -> std::size_t;
 
@@ -0,0 +1,489 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "network/zeromq/Reactor.hpp"  // IWYU pragma: associated
+
+#include <zmq.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "network/zeromq/socket/Socket.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/core/Log.hpp"
+
+#define OT_ZMQ_REACTOR_POLL_MILLISECONDS 1000
+#define OT_ZMQ_REACTOR_MIN_WORKERS 16u
+#define OT_ZMQ_REACTOR_STALL_MILLISECONDS 100
+#define OT_ZMQ_REACTOR_EXTRA_IDLE_SECONDS 30
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::implementation
+{
+Reactor::Reactor(void* context, const std::size_t pollers) noexcept
+    : running_(true)
+    , next_(0)
+    , busy_lock_()
+    , busy_cv_()
+    , pollers_()
+    , workers_(std::max(
+          OT_ZMQ_REACTOR_MIN_WORKERS, 4u * std::thread::hardware_concurrency()))
+{
+    OT_ASSERT(nullptr != context);
+
+    const auto count = std::max(pollers, std::size_t{1});
+    pollers_.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto& poller = *pollers_.emplace_back(std::make_unique<Poller>());
+        const auto endpoint =
+            socket::implementation::Socket::random_inproc_endpoint();
+        poller.wake_rx_ = zmq_socket(context, ZMQ_PULL);
+        poller.wake_tx_ = zmq_socket(context, ZMQ_PUSH);
+
+        OT_ASSERT(nullptr != poller.wake_rx_);
+        OT_ASSERT(nullptr != poller.wake_tx_);
+
+        const auto linger = int{0};
+        zmq_setsockopt(poller.wake_rx_, ZMQ_LINGER, &linger, sizeof(linger));
+        zmq_setsockopt(poller.wake_tx_, ZMQ_LINGER, &linger, sizeof(linger));
+        const auto bound = zmq_bind(poller.wake_rx_, endpoint.c_str());
+
+        OT_ASSERT(0 == bound);
+
+        const auto connected = zmq_connect(poller.wake_tx_, endpoint.c_str());
+
+        OT_ASSERT(0 == connected);
+
+        poller.thread_ = std::thread{&Reactor::poll, this, std::ref(poller)};
+    }
+}
+
+auto Reactor::Add(Receiver& receiver) noexcept -> void
+{
+    const auto index = next_.fetch_add(1) % pollers_.size();
+    auto& poller = *pollers_.at(index);
+
+    {
+        auto lock = Lock{poller.lock_};
+        poller.entries_.emplace_back(
+            std::make_shared<Entry>(receiver, poller));
+    }
+
+    wake(poller);
+}
+
+auto Reactor::dispatch(std::shared_ptr<Entry> entry) noexcept -> void
+{
+    entry->busy_.store(true);
+    const auto posted = workers_.Post([this, entry] {
+        entry->worker_.store(std::this_thread::get_id());
+        entry->receiver_->reactor_receive();
+        entry->worker_.store(std::thread::id{});
+        finish(*entry);
+    });
+
+    if (false == posted) { finish(*entry); }
+}
+
+auto Reactor::finish(Entry& entry) noexcept -> void
+{
+    {
+        auto lock = Lock{busy_lock_};
+        entry.busy_.store(false);
+    }
+
+    busy_cv_.notify_all();
+    wake(entry.poller_);
+}
+
+auto Reactor::poll(Poller& poller) noexcept -> void
+{
+    auto items = std::vector<zmq_pollitem_t>{};
+    auto ready = std::vector<std::shared_ptr<Entry>>{};
+    auto candidates = std::vector<std::shared_ptr<Entry>>{};
+
+    while (running_.load()) {
+        // NOTE give way to any thread waiting to remove a socket
+        while (0 < poller.waiting_.load()) { std::this_thread::yield(); }
+
+        auto cycle = Lock{poller.cycle_lock_};
+        items.clear();
+        ready.clear();
+        candidates.clear();
+        // NOTE any wake request issued after this point will interrupt the
+        // upcoming poll
+        poller.signaled_.store(false);
+
+        {
+            auto msg = zmq_msg_t{};
+            zmq_msg_init(&msg);
+
+            while (-1 != zmq_msg_recv(&msg, poller.wake_rx_, ZMQ_DONTWAIT)) {}
+
+            zmq_msg_close(&msg);
+        }
+
+        items.push_back({poller.wake_rx_, 0, ZMQ_POLLIN, 0});
+
+        {
+            auto lock = Lock{poller.lock_};
+
+            for (const auto& entry : poller.entries_) {
+                if (false == entry->busy_.load()) {
+                    candidates.emplace_back(entry);
+                }
+            }
+        }
+
+        for (auto& entry : candidates) {
+            if (entry->receiver_->reactor_prepare()) {
+                items.push_back(
+                    {entry->receiver_->reactor_socket(), 0, ZMQ_POLLIN, 0});
+                ready.emplace_back(std::move(entry));
+            }
+        }
+
+        // NOTE a socket which could not be prepared wakes the poller once it
+        // can be, so there is no need to retry it early
+        const auto events = zmq_poll(
+            items.data(),
+            static_cast<int>(items.size()),
+            long{OT_ZMQ_REACTOR_POLL_MILLISECONDS});
+
+        if (0 == events) { continue; }
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+
+            if (ETERM == error) { break; }
+
+            std::cerr << OT_METHOD << __func__
+                      << ": Poll error: " << zmq_strerror(error) << std::endl;
+
+            continue;
+        }
+
+        if (false == running_.load()) { break; }
+
+        for (auto i = std::size_t{1}; i < items.size(); ++i) {
+            if (0 != (items.at(i).revents & ZMQ_POLLIN)) {
+                dispatch(ready.at(i - 1));
+            }
+        }
+    }
+}
+
+auto Reactor::Remove(Receiver& receiver) noexcept -> void
+{
+    const auto thread = std::this_thread::get_id();
+
+    for (auto& pPoller : pollers_) {
+        auto& poller = *pPoller;
+        auto entry = std::shared_ptr<Entry>{};
+
+        {
+            auto lock = Lock{poller.lock_};
+            auto& entries = poller.entries_;
+            auto it = std::find_if(
+                entries.begin(), entries.end(), [&](const auto& item) {
+                    return item->receiver_ == &receiver;
+                });
+
+            if (entries.end() == it) { continue; }
+
+            entry = *it;
+            entries.erase(it);
+        }
+
+        // NOTE wait for the poller to finish any cycle which might still
+        // reference the socket unless the poller thread itself is removing it
+        if (poller.thread_.get_id() != thread) {
+            ++poller.waiting_;
+            wake(poller);
+
+            {
+                auto cycle = Lock{poller.cycle_lock_};
+            }
+
+            --poller.waiting_;
+        }
+
+        // NOTE a callback may close its own socket
+        if (entry->worker_.load() != thread) {
+            auto lock = Lock{busy_lock_};
+            busy_cv_.wait(lock, [&] { return false == entry->busy_.load(); });
+        }
+
+        return;
+    }
+}
+
+auto Reactor::Statistics() const noexcept -> Stats
+{
+    auto output = Stats{};
+    output.pollers_ = pollers_.size();
+
+    for (const auto& poller : pollers_) {
+        auto lock = Lock{poller->lock_};
+        output.sockets_ += poller->entries_.size();
+    }
+
+    workers_.Stats(output);
+
+    return output;
+}
+
+auto Reactor::Stop() noexcept -> void
+{
+    if (false == running_.exchange(false)) { return; }
+
+    for (auto& poller : pollers_) {
+        wake(*poller);
+
+        if (poller->thread_.joinable()) { poller->thread_.join(); }
+
+        auto lock = Lock{poller->wake_lock_};
+        zmq_close(poller->wake_tx_);
+        zmq_close(poller->wake_rx_);
+        poller->wake_tx_ = nullptr;
+        poller->wake_rx_ = nullptr;
+    }
+
+    workers_.Stop();
+}
+
+auto Reactor::Wake(Receiver& receiver) noexcept -> void
+{
+    for (auto& poller : pollers_) {
+        auto lock = Lock{poller->lock_};
+
+        for (const auto& entry : poller->entries_) {
+            if (entry->receiver_ == &receiver) {
+                lock.unlock();
+                wake(*poller);
+
+                return;
+            }
+        }
+    }
+}
+
+auto Reactor::wake(Poller& poller) noexcept -> void
+{
+    if (poller.signaled_.exchange(true)) { return; }
+
+    auto lock = Lock{poller.wake_lock_};
+
+    if (nullptr == poller.wake_tx_) { return; }
+
+    zmq_send(poller.wake_tx_, nullptr, 0, ZMQ_DONTWAIT);
+}
+
+Reactor::~Reactor() { Stop(); }
+
+Reactor::Workers::Workers(const std::size_t limit) noexcept
+    : limit_(std::max(limit, std::size_t{1}))
+    , lock_()
+    , jobs_cv_()
+    , monitor_cv_()
+    , jobs_()
+    , threads_()
+    , extra_()
+    , finished_()
+    , idle_(0)
+    , started_(0)
+    , running_(true)
+    , monitor_()
+{
+    threads_.reserve(limit_);
+    monitor_ = std::thread{&Workers::monitor, this};
+}
+
+auto Reactor::Workers::backlog() const noexcept -> bool
+{
+    return jobs_.size() > idle_;
+}
+
+auto Reactor::Workers::monitor() noexcept -> void
+{
+    static constexpr auto stall =
+        std::chrono::milliseconds{OT_ZMQ_REACTOR_STALL_MILLISECONDS};
+    auto lock = Lock{lock_};
+
+    while (running_) {
+        reap(lock);
+
+        if (false == backlog()) {
+            monitor_cv_.wait(lock, [&] {
+                return backlog() || (false == finished_.empty()) ||
+                       (false == running_);
+            });
+
+            continue;
+        }
+
+        const auto started = started_;
+        monitor_cv_.wait_for(lock, stall, [&] { return false == running_; });
+
+        if ((false == running_) || (false == backlog())) { continue; }
+
+        // NOTE no queued callback has been started for a full interval, so
+        // every worker is busy or blocked, possibly on one of those callbacks
+        if (started == started_) {
+            try {
+                auto thread = std::thread{&Workers::run, this, true};
+                const auto id = thread.get_id();
+                extra_.emplace(id, std::move(thread));
+            } catch (...) {
+            }
+        }
+    }
+}
+
+auto Reactor::Workers::Post(std::function<void()>&& job) noexcept -> bool
+{
+    auto lock = Lock{lock_};
+
+    if (false == running_) { return false; }
+
+    jobs_.emplace_back(std::move(job));
+
+    if (backlog()) {
+        if (threads_.size() < limit_) {
+            try {
+                threads_.emplace_back(&Workers::run, this, false);
+            } catch (...) {
+            }
+        } else {
+            monitor_cv_.notify_one();
+        }
+    }
+
+    jobs_cv_.notify_one();
+
+    return true;
+}
+
+auto Reactor::Workers::reap(Lock& lock) noexcept -> void
+{
+    if (finished_.empty()) { return; }
+
+    auto threads = std::vector<std::thread>{};
+
+    for (const auto& id : finished_) {
+        auto it = extra_.find(id);
+
+        if (extra_.end() == it) { continue; }
+
+        threads.emplace_back(std::move(it->second));
+        extra_.erase(it);
+    }
+
+    finished_.clear();
+    lock.unlock();
+
+    for (auto& thread : threads) {
+        if (thread.joinable()) { thread.join(); }
+    }
+
+    lock.lock();
+}
+
+auto Reactor::Workers::run(const bool extra) noexcept -> void
+{
+    static constexpr auto timeout =
+        std::chrono::seconds{OT_ZMQ_REACTOR_EXTRA_IDLE_SECONDS};
+    auto lock = Lock{lock_};
+    const auto ready = [&] {
+        return (false == jobs_.empty()) || (false == running_);
+    };
+
+    while (true) {
+        if (jobs_.empty()) {
+            if (false == running_) { break; }
+
+            ++idle_;
+
+            if (extra) {
+                jobs_cv_.wait_for(lock, timeout, ready);
+            } else {
+                jobs_cv_.wait(lock, ready);
+            }
+
+            --idle_;
+
+            // NOTE threads started past the limit leave once the pool has
+            // been idle long enough
+            if (extra && jobs_.empty() && running_) {
+                finished_.emplace_back(std::this_thread::get_id());
+                monitor_cv_.notify_one();
+
+                break;
+            }
+
+            continue;
+        }
+
+        auto job = std::move(jobs_.front());
+        jobs_.pop_front();
+        ++started_;
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+}
+
+auto Reactor::Workers::Stats(Reactor::Stats& out) const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    out.workers_ = threads_.size() + extra_.size();
+    out.idle_workers_ = idle_;
+    out.extra_workers_ = extra_.size();
+}
+
+auto Reactor::Workers::Stop() noexcept -> void
+{
+    auto threads = std::vector<std::thread>{};
+    auto monitor = std::thread{};
+
+    {
+        auto lock = Lock{lock_};
+        running_ = false;
+        threads.swap(threads_);
+
+        for (auto& [id, thread] : extra_) {
+            threads.emplace_back(std::move(thread));
+        }
+
+        extra_.clear();
+        finished_.clear();
+        monitor.swap(monitor_);
+    }
+
+    jobs_cv_.notify_all();
+    monitor_cv_.notify_all();
+
+    if (monitor.joinable()) { monitor.join(); }
+
+    const auto self = std::this_thread::get_id();
+
+    for (auto& thread : threads) {
+        // NOTE a callback which stops the context can not join itself
+        if (thread.get_id() == self) {
+            thread.detach();
+        } else if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+Reactor::Workers::~Workers() { Stop(); }
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,172 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs
+{
+namespace network
+{
+namespace zeromq
+{
+class Context;
+}  // namespace zeromq
+}  // namespace network
+}  // namespace opentxs
+
+namespace opentxs::network::zeromq::implementation
+{
+// Multiplexes the listening sockets of a context over a small, fixed set of
+// poller threads. Incoming messages are handed to a worker pool which never
+// runs more than one callback for the same socket at a time. Callbacks may
+// block on one another: if every worker is blocked while callbacks are still
+// queued the pool temporarily grows past its limit.
+class Reactor
+{
+public:
+    struct Receiver {
+        // Called from a poller thread before each poll. Returns false if the
+        // socket should be skipped during this cycle, in which case the
+        // receiver must call Wake once it is able to be prepared again.
+        virtual auto reactor_prepare() noexcept -> bool = 0;
+        // Called from a worker thread when the socket is readable
+        virtual auto reactor_receive() noexcept -> void = 0;
+        virtual auto reactor_socket() const noexcept -> void* = 0;
+
+        virtual ~Receiver() = default;
+    };
+
+    struct Stats {
+        std::size_t pollers_{};
+        std::size_t sockets_{};
+        std::size_t workers_{};
+        std::size_t idle_workers_{};
+        std::size_t extra_workers_{};
+    };
+
+    static auto Get(const zeromq::Context& context) noexcept -> Reactor*;
+
+    auto Statistics() const noexcept -> Stats;
+
+    auto Add(Receiver& receiver) noexcept -> void;
+    auto Remove(Receiver& receiver) noexcept -> void;
+    auto Stop() noexcept -> void;
+    auto Wake(Receiver& receiver) noexcept -> void;
+
+    Reactor(void* context, const std::size_t pollers) noexcept;
+
+    ~Reactor();
+
+private:
+    struct Entry;
+
+    struct Poller {
+        mutable std::mutex lock_;
+        std::mutex cycle_lock_;
+        std::mutex wake_lock_;
+        std::atomic<bool> signaled_;
+        std::atomic<int> waiting_;
+        void* wake_rx_;
+        void* wake_tx_;
+        std::vector<std::shared_ptr<Entry>> entries_;
+        std::thread thread_;
+
+        Poller() noexcept
+            : lock_()
+            , cycle_lock_()
+            , wake_lock_()
+            , signaled_(false)
+            , waiting_(0)
+            , wake_rx_(nullptr)
+            , wake_tx_(nullptr)
+            , entries_()
+            , thread_()
+        {
+        }
+    };
+
+    struct Entry {
+        Receiver* receiver_;
+        Poller& poller_;
+        std::atomic<bool> busy_;
+        std::atomic<std::thread::id> worker_;
+
+        Entry(Receiver& receiver, Poller& poller) noexcept
+            : receiver_(&receiver)
+            , poller_(poller)
+            , busy_(false)
+            , worker_()
+        {
+        }
+    };
+
+    struct Workers {
+        auto Stats(Reactor::Stats& out) const noexcept -> void;
+
+        auto Post(std::function<void()>&& job) noexcept -> bool;
+        auto Stop() noexcept -> void;
+
+        Workers(const std::size_t limit) noexcept;
+
+        ~Workers();
+
+    private:
+        const std::size_t limit_;
+        mutable std::mutex lock_;
+        std::condition_variable jobs_cv_;
+        std::condition_variable monitor_cv_;
+        std::deque<std::function<void()>> jobs_;
+        std::vector<std::thread> threads_;
+        std::map<std::thread::id, std::thread> extra_;
+        std::vector<std::thread::id> finished_;
+        std::size_t idle_;
+        std::size_t started_;
+        bool running_;
+        std::thread monitor_;
+
+        auto backlog() const noexcept -> bool;
+        auto monitor() noexcept -> void;
+        auto reap(Lock& lock) noexcept -> void;
+        auto run(const bool extra) noexcept -> void;
+
+        Workers() = delete;
+        Workers(const Workers&) = delete;
+        Workers(Workers&&) = delete;
+        auto operator=(const Workers&) -> Workers& = delete;
+        auto operator=(Workers&&) -> Workers& = delete;
+    };
+
+    std::atomic<bool> running_;
+    std::atomic<std::size_t> next_;
+    mutable std::mutex busy_lock_;
+    std::condition_variable busy_cv_;
+    std::vector<std::unique_ptr<Poller>> pollers_;
+    Workers workers_;
+
+    auto dispatch(std::shared_ptr<Entry> entry) noexcept -> void;
+    auto finish(Entry& entry) noexcept -> void;
+    auto poll(Poller& poller) noexcept -> void;
+    auto wake(Poller& poller) noexcept -> void;
+
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    auto operator=(const Reactor&) -> Reactor& = delete;
+    auto operator=(Reactor&&) -> Reactor& = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <thread>
 
+#include "network/zeromq/Reactor.hpp"
 #include "network/zeromq/socket/Socket.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -34,7 +36,9 @@ class Context;
 namespace opentxs::network::zeromq::socket::implementation
 {
 template <typename InterfaceType, typename MessageType = zeromq::Message>
-class Receiver : virtual public InterfaceType, public Socket
+class Receiver : virtual public InterfaceType,
+                 public Socket,
+                 public zeromq::implementation::Reactor::Receiver
 {
 public:
     auto apply_socket(SocketCallback&& cb) const noexcept -> bool override;
@@ -43,17 +47,23 @@ public:
 protected:
     const bool start_thread_;
     mutable std::thread receiver_thread_;
+    mutable zeromq::implementation::Reactor* reactor_;
 
     virtual auto have_callback() const noexcept -> bool { return false; }
     void run_tasks(const Lock& lock) const noexcept;
 
     void init() noexcept override;
+    void queue_changed() const noexcept final;
     virtual void process_incoming(
         const Lock& lock,
         MessageType& message) noexcept = 0;
     void shutdown(const Lock& lock) noexcept override;
     virtual void thread() noexcept;
 
+    auto reactor_prepare() noexcept -> bool final;
+    auto reactor_receive() noexcept -> void final;
+    auto reactor_socket() const noexcept -> void* final { return socket_; }
+
     Receiver(
         const zeromq::Context& context,
         const SocketType type,
@@ -64,11 +74,14 @@ protected:
 
 private:
     mutable int next_task_;
+    mutable std::mutex receive_lock_;
+    mutable std::condition_variable receive_cv_;
     mutable std::mutex task_lock_;
     mutable std::map<int, SocketCallback> socket_tasks_;
     mutable std::map<int, bool> task_result_;
 
     auto add_task(SocketCallback&& cb) const noexcept -> int;
+    auto stop_listening() const noexcept -> void;
     auto task_result(const int id) const noexcept -> bool;
     auto task_running(const int id) const noexcept -> bool;
 
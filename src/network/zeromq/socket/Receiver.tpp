@@ -29,7 +29,10 @@ Receiver<InterfaceType, MessageType>::Receiver(
     : Socket(context, type, direction)
     , start_thread_(startThread)
     , receiver_thread_()
+    , reactor_(nullptr)
     , next_task_(0)
+    , receive_lock_()
+    , receive_cv_()
     , task_lock_()
     , socket_tasks_()
     , task_result_()
@@ -53,9 +56,12 @@ auto Receiver<InterfaceType, MessageType>::apply_socket(
     SocketCallback&& cb) const noexcept -> bool
 {
     const auto id = add_task(std::move(cb));
+    queue_changed();
 
     while (task_running(id)) {
-        Sleep(std::chrono::milliseconds(RECEIVER_POLL_MILLISECONDS));
+        Sleep(std::chrono::milliseconds(
+            (nullptr == reactor_) ? RECEIVER_POLL_MILLISECONDS
+                                  : CALLBACK_WAIT_MILLISECONDS));
     }
 
     return task_result(id);
@@ -65,8 +71,7 @@ template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::Close() const noexcept -> bool
 {
     running_->Off();
-
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    stop_listening();
 
     return Socket::Close();
 }
@@ -77,7 +82,83 @@ void Receiver<InterfaceType, MessageType>::init() noexcept
     Socket::init();
 
     if (start_thread_) {
-        receiver_thread_ = std::thread(&Receiver::thread, this);
+        reactor_ = zeromq::implementation::Reactor::Get(context_);
+
+        if (nullptr == reactor_) {
+            receiver_thread_ = std::thread(&Receiver::thread, this);
+        } else {
+            reactor_->Add(*this);
+        }
+    }
+}
+
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::queue_changed() const noexcept
+{
+    if (nullptr != reactor_) {
+        reactor_->Wake(const_cast<Receiver&>(*this));
+    }
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_prepare() noexcept -> bool
+{
+    if (false == running_.get()) { return false; }
+
+    if (false == have_callback()) { return false; }
+
+    // NOTE while the reactor is in use the socket lock is only held
+    // elsewhere by shutdown, which removes the socket from the reactor
+    Lock lock(lock_, std::try_to_lock);
+
+    if (false == lock.owns_lock()) { return false; }
+
+    for (const auto& endpoint : endpoint_queue_.pop()) {
+        start(lock, endpoint);
+    }
+
+    run_tasks(lock);
+
+    return true;
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_receive() noexcept -> void
+{
+    Lock lock(lock_, std::defer_lock);
+
+    {
+        // NOTE the socket lock is held by shutdown while the reactor waits
+        // for this callback to finish, so give up once stop_listening
+        // signals instead of blocking on the socket lock
+        Lock gate(receive_lock_);
+        receive_cv_.wait(gate, [&] {
+            return (false == running_.get()) || lock.try_lock();
+        });
+    }
+
+    if (false == lock.owns_lock()) { return; }
+
+    // NOTE deliver every message which is already queued so that a burst of
+    // messages costs a single dispatch
+    while (running_.get()) {
+        auto events = int{0};
+        auto size = sizeof(events);
+        const auto rc = zmq_getsockopt(socket_, ZMQ_EVENTS, &events, &size);
+
+        if ((0 != rc) || (0 == (events & ZMQ_POLLIN))) { return; }
+
+        auto reply = MessageType::Factory();
+        const auto received = Socket::receive_message(lock, socket_, reply);
+
+        if (false == received) {
+            std::cerr << RECEIVER_METHOD << __func__
+                      << ": Failed to receive incoming message." << std::endl;
+
+            return;
+        }
+
+        process_incoming(lock, reply);
     }
 }
 
@@ -98,11 +179,27 @@ void Receiver<InterfaceType, MessageType>::run_tasks(
 template <typename InterfaceType, typename MessageType>
 void Receiver<InterfaceType, MessageType>::shutdown(const Lock& lock) noexcept
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
-
+    stop_listening();
     Socket::shutdown(lock);
 }
 
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::stop_listening() const noexcept
+    -> void
+{
+    if (nullptr != reactor_) {
+        {
+            Lock gate(receive_lock_);
+        }
+
+        receive_cv_.notify_all();
+        reactor_->Remove(const_cast<Receiver&>(*this));
+        reactor_ = nullptr;
+    }
+
+    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+}
+
 template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::task_result(
     const int id) const noexcept -> bool
@@ -182,6 +279,6 @@ void Receiver<InterfaceType, MessageType>::thread() noexcept
 template <typename InterfaceType, typename MessageType>
 Receiver<InterfaceType, MessageType>::~Receiver()
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    stop_listening();
 }
 }  // namespace opentxs::network::zeromq::socket::implementation
@@ -126,6 +126,7 @@ protected:
         -> bool;
 
     virtual void init() noexcept {}
+    virtual void queue_changed() const noexcept {}
     virtual void shutdown(const Lock& lock) noexcept;
 
     explicit Socket(
@@ -262,6 +262,32 @@ auto StorageServersAllowedStorageItemHash() noexcept -> const VersionMap&
     return output;
 }
 auto StorageThreadAllowedItem() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+        {2, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadAllowedStorageThreadPageRef() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {2, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadPageAllowedItem() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadPageAllowedStorageThreadPageRef() noexcept
+    -> const VersionMap&
 {
     static const auto output = VersionMap{
         {1, {1, 1}},
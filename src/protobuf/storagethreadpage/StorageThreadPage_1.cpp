@@ -0,0 +1,132 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/protobuf/verify/StorageThreadPage.hpp"  // IWYU pragma: associated
+
+#include "opentxs/protobuf/Basic.hpp"
+#include "opentxs/protobuf/StorageThreadPage.pb.h"
+#include "opentxs/protobuf/verify/StorageThreadItem.hpp"  // IWYU pragma: keep
+#include "opentxs/protobuf/verify/StorageThreadPageRef.hpp"  // IWYU pragma: keep
+#include "opentxs/protobuf/verify/VerifyStorage.hpp"
+#include "protobuf/Check.hpp"
+
+#define PROTO_NAME "storage thread page"
+
+namespace opentxs
+{
+namespace proto
+{
+
+auto CheckProto_1(const StorageThreadPage& input, const bool silent) -> bool
+{
+    if (0 == input.level()) {
+        CHECK_NONE(child)
+        CHECK_HAVE(item);
+        CHECK_SUBOBJECTS(item, StorageThreadPageAllowedItem());
+    } else {
+        CHECK_NONE(item)
+        CHECK_HAVE(child);
+        CHECK_SUBOBJECTS(child, StorageThreadPageAllowedStorageThreadPageRef());
+    }
+
+    return true;
+}
+
+auto CheckProto_2(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(2)
+}
+
+auto CheckProto_3(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(3)
+}
+
+auto CheckProto_4(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(4)
+}
+
+auto CheckProto_5(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(5)
+}
+
+auto CheckProto_6(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(6)
+}
+
+auto CheckProto_7(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(7)
+}
+
+auto CheckProto_8(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(8)
+}
+
+auto CheckProto_9(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(9)
+}
+
+auto CheckProto_10(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(10)
+}
+
+auto CheckProto_11(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(11)
+}
+
+auto CheckProto_12(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(12)
+}
+
+auto CheckProto_13(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(13)
+}
+
+auto CheckProto_14(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(14)
+}
+
+auto CheckProto_15(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(15)
+}
+
+auto CheckProto_16(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(16)
+}
+
+auto CheckProto_17(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(17)
+}
+
+auto CheckProto_18(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(18)
+}
+
+auto CheckProto_19(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(19)
+}
+
+auto CheckProto_20(const StorageThreadPage& input, const bool silent) -> bool
+{
+    UNDEFINED_VERSION(20)
+}
+}  // namespace proto
+}  // namespace opentxs
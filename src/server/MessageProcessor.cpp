@@ -241,7 +241,7 @@ auto MessageProcessor::process_backend(const zmq::Message& incoming)
     if (error) { reply = ""; }
 
     auto output = server_.API().Network().ZeroMQ().ReplyMessage(incoming);
-    output->AddFrame(reply);
+    output->AddFrame(std::move(reply));
 
     return output;
 }
@@ -323,7 +323,7 @@ void MessageProcessor::process_legacy(
     const Data& id,
     const network::zeromq::Message& incoming)
 {
-    LogTrace(OT_METHOD)(__func__)(": Processing request via ")(id.asHex())
+    OT_LOG_TRACE(OT_METHOD)(__func__)(": Processing request via ")(id.asHex())
         .Flush();
     OTZMQMessage request{incoming};
     internal_socket_->Send(request);
@@ -465,7 +465,7 @@ void MessageProcessor::process_proto(
     const Data& id,
     const network::zeromq::Message& incoming)
 {
-    LogTrace(OT_METHOD)(__func__)(": Processing request via ")(id.asHex())
+    OT_LOG_TRACE(OT_METHOD)(__func__)(": Processing request via ")(id.asHex())
         .Flush();
     const auto command = extract_proto(incoming.Body().at(0));
 
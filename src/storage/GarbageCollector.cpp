@@ -0,0 +1,231 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                  // IWYU pragma: associated
+#include "1_Internal.hpp"                // IWYU pragma: associated
+#include "storage/GarbageCollector.hpp"  // IWYU pragma: associated
+
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+// Number of objects migrated between pauses
+#define OT_STORAGE_GC_BATCH_SIZE 256
+// Delay between batches, to leave disk bandwidth for foreground writes
+#define OT_STORAGE_GC_BATCH_DELAY_MILLISECONDS 10
+// Number of recently migrated keys remembered in order to skip shared subtrees
+#define OT_STORAGE_GC_DONE_CAPACITY 16384
+// Number of objects between progress messages
+#define OT_STORAGE_GC_PROGRESS_INTERVAL 16384
+
+#define OT_METHOD "opentxs::storage::GarbageCollector::"
+
+namespace opentxs::storage
+{
+GarbageCollector::GarbageCollector(
+    const opentxs::api::storage::Driver& driver) noexcept
+    : driver_(driver)
+    , lock_()
+    , cv_()
+    , running_(false)
+    , paused_(false)
+    , stopped_(false)
+    , generation_(0)
+    , visited_(0)
+    , skipped_(0)
+    , failed_(0)
+    , done_()
+{
+}
+
+auto GarbageCollector::EmptyBucket(const bool bucket) const -> bool
+{
+    return driver_.EmptyBucket(bucket);
+}
+
+auto GarbageCollector::Finish(const bool success) const noexcept -> bool
+{
+    auto lock = Lock{lock_};
+    running_ = false;
+    done_ = {};
+
+    if (stopped_) { return false; }
+
+    if (success) { ++generation_; }
+
+    LogVerbose(OT_METHOD)(__func__)(": Cycle ")(generation_)(" visited ")(
+        visited_)(" objects, skipped ")(skipped_)(", failed ")(failed_)
+        .Flush();
+
+    return true;
+}
+
+auto GarbageCollector::Load(
+    const std::string& key,
+    const bool checking,
+    std::string& value) const -> bool
+{
+    return driver_.Load(key, checking, value);
+}
+
+auto GarbageCollector::LoadFromBucket(
+    const std::string& key,
+    std::string& value,
+    const bool bucket) const -> bool
+{
+    return driver_.LoadFromBucket(key, value, bucket);
+}
+
+auto GarbageCollector::LoadRoot() const -> std::string
+{
+    return driver_.LoadRoot();
+}
+
+auto GarbageCollector::Migrate(
+    const std::string& key,
+    const opentxs::api::storage::Driver& to) const -> bool
+{
+    if (false == throttle()) { return false; }
+
+    // NOTE identical subtrees share hashes and only need to be copied once
+    if (false == done_.empty()) {
+        auto& slot = done_.at(std::hash<std::string>{}(key) % done_.size());
+
+        if (slot == key) {
+            auto lock = Lock{lock_};
+            ++skipped_;
+
+            return true;
+        }
+
+        slot = key;
+    }
+
+    const auto output = driver_.Migrate(key, to);
+    auto lock = Lock{lock_};
+    ++visited_;
+
+    if (false == output) { ++failed_; }
+
+    if (0 == (visited_ % OT_STORAGE_GC_PROGRESS_INTERVAL)) {
+        LogDetail(OT_METHOD)(__func__)(": Garbage collection progress: ")(
+            visited_)(" objects")
+            .Flush();
+    }
+
+    return output;
+}
+
+auto GarbageCollector::Pause() const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    paused_ = true;
+}
+
+auto GarbageCollector::Resume() const noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+        paused_ = false;
+    }
+
+    cv_.notify_all();
+}
+
+auto GarbageCollector::Start() const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    running_ = true;
+    visited_ = 0;
+    skipped_ = 0;
+    failed_ = 0;
+    done_ = {};
+
+    try {
+        done_.resize(OT_STORAGE_GC_DONE_CAPACITY);
+    } catch (...) {
+    }
+}
+
+auto GarbageCollector::Status() const noexcept
+    -> opentxs::api::storage::GarbageCollection
+{
+    auto lock = Lock{lock_};
+    auto output = opentxs::api::storage::GarbageCollection{};
+    output.running_ = running_;
+    output.paused_ = paused_;
+    output.generation_ = generation_;
+    output.visited_ = visited_;
+    output.skipped_ = skipped_;
+    output.failed_ = failed_;
+
+    return output;
+}
+
+auto GarbageCollector::Stop() const noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+        stopped_ = true;
+    }
+
+    cv_.notify_all();
+}
+
+auto GarbageCollector::Store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket) const -> bool
+{
+    return driver_.Store(isTransaction, key, value, bucket);
+}
+
+void GarbageCollector::Store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket,
+    std::promise<bool>& promise) const
+{
+    driver_.Store(isTransaction, key, value, bucket, promise);
+}
+
+auto GarbageCollector::Store(
+    const bool isTransaction,
+    const std::string& value,
+    std::string& key) const -> bool
+{
+    return driver_.Store(isTransaction, value, key);
+}
+
+auto GarbageCollector::StoreRoot(const bool commit, const std::string& hash)
+    const -> bool
+{
+    return driver_.StoreRoot(commit, hash);
+}
+
+auto GarbageCollector::throttle() const noexcept -> bool
+{
+    static constexpr auto delay =
+        std::chrono::milliseconds{OT_STORAGE_GC_BATCH_DELAY_MILLISECONDS};
+    auto lock = Lock{lock_};
+    cv_.wait(lock, [&] { return stopped_ || (false == paused_); });
+
+    if (stopped_) { return false; }
+
+    const auto processed = visited_ + skipped_;
+
+    if ((0 < processed) && (0 == (processed % OT_STORAGE_GC_BATCH_SIZE))) {
+        cv_.wait_for(lock, delay, [&] { return stopped_; });
+    }
+
+    return false == stopped_;
+}
+}  // namespace opentxs::storage
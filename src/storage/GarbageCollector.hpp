@@ -0,0 +1,92 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "internal/api/storage/Storage.hpp"
+#include "opentxs/api/storage/Driver.hpp"
+
+namespace opentxs::storage
+{
+// Driver adapter used to walk the tree during garbage collection. Every
+// object migration passes through this class, which allows a cycle to be
+// throttled, paused, resumed and monitored without changing the tree nodes.
+class GarbageCollector final : public opentxs::api::storage::Driver
+{
+public:
+    auto EmptyBucket(const bool bucket) const -> bool final;
+    auto Load(const std::string& key, const bool checking, std::string& value)
+        const -> bool final;
+    auto LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const -> bool final;
+    auto LoadRoot() const -> std::string final;
+    auto Migrate(
+        const std::string& key,
+        const opentxs::api::storage::Driver& to) const -> bool final;
+    auto Status() const noexcept -> opentxs::api::storage::GarbageCollection;
+    auto Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const -> bool final;
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final;
+    auto Store(
+        const bool isTransaction,
+        const std::string& value,
+        std::string& key) const -> bool final;
+    auto StoreRoot(const bool commit, const std::string& hash) const
+        -> bool final;
+
+    // Returns false if the cycle was interrupted by Stop
+    auto Finish(const bool success) const noexcept -> bool;
+    auto Pause() const noexcept -> void;
+    auto Resume() const noexcept -> void;
+    auto Start() const noexcept -> void;
+    auto Stop() const noexcept -> void;
+
+    GarbageCollector(const opentxs::api::storage::Driver& driver) noexcept;
+
+    ~GarbageCollector() final = default;
+
+private:
+    const opentxs::api::storage::Driver& driver_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable cv_;
+    mutable bool running_;
+    mutable bool paused_;
+    mutable bool stopped_;
+    mutable std::uint64_t generation_;
+    mutable std::size_t visited_;
+    mutable std::size_t skipped_;
+    mutable std::size_t failed_;
+    // Recently processed keys, indexed by hash. A key which collides with a
+    // newer one is forgotten, which costs at most one redundant copy. Only
+    // accessed from the collection thread.
+    mutable std::vector<std::string> done_;
+
+    auto throttle() const noexcept -> bool;
+
+    GarbageCollector() = delete;
+    GarbageCollector(const GarbageCollector&) = delete;
+    GarbageCollector(GarbageCollector&&) = delete;
+    auto operator=(const GarbageCollector&) -> GarbageCollector& = delete;
+    auto operator=(GarbageCollector&&) -> GarbageCollector& = delete;
+};
+}  // namespace opentxs::storage
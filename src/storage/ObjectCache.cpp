@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"             // IWYU pragma: associated
+#include "1_Internal.hpp"           // IWYU pragma: associated
+#include "storage/ObjectCache.hpp"  // IWYU pragma: associated
+
+#include "opentxs/Types.hpp"
+
+// Approximate number of serialized bytes retained by the cache
+#define OT_STORAGE_OBJECT_CACHE_BYTES (64u * 1024u * 1024u)
+
+namespace opentxs::storage
+{
+ObjectCache::ObjectCache(const std::size_t capacity) noexcept
+    : shard_capacity_(capacity / shard_count_)
+    , shards_()
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+{
+}
+
+auto ObjectCache::add(
+    const Key& key,
+    Object object,
+    const std::size_t bytes) noexcept -> void
+{
+    if ((false == bool(object)) || (bytes > shard_capacity_)) { return; }
+
+    auto& shard = this->shard(key);
+    auto lock = Lock{shard.lock_};
+
+    if (shard.index_.count(key)) { return; }
+
+    try {
+        shard.lru_.push_front(Entry{key, std::move(object), bytes});
+        shard.index_.emplace(key, shard.lru_.begin());
+        shard.bytes_ += bytes;
+    } catch (...) {
+
+        return;
+    }
+
+    while (shard.bytes_ > shard_capacity_) {
+        const auto& last = shard.lru_.back();
+        shard.bytes_ -= last.bytes_;
+        shard.index_.erase(last.key_);
+        shard.lru_.pop_back();
+        ++evictions_;
+    }
+}
+
+auto ObjectCache::Clear(const void* owner) noexcept -> void
+{
+    for (auto& shard : shards_) {
+        auto lock = Lock{shard.lock_};
+
+        for (auto it = shard.lru_.begin(); it != shard.lru_.end();) {
+            if (std::get<0>(it->key_) == owner) {
+                shard.bytes_ -= it->bytes_;
+                shard.index_.erase(it->key_);
+                it = shard.lru_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+auto ObjectCache::find(const Key& key) const noexcept -> Object
+{
+    auto& shard = this->shard(key);
+    auto lock = Lock{shard.lock_};
+    const auto it = shard.index_.find(key);
+
+    if (shard.index_.end() == it) {
+        ++misses_;
+
+        return {};
+    }
+
+    // NOTE move the entry to the front of the list
+    shard.lru_.splice(shard.lru_.begin(), shard.lru_, it->second);
+    ++hits_;
+
+    return it->second->object_;
+}
+
+auto ObjectCache::Get() noexcept -> ObjectCache&
+{
+    static ObjectCache cache{OT_STORAGE_OBJECT_CACHE_BYTES};
+
+    return cache;
+}
+
+auto ObjectCache::shard(const Key& key) const noexcept -> Shard&
+{
+    return shards_.at(KeyHash{}(key) % shard_count_);
+}
+
+auto ObjectCache::Statistics() const noexcept -> Stats
+{
+    auto output = Stats{};
+    output.hits_ = hits_.load();
+    output.misses_ = misses_.load();
+    output.evictions_ = evictions_.load();
+    output.capacity_ = shard_capacity_ * shard_count_;
+
+    for (const auto& shard : shards_) {
+        auto lock = Lock{shard.lock_};
+        output.objects_ += shard.index_.size();
+        output.bytes_ += shard.bytes_;
+    }
+
+    return output;
+}
+
+ObjectCache::~ObjectCache() = default;
+}  // namespace opentxs::storage
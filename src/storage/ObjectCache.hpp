@@ -0,0 +1,118 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace opentxs::storage
+{
+// Process-wide cache of validated protobuf objects loaded from storage.
+// Objects are keyed by the driver instance which loaded them and the hash of
+// their serialized form, so one Storage instance can never observe an object
+// which only exists in the backend of another. Each driver releases its
+// entries with Clear() when it is cleaned up or destroyed.
+class ObjectCache
+{
+public:
+    struct Stats {
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t evictions_{};
+        std::size_t objects_{};
+        std::size_t bytes_{};
+        std::size_t capacity_{};
+    };
+
+    static auto Get() noexcept -> ObjectCache&;
+
+    template <typename T>
+    auto Find(const void* owner, const std::string& hash) const noexcept
+        -> std::shared_ptr<const T>
+    {
+        return std::static_pointer_cast<const T>(
+            find(Key{owner, hash, std::type_index{typeid(T)}}));
+    }
+    auto Statistics() const noexcept -> Stats;
+
+    template <typename T>
+    auto Add(
+        const void* owner,
+        const std::string& hash,
+        std::shared_ptr<const T> object,
+        const std::size_t bytes) noexcept -> void
+    {
+        add(Key{owner, hash, std::type_index{typeid(T)}},
+            std::static_pointer_cast<const void>(std::move(object)),
+            bytes);
+    }
+    auto Clear(const void* owner) noexcept -> void;
+
+    ObjectCache(const std::size_t capacity) noexcept;
+
+    ~ObjectCache();
+
+private:
+    static constexpr std::size_t shard_count_{16};
+
+    using Key = std::tuple<const void*, std::string, std::type_index>;
+    using Object = std::shared_ptr<const void>;
+
+    struct KeyHash {
+        auto operator()(const Key& key) const noexcept -> std::size_t
+        {
+            const auto& [owner, hash, type] = key;
+
+            return std::hash<const void*>{}(owner) ^
+                   std::hash<std::string>{}(hash) ^ type.hash_code();
+        }
+    };
+
+    struct Entry {
+        Key key_;
+        Object object_;
+        std::size_t bytes_;
+    };
+
+    struct Shard {
+        using LRU = std::list<Entry>;
+
+        mutable std::mutex lock_{};
+        mutable LRU lru_{};
+        std::unordered_map<Key, LRU::iterator, KeyHash> index_{};
+        std::size_t bytes_{};
+    };
+
+    const std::size_t shard_capacity_;
+    mutable std::array<Shard, shard_count_> shards_;
+    mutable std::atomic<std::size_t> hits_;
+    mutable std::atomic<std::size_t> misses_;
+    std::atomic<std::size_t> evictions_;
+
+    auto shard(const Key& key) const noexcept -> Shard&;
+
+    auto add(const Key& key, Object object, const std::size_t bytes) noexcept
+        -> void;
+    auto find(const Key& key) const noexcept -> Object;
+
+    ObjectCache() = delete;
+    ObjectCache(const ObjectCache&) = delete;
+    ObjectCache(ObjectCache&&) = delete;
+    auto operator=(const ObjectCache&) -> ObjectCache& = delete;
+    auto operator=(ObjectCache&&) -> ObjectCache& = delete;
+};
+}  // namespace opentxs::storage
@@ -7,16 +7,40 @@
 #include "1_Internal.hpp"      // IWYU pragma: associated
 #include "storage/Plugin.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
 #include <thread>
+#include <utility>
 
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Log.hpp"
 
+// Producers block once this many writes are waiting
+#define OT_STORAGE_WRITE_QUEUE_LIMIT 4096
+// Upper bound on the number of writes handed to store_batch at once
+#define OT_STORAGE_WRITE_BATCH_LIMIT 512
+
 #define OT_METHOD "opentxs::Plugin"
 
 namespace opentxs
 {
+struct Plugin::Writer {
+    std::mutex lock_{};
+    std::condition_variable work_{};
+    std::condition_variable space_{};
+    std::deque<Write> queue_{};
+    std::thread thread_{};
+    bool running_{true};
+    std::size_t written_{};
+    std::size_t batches_{};
+    std::chrono::microseconds total_latency_{};
+    std::chrono::microseconds max_latency_{};
+};
 
 Plugin::Plugin(
     const api::storage::Storage& storage,
@@ -29,7 +53,9 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , writer_(std::make_unique<Writer>())
 {
+    OT_ASSERT(writer_);
 }
 
 auto Plugin::Load(
@@ -130,9 +156,53 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
-    std::thread thread(
-        &Plugin::store, this, isTransaction, key, value, bucket, &promise);
-    thread.detach();
+    auto& writer = *writer_;
+    auto lock = Lock{writer.lock_};
+    writer.space_.wait(lock, [&] {
+        return (OT_STORAGE_WRITE_QUEUE_LIMIT > writer.queue_.size()) ||
+               (false == writer.running_);
+    });
+
+    if (false == writer.running_) {
+        lock.unlock();
+        store(isTransaction, key, value, bucket, &promise);
+
+        return;
+    }
+
+    if (false == writer.thread_.joinable()) {
+        writer.thread_ = std::thread{&Plugin::write, this};
+    }
+
+    writer.queue_.emplace_back(
+        Write{isTransaction, key, value, bucket, &promise, Clock::now()});
+    lock.unlock();
+    writer.work_.notify_one();
+}
+
+void Plugin::stop_writer() const noexcept
+{
+    auto& writer = *writer_;
+
+    {
+        auto lock = Lock{writer.lock_};
+
+        if (false == writer.running_) { return; }
+
+        writer.running_ = false;
+    }
+
+    writer.work_.notify_all();
+    writer.space_.notify_all();
+
+    if (writer.thread_.joinable()) { writer.thread_.join(); }
+
+    const auto stats = WriteQueue();
+    LogVerbose(OT_METHOD)(__func__)(": ")(stats.written_)(
+        " objects written in ")(stats.batches_)(" batches. Average latency: ")(
+        stats.average_latency_.count())(" microseconds, maximum latency: ")(
+        stats.max_latency_.count())(" microseconds")
+        .Flush();
 }
 
 auto Plugin::Store(
@@ -150,4 +220,84 @@ auto Plugin::Store(
 
     return false;
 }
+
+void Plugin::store_batch(const Writes& batch) const
+{
+    for (const auto& item : batch) {
+        store(
+            item.transaction_,
+            item.key_,
+            item.value_,
+            item.bucket_,
+            item.promise_);
+    }
+}
+
+void Plugin::write() const noexcept
+{
+    auto& writer = *writer_;
+    auto batch = Writes{};
+    auto lock = Lock{writer.lock_};
+
+    while (true) {
+        writer.work_.wait(lock, [&] {
+            return (false == writer.queue_.empty()) ||
+                   (false == writer.running_);
+        });
+
+        // NOTE the queue is always drained before the thread exits so that
+        // every promise is satisfied
+        if (writer.queue_.empty()) { break; }
+
+        const auto count = std::min<std::size_t>(
+            writer.queue_.size(), OT_STORAGE_WRITE_BATCH_LIMIT);
+        batch.clear();
+        std::move(
+            writer.queue_.begin(),
+            std::next(writer.queue_.begin(), count),
+            std::back_inserter(batch));
+        writer.queue_.erase(
+            writer.queue_.begin(), std::next(writer.queue_.begin(), count));
+        lock.unlock();
+        writer.space_.notify_all();
+        store_batch(batch);
+        const auto now = Clock::now();
+        lock.lock();
+        ++writer.batches_;
+        writer.written_ += batch.size();
+
+        for (const auto& item : batch) {
+            const auto latency =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    now - item.queued_);
+            writer.total_latency_ += latency;
+            writer.max_latency_ = std::max(writer.max_latency_, latency);
+        }
+    }
+}
+
+auto Plugin::WriteQueue() const noexcept -> WriteQueueStats
+{
+    auto& writer = *writer_;
+    auto lock = Lock{writer.lock_};
+    auto output = WriteQueueStats{};
+    output.pending_ = writer.queue_.size();
+    output.written_ = writer.written_;
+    output.batches_ = writer.batches_;
+    output.max_latency_ = writer.max_latency_;
+
+    if (0 < writer.written_) {
+        output.average_latency_ = writer.total_latency_ /
+                                  static_cast<std::int64_t>(writer.written_);
+    }
+
+    return output;
+}
+
+Plugin::~Plugin()
+{
+    stop_writer();
+    opentxs::storage::ObjectCache::Get().Clear(
+        static_cast<const api::storage::Driver*>(this));
+}
 }  // namespace opentxs
@@ -6,9 +6,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Proto.hpp"
 #include "Proto.tpp"
@@ -20,6 +23,8 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/protobuf/Check.hpp"
+#include "storage/GarbageCollector.hpp"
+#include "storage/ObjectCache.hpp"
 
 namespace opentxs
 {
@@ -37,6 +42,14 @@ class StorageConfig;
 class Plugin : virtual public opentxs::api::storage::Plugin
 {
 public:
+    struct WriteQueueStats {
+        std::size_t pending_{};
+        std::size_t written_{};
+        std::size_t batches_{};
+        std::chrono::microseconds average_latency_{};
+        std::chrono::microseconds max_latency_{};
+    };
+
     auto EmptyBucket(const bool bucket) const -> bool override = 0;
 
     auto Load(const std::string& key, const bool checking, std::string& value)
@@ -68,12 +81,24 @@ public:
     auto LoadRoot() const -> std::string override = 0;
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool override = 0;
+    auto WriteQueue() const noexcept -> WriteQueueStats;
 
     virtual void Cleanup() = 0;
 
-    ~Plugin() override = default;
+    ~Plugin() override;
 
 protected:
+    struct Write {
+        bool transaction_;
+        std::string key_;
+        std::string value_;
+        bool bucket_;
+        std::promise<bool>* promise_;
+        Time queued_;
+    };
+
+    using Writes = std::vector<Write>;
+
     const StorageConfig& config_;
     const Random& random_;
 
@@ -91,11 +116,23 @@ protected:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const = 0;
+    // Called from the writer thread with consecutive queued writes. Drivers
+    // which support transactions should override this to store the entire
+    // batch at once.
+    virtual void store_batch(const Writes& batch) const;
+    // Must be called by the most derived class before releasing anything
+    // store() depends on. Queued writes are completed before returning.
+    void stop_writer() const noexcept;
 
 private:
+    struct Writer;
+
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    std::unique_ptr<Writer> writer_;
+
+    void write() const noexcept;
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -109,6 +146,24 @@ auto opentxs::api::storage::Driver::LoadProto(
     std::shared_ptr<T>& serialized,
     const bool checking) const -> bool
 {
+    auto& cache = opentxs::storage::ObjectCache::Get();
+    // NOTE garbage collection reads every live object once, so caching those
+    // loads would only evict the working set and copy each object for
+    // nothing
+    const auto cacheable =
+        (nullptr ==
+         dynamic_cast<const opentxs::storage::GarbageCollector*>(this));
+
+    // NOTE callers are allowed to modify the returned object so cache hits
+    // are copied rather than shared
+    if (cacheable) {
+        if (auto cached = cache.Find<T>(this, hash); cached) {
+            serialized = std::make_shared<T>(*cached);
+
+            return true;
+        }
+    }
+
     auto raw = std::string{};
     const auto loaded = Load(hash, checking, raw);
     auto valid{false};
@@ -119,6 +174,11 @@ auto opentxs::api::storage::Driver::LoadProto(
         OT_ASSERT(serialized);
 
         valid = proto::Validate<T>(*serialized, VERBOSE);
+
+        if (valid && cacheable) {
+            cache.Add<T>(
+                this, hash, std::make_shared<const T>(*serialized), raw.size());
+        }
     } else {
 
         return false;
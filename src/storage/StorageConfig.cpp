@@ -19,6 +19,7 @@ StorageConfig::StorageConfig() noexcept
     , auto_publish_servers_(true)
     , auto_publish_units_(true)
     , gc_interval_(C::duration_cast<C::seconds>(C::hours(1)).count())
+    , commit_window_(0)
     , path_()
     , dht_callback_()
     , primary_plugin_(default_plugin_)
@@ -27,11 +28,15 @@ StorageConfig::StorageConfig() noexcept
     , fs_root_file_("root")
     , fs_backup_directory_()
     , fs_encrypted_backup_directory_()
+    , fs_segment_size_(64 * 1024 * 1024)
     , sqlite3_primary_bucket_("a")
     , sqlite3_secondary_bucket_("b")
     , sqlite3_control_table_("control")
     , sqlite3_root_key_("a")
     , sqlite3_db_file_("opentxs.sqlite3")
+    , sqlite3_synchronous_("FULL")
+    , sqlite3_mmap_size_(256 * 1024 * 1024)
+    , sqlite3_cache_size_(-16 * 1024)
     , lmdb_primary_bucket_("a")
     , lmdb_secondary_bucket_("b")
     , lmdb_control_table_("control")
@@ -14,6 +14,7 @@
 #define OT_STORAGE_PRIMARY_PLUGIN_LMDB "lmdb"
 #define OT_STORAGE_PRIMARY_PLUGIN_MEMDB "mem"
 #define OT_STORAGE_PRIMARY_PLUGIN_FS "fs"
+#define OT_STORAGE_PRIMARY_PLUGIN_PACKED "packed"
 #define STORAGE_CONFIG_PRIMARY_PLUGIN_KEY "primary_plugin"
 #define STORAGE_CONFIG_FS_BACKUP_DIRECTORY_KEY "fs_backup_directory"
 #define STORAGE_CONFIG_FS_ENCRYPTED_BACKUP_DIRECTORY_KEY "fs_encrypted_backup"
@@ -31,6 +32,9 @@ public:
     bool auto_publish_servers_;
     bool auto_publish_units_;
     std::int64_t gc_interval_;
+    // Maximum delay in milliseconds between a tree update and the commit of
+    // the new root. Zero commits every update individually.
+    std::int64_t commit_window_;
     std::string path_;
     InsertCB dht_callback_;
 
@@ -41,12 +45,18 @@ public:
     std::string fs_root_file_;
     std::string fs_backup_directory_;
     std::string fs_encrypted_backup_directory_;
+    // Maximum size in bytes of a segment file used by the packed plugin
+    std::int64_t fs_segment_size_;
 
     std::string sqlite3_primary_bucket_;
     std::string sqlite3_secondary_bucket_;
     std::string sqlite3_control_table_;
     std::string sqlite3_root_key_;
     std::string sqlite3_db_file_;
+    // Values for the synchronous, mmap_size and cache_size pragmas
+    std::string sqlite3_synchronous_;
+    std::int64_t sqlite3_mmap_size_;
+    std::int64_t sqlite3_cache_size_;
 
     std::string lmdb_primary_bucket_;
     std::string lmdb_secondary_bucket_;
@@ -0,0 +1,760 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                         // IWYU pragma: associated
+#include "1_Internal.hpp"                       // IWYU pragma: associated
+#include "storage/drivers/StorageFSPacked.hpp"  // IWYU pragma: associated
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <utility>
+
+#include "2_Factory.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+#include "storage/StorageConfig.hpp"
+
+// Name of the directory, relative to the storage path, holding the segments
+#define OT_STORAGE_PACKED_DIRECTORY "packed"
+#define OT_STORAGE_PACKED_SEGMENT_SUFFIX ".segment"
+// Emptied buckets are renamed with this prefix before being deleted
+#define OT_STORAGE_PACKED_PURGE_PREFIX "purge-"
+// Each record is prefixed by the key size, value size, and a checksum
+#define OT_STORAGE_PACKED_HEADER_BYTES 12u
+
+#define OT_METHOD "opentxs::storage::implementation::StorageFSPacked::"
+
+namespace opentxs
+{
+auto Factory::StorageFSPacked(
+    const api::storage::Storage& storage,
+    const StorageConfig& config,
+    const Digest& hash,
+    const Random& random,
+    const Flag& bucket) -> opentxs::api::storage::Plugin*
+{
+    return new opentxs::storage::implementation::StorageFSPacked(
+        storage, config, hash, random, bucket);
+}
+}  // namespace opentxs
+
+namespace opentxs::storage::implementation
+{
+namespace
+{
+auto read_u32(const char* in) noexcept -> std::uint32_t
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(in);
+
+    return static_cast<std::uint32_t>(bytes[0]) |
+           (static_cast<std::uint32_t>(bytes[1]) << 8) |
+           (static_cast<std::uint32_t>(bytes[2]) << 16) |
+           (static_cast<std::uint32_t>(bytes[3]) << 24);
+}
+
+auto write_u32(const std::uint32_t in, std::string& out) noexcept -> void
+{
+    out.push_back(static_cast<char>(in & 0xff));
+    out.push_back(static_cast<char>((in >> 8) & 0xff));
+    out.push_back(static_cast<char>((in >> 16) & 0xff));
+    out.push_back(static_cast<char>((in >> 24) & 0xff));
+}
+}  // namespace
+
+StorageFSPacked::StorageFSPacked(
+    const api::storage::Storage& storage,
+    const StorageConfig& config,
+    const Digest& hash,
+    const Random& random,
+    const Flag& bucket)
+    : ot_super(storage, config, hash, random, bucket)
+    , folder_(config.path_ + "/" + OT_STORAGE_PACKED_DIRECTORY)
+    , segment_limit_(static_cast<std::uint64_t>(
+          std::max<std::int64_t>(config.fs_segment_size_, 1)))
+    , write_lock_()
+    , purges_()
+    , lock_()
+    , buckets_()
+{
+    Init_StorageFSPacked();
+}
+
+auto StorageFSPacked::append(
+    const Lock& lock,
+    Bucket& bucket,
+    const Items& items) const -> std::vector<bool>
+{
+    OT_ASSERT(lock.owns_lock());
+
+    auto output = std::vector<bool>(items.size(), false);
+    auto buffer = std::string{};
+    // Position in items and location of every record in the buffer
+    auto locations = std::vector<std::pair<std::size_t, Location>>{};
+    auto flush = [&]() -> bool {
+        if (buffer.empty()) { return true; }
+
+        const auto file = bucket.files_.find(bucket.active_);
+
+        if (bucket.files_.end() == file) {
+            LogOutput(OT_METHOD)(__func__)(": No active segment").Flush();
+
+            return false;
+        }
+
+        const auto fd = file->second;
+
+        // NOTE one sync per segment per batch
+        if ((false == write_all(fd, buffer, bucket.size_)) ||
+            (false == sync(fd))) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to write segment ")(
+                bucket.active_)
+                .Flush();
+            // NOTE discard anything partially written so that the segment
+            // still ends with a complete record
+            if (0 != ::ftruncate(fd, static_cast<off_t>(bucket.size_))) {
+                LogOutput(OT_METHOD)(__func__)(": Failed to truncate segment")
+                    .Flush();
+            }
+
+            return false;
+        }
+
+        {
+            auto index = std::unique_lock<std::shared_mutex>{lock_};
+
+            for (const auto& [position, location] : locations) {
+                bucket.index_[items.at(position)->key_] = location;
+                output.at(position) = true;
+            }
+        }
+
+        bucket.size_ += buffer.size();
+        buffer.clear();
+        locations.clear();
+
+        return true;
+    };
+
+    for (auto i = std::size_t{0}; i < items.size(); ++i) {
+        const auto& key = items.at(i)->key_;
+        const auto& value = items.at(i)->value_;
+
+        if ((std::numeric_limits<std::uint32_t>::max() < key.size()) ||
+            (std::numeric_limits<std::uint32_t>::max() < value.size())) {
+            LogOutput(OT_METHOD)(__func__)(": Object too large").Flush();
+
+            continue;
+        }
+
+        const auto record =
+            OT_STORAGE_PACKED_HEADER_BYTES + key.size() + value.size();
+        const auto used = bucket.size_ + buffer.size();
+
+        if ((0 < used) && ((used + record) > segment_limit_)) {
+            if (false == flush()) { return output; }
+
+            if (false == open_segment(lock, bucket, bucket.active_ + 1)) {
+                return output;
+            }
+        }
+
+        const auto offset = bucket.size_ + buffer.size() +
+                            OT_STORAGE_PACKED_HEADER_BYTES + key.size();
+        locations.emplace_back(
+            i,
+            Location{
+                bucket.active_,
+                offset,
+                static_cast<std::uint32_t>(value.size())});
+        write_u32(static_cast<std::uint32_t>(key.size()), buffer);
+        write_u32(static_cast<std::uint32_t>(value.size()), buffer);
+        write_u32(checksum(key, value), buffer);
+        buffer.append(key);
+        buffer.append(value);
+    }
+
+    flush();
+
+    return output;
+}
+
+auto StorageFSPacked::bucket(const bool bucket) const -> Bucket&
+{
+    return buckets_.at(bucket ? 1 : 0);
+}
+
+// FNV-1a
+auto StorageFSPacked::checksum(
+    const std::string& key,
+    const std::string& value) -> std::uint32_t
+{
+    auto output = std::uint32_t{2166136261u};
+
+    for (const auto* data : {&key, &value}) {
+        for (const auto& c : *data) {
+            output ^= static_cast<unsigned char>(c);
+            output *= 16777619u;
+        }
+    }
+
+    return output;
+}
+
+void StorageFSPacked::Cleanup() { Cleanup_StorageFSPacked(); }
+
+void StorageFSPacked::Cleanup_StorageFSPacked()
+{
+    stop_writer();
+    Lock lock(write_lock_);
+
+    for (auto& bucket : buckets_) { close(bucket); }
+
+    for (auto& purge : purges_) { purge.wait(); }
+
+    purges_.clear();
+}
+
+void StorageFSPacked::close(Bucket& bucket) const
+{
+    auto index = std::unique_lock<std::shared_mutex>{lock_};
+
+    for (const auto& [id, fd] : bucket.files_) { ::close(fd); }
+
+    bucket.files_.clear();
+    bucket.index_.clear();
+}
+
+auto StorageFSPacked::EmptyBucket(const bool empty) const -> bool
+{
+    Lock lock(write_lock_);
+    auto& bucket = this->bucket(empty);
+    // NOTE the replacement is prepared under the purge prefix so that it is
+    // swept if the process stops before it is moved into place, and the old
+    // bucket stays usable until both renames have succeeded
+    const auto prefix = folder_ + "/" + OT_STORAGE_PACKED_PURGE_PREFIX;
+    const auto replacement = prefix + random_();
+    const auto purged = prefix + random_();
+    boost::system::error_code ec{};
+
+    if (false == boost::filesystem::create_directory(replacement, ec)) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to create ")(replacement)
+            .Flush();
+
+        return false;
+    }
+
+    const auto path = replacement + "/" + segment_name(0);
+    const auto fd =
+        ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+    if (-1 == fd) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to create ")(path).Flush();
+        start_purge(lock, replacement);
+
+        return false;
+    }
+
+    sync_directory(replacement);
+    boost::filesystem::rename(bucket.directory_, purged, ec);
+
+    if (ec) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to rename ")(
+            bucket.directory_)
+            .Flush();
+        ::close(fd);
+        start_purge(lock, replacement);
+
+        return false;
+    }
+
+    boost::filesystem::rename(replacement, bucket.directory_, ec);
+
+    if (ec) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to replace ")(
+            bucket.directory_)
+            .Flush();
+        ::close(fd);
+        boost::filesystem::rename(purged, bucket.directory_, ec);
+        start_purge(lock, replacement);
+
+        return false;
+    }
+
+    sync_directory(folder_);
+    close(bucket);
+
+    {
+        auto index = std::unique_lock<std::shared_mutex>{lock_};
+        bucket.files_[0] = fd;
+    }
+
+    bucket.active_ = 0;
+    bucket.size_ = 0;
+    start_purge(lock, purged);
+
+    return true;
+}
+
+void StorageFSPacked::Init_StorageFSPacked()
+{
+    boost::system::error_code ec{};
+    boost::filesystem::create_directories(folder_, ec);
+    Lock lock(write_lock_);
+    sweep(lock);
+
+    for (auto i = std::size_t{0}; i < buckets_.size(); ++i) {
+        auto& bucket = buckets_.at(i);
+        bucket.directory_ =
+            folder_ + "/" +
+            ((0 == i) ? config_.fs_primary_bucket_
+                      : config_.fs_secondary_bucket_);
+        boost::filesystem::create_directories(bucket.directory_, ec);
+
+        if (false == load_bucket(bucket)) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to load ")(
+                bucket.directory_)
+                .Flush();
+
+            OT_FAIL;
+        }
+
+        if (bucket.files_.empty() && (false == open_segment(lock, bucket, 0))) {
+            OT_FAIL;
+        }
+    }
+}
+
+auto StorageFSPacked::load_bucket(Bucket& bucket) const -> bool
+{
+    static const auto suffix = std::string{OT_STORAGE_PACKED_SEGMENT_SUFFIX};
+    auto segments = std::map<std::uint32_t, std::string>{};
+    boost::system::error_code ec{};
+
+    for (const auto& entry :
+         boost::filesystem::directory_iterator(bucket.directory_, ec)) {
+        const auto name = entry.path().filename().string();
+
+        if ((name.size() <= suffix.size()) ||
+            (0 != name.compare(
+                      name.size() - suffix.size(), suffix.size(), suffix))) {
+            continue;
+        }
+
+        try {
+            const auto id = static_cast<std::uint32_t>(
+                std::stoul(name.substr(0, name.size() - suffix.size())));
+            segments.emplace(id, entry.path().string());
+        } catch (...) {
+            continue;
+        }
+    }
+
+    if (ec) { return false; }
+
+    for (const auto& [id, path] : segments) {
+        const auto fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+
+        if (-1 == fd) { return false; }
+
+        const auto tail = (id == segments.crbegin()->first);
+        bucket.files_.emplace(id, fd);
+        bucket.active_ = id;
+        bucket.size_ = scan(bucket, id, fd, tail);
+    }
+
+    LogVerbose(OT_METHOD)(__func__)(": Loaded ")(bucket.index_.size())(
+        " objects from ")(segments.size())(" segments in ")(bucket.directory_)
+        .Flush();
+
+    return true;
+}
+
+auto StorageFSPacked::LoadFromBucket(
+    const std::string& key,
+    std::string& value,
+    const bool bucket) const -> bool
+{
+    value.clear();
+    auto lock = std::shared_lock<std::shared_mutex>{lock_};
+    const auto& data = this->bucket(bucket);
+    const auto it = data.index_.find(key);
+
+    if (data.index_.end() == it) { return false; }
+
+    const auto& location = it->second;
+    const auto file = data.files_.find(location.segment_);
+
+    if (data.files_.end() == file) { return false; }
+
+    value.resize(location.size_);
+    auto* out = value.data();
+    auto remaining = std::size_t{location.size_};
+    auto offset = static_cast<off_t>(location.offset_);
+
+    while (0 < remaining) {
+        const auto read = ::pread(file->second, out, remaining, offset);
+
+        if (0 > read) {
+            if (EINTR == errno) { continue; }
+
+            value.clear();
+
+            return false;
+        } else if (0 == read) {
+            value.clear();
+
+            return false;
+        }
+
+        out += read;
+        remaining -= static_cast<std::size_t>(read);
+        offset += read;
+    }
+
+    return false == value.empty();
+}
+
+auto StorageFSPacked::LoadRoot() const -> std::string
+{
+    const auto fd = ::open(root_filename().c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (-1 == fd) { return {}; }
+
+    auto output = std::string{};
+    char buffer[256];
+
+    while (true) {
+        const auto read = ::read(fd, buffer, sizeof(buffer));
+
+        if (0 < read) {
+            output.append(buffer, static_cast<std::size_t>(read));
+        } else if ((0 > read) && (EINTR == errno)) {
+            continue;
+        } else {
+            break;
+        }
+    }
+
+    ::close(fd);
+
+    return output;
+}
+
+auto StorageFSPacked::open_segment(
+    const Lock& lock,
+    Bucket& bucket,
+    const std::uint32_t id) const -> bool
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto path = bucket.directory_ + "/" + segment_name(id);
+    const auto fd =
+        ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+    if (-1 == fd) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to create ")(path).Flush();
+
+        return false;
+    }
+
+    sync_directory(bucket.directory_);
+
+    {
+        auto index = std::unique_lock<std::shared_mutex>{lock_};
+        bucket.files_[id] = fd;
+    }
+
+    bucket.active_ = id;
+    bucket.size_ = 0;
+
+    return true;
+}
+
+void StorageFSPacked::purge(const std::string& path) const
+{
+    if (path.empty()) { return; }
+
+    boost::system::error_code ec{};
+    boost::filesystem::remove_all(path, ec);
+}
+
+auto StorageFSPacked::root_filename() const -> std::string
+{
+    OT_ASSERT(false == config_.fs_root_file_.empty());
+
+    return folder_ + "/" + config_.fs_root_file_;
+}
+
+// Indexes the records contained in a segment and returns the size of the
+// valid portion. Only the tail segment can contain an interrupted write, so
+// it is truncated at the first invalid record. Earlier segments were synced
+// before the next one was created: a corrupt record in one of them is
+// skipped so that the records following it remain available.
+auto StorageFSPacked::scan(
+    Bucket& bucket,
+    const std::uint32_t id,
+    const int fd,
+    const bool tail) const -> std::uint64_t
+{
+    struct stat info {
+    };
+
+    if (0 != ::fstat(fd, &info)) { return 0; }
+
+    auto data = std::string(static_cast<std::size_t>(info.st_size), '\0');
+    auto read = std::size_t{0};
+
+    while (read < data.size()) {
+        const auto bytes = ::pread(
+            fd,
+            data.data() + read,
+            data.size() - read,
+            static_cast<off_t>(read));
+
+        if (0 > bytes) {
+            if (EINTR == errno) { continue; }
+
+            break;
+        } else if (0 == bytes) {
+            break;
+        }
+
+        read += static_cast<std::size_t>(bytes);
+    }
+
+    data.resize(read);
+    auto position = std::size_t{0};
+
+    while ((position + OT_STORAGE_PACKED_HEADER_BYTES) <= data.size()) {
+        const auto* header = data.data() + position;
+        const auto keySize = std::size_t{read_u32(header)};
+        const auto valueSize = std::size_t{read_u32(header + 4)};
+        const auto expected = read_u32(header + 8);
+        const auto start = position + OT_STORAGE_PACKED_HEADER_BYTES;
+
+        if ((start + keySize + valueSize) > data.size()) { break; }
+
+        auto key = data.substr(start, keySize);
+        const auto value = data.substr(start + keySize, valueSize);
+        const auto next = start + keySize + valueSize;
+
+        if (checksum(key, value) != expected) {
+            if (tail) { break; }
+
+            LogOutput(OT_METHOD)(__func__)(": Skipping corrupt record at ")(
+                position)(" in segment ")(id)
+                .Flush();
+            position = next;
+
+            continue;
+        }
+
+        bucket.index_[std::move(key)] = Location{
+            id,
+            static_cast<std::uint64_t>(start + keySize),
+            static_cast<std::uint32_t>(valueSize)};
+        position = next;
+    }
+
+    if (false == tail) {
+        if (position < static_cast<std::size_t>(info.st_size)) {
+            LogOutput(OT_METHOD)(__func__)(": Ignoring ")(
+                static_cast<std::size_t>(info.st_size) - position)(
+                " trailing bytes in segment ")(id)
+                .Flush();
+        }
+
+        return position;
+    }
+
+    if (position < static_cast<std::size_t>(info.st_size)) {
+        LogOutput(OT_METHOD)(__func__)(": Discarding ")(
+            static_cast<std::size_t>(info.st_size) - position)(
+            " trailing bytes in segment ")(id)
+            .Flush();
+
+        if (0 != ::ftruncate(fd, static_cast<off_t>(position))) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to truncate segment")
+                .Flush();
+        }
+    }
+
+    return position;
+}
+
+auto StorageFSPacked::segment_name(const std::uint32_t id) -> std::string
+{
+    auto output = std::stringstream{};
+    output << std::setw(8) << std::setfill('0') << id
+           << OT_STORAGE_PACKED_SEGMENT_SUFFIX;
+
+    return output.str();
+}
+
+void StorageFSPacked::store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket,
+    std::promise<bool>* promise) const
+{
+    OT_ASSERT(nullptr != promise);
+
+    const auto now = Clock::now();
+    store_batch(Writes{Write{isTransaction, key, value, bucket, promise, now}});
+}
+
+void StorageFSPacked::store_batch(const Writes& batch) const
+{
+    auto items = std::array<Items, 2>{};
+
+    for (const auto& item : batch) {
+        items.at(item.bucket_ ? 1 : 0).emplace_back(&item);
+    }
+
+    Lock lock(write_lock_);
+
+    for (auto i = std::size_t{0}; i < items.size(); ++i) {
+        const auto& writes = items.at(i);
+
+        if (writes.empty()) { continue; }
+
+        const auto results = append(lock, buckets_.at(i), writes);
+
+        for (auto j = std::size_t{0}; j < writes.size(); ++j) {
+            writes.at(j)->promise_->set_value(results.at(j));
+        }
+    }
+}
+
+// Deletions interrupted by a shutdown or crash leave their renamed buckets
+// behind. They are not reachable from either bucket so they are removed
+// unconditionally.
+void StorageFSPacked::sweep(const Lock& lock) const
+{
+    static const auto prefix = std::string{OT_STORAGE_PACKED_PURGE_PREFIX};
+    boost::system::error_code ec{};
+
+    for (const auto& entry :
+         boost::filesystem::directory_iterator(folder_, ec)) {
+        const auto name = entry.path().filename().string();
+
+        if (0 != name.compare(0, prefix.size(), prefix)) { continue; }
+
+        LogVerbose(OT_METHOD)(__func__)(": Removing abandoned bucket ")(name)
+            .Flush();
+        start_purge(lock, entry.path().string());
+    }
+}
+
+void StorageFSPacked::start_purge(const Lock& lock, const std::string& path)
+    const
+{
+    OT_ASSERT(lock.owns_lock());
+
+    purges_.erase(
+        std::remove_if(
+            purges_.begin(),
+            purges_.end(),
+            [](const auto& purge) {
+                return std::future_status::ready ==
+                       purge.wait_for(std::chrono::seconds(0));
+            }),
+        purges_.end());
+    purges_.emplace_back(std::async(
+        std::launch::async, &StorageFSPacked::purge, this, path));
+}
+
+auto StorageFSPacked::StoreRoot(const bool, const std::string& hash) const
+    -> bool
+{
+    const auto filename = root_filename();
+    const auto temp = filename + ".tmp";
+    const auto fd =
+        ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+    if (-1 == fd) { return false; }
+
+    const auto written = write_all(fd, hash, 0) && sync(fd);
+    ::close(fd);
+
+    if ((false == written) ||
+        (0 != std::rename(temp.c_str(), filename.c_str()))) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to write root").Flush();
+
+        return false;
+    }
+
+    return sync_directory(folder_);
+}
+
+auto StorageFSPacked::sync(const int fd) -> bool
+{
+#if defined(__APPLE__)
+    return 0 == ::fcntl(fd, F_FULLFSYNC);
+#else
+    return 0 == ::fdatasync(fd);
+#endif
+}
+
+auto StorageFSPacked::sync_directory(const std::string& path) -> bool
+{
+    const auto fd = ::open(path.c_str(), O_DIRECTORY | O_RDONLY | O_CLOEXEC);
+
+    if (-1 == fd) { return false; }
+
+#if defined(__APPLE__)
+    const auto output = (0 == ::fcntl(fd, F_FULLFSYNC));
+#else
+    const auto output = (0 == ::fsync(fd));
+#endif
+    ::close(fd);
+
+    return output;
+}
+
+auto StorageFSPacked::write_all(
+    const int fd,
+    const std::string& data,
+    const std::uint64_t offset) -> bool
+{
+    const auto* in = data.data();
+    auto remaining = data.size();
+    auto position = static_cast<off_t>(offset);
+
+    while (0 < remaining) {
+        const auto written = ::pwrite(fd, in, remaining, position);
+
+        if (0 > written) {
+            if (EINTR == errno) { continue; }
+
+            return false;
+        }
+
+        in += written;
+        remaining -= static_cast<std::size_t>(written);
+        position += written;
+    }
+
+    return true;
+}
+
+StorageFSPacked::~StorageFSPacked() { Cleanup_StorageFSPacked(); }
+}  // namespace opentxs::storage::implementation
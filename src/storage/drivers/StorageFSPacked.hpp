@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/Version.hpp"
+#include "opentxs/api/storage/Driver.hpp"
+#include "storage/Plugin.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+namespace storage
+{
+class Plugin;
+class Storage;
+}  // namespace storage
+}  // namespace api
+
+class Factory;
+class Flag;
+class StorageConfig;
+}  // namespace opentxs
+
+namespace opentxs::storage::implementation
+{
+// Filesystem implementation of opentxs::storage which appends objects to a
+// small number of large segment files instead of creating one file per
+// object. The location of every object is held in an in-memory index which
+// is rebuilt from the segments on startup.
+//
+// Segments are never modified after being written. Space used by obsolete
+// objects is reclaimed by garbage collection: live objects are copied into
+// the segments of the other bucket and the old bucket is deleted as a whole.
+class StorageFSPacked final : public Plugin,
+                              public virtual opentxs::api::storage::Driver
+{
+public:
+    auto EmptyBucket(const bool bucket) const -> bool final;
+    auto LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const -> bool final;
+    auto LoadRoot() const -> std::string final;
+    auto StoreRoot(const bool commit, const std::string& hash) const
+        -> bool final;
+
+    void Cleanup() final;
+    void Cleanup_StorageFSPacked();
+
+    ~StorageFSPacked() final;
+
+private:
+    using ot_super = Plugin;
+
+    friend Factory;
+
+    struct Location {
+        std::uint32_t segment_{};
+        std::uint64_t offset_{};
+        std::uint32_t size_{};
+    };
+
+    struct Bucket {
+        std::string directory_{};
+        std::unordered_map<std::string, Location> index_{};
+        // Open file descriptors for every segment in the bucket
+        std::map<std::uint32_t, int> files_{};
+        // Segment receiving new objects and the number of bytes it contains.
+        // Only accessed while write_lock_ is held.
+        std::uint32_t active_{};
+        std::uint64_t size_{};
+    };
+
+    using Items = std::vector<const Write*>;
+
+    const std::string folder_;
+    const std::uint64_t segment_limit_;
+    // Serializes appends, segment creation and bucket deletion
+    mutable std::mutex write_lock_;
+    // Background deletions of emptied buckets. Only accessed while
+    // write_lock_ is held and waited for in Cleanup.
+    mutable std::vector<std::future<void>> purges_;
+    // Protects the index and the file descriptor map of both buckets
+    mutable std::shared_mutex lock_;
+    mutable std::array<Bucket, 2> buckets_;
+
+    static auto checksum(const std::string& key, const std::string& value)
+        -> std::uint32_t;
+    static auto segment_name(const std::uint32_t id) -> std::string;
+    static auto sync(const int fd) -> bool;
+    static auto sync_directory(const std::string& path) -> bool;
+    static auto write_all(
+        const int fd,
+        const std::string& data,
+        const std::uint64_t offset) -> bool;
+
+    // Returns whether each item was written and indexed
+    auto append(const Lock& lock, Bucket& bucket, const Items& items) const
+        -> std::vector<bool>;
+    auto bucket(const bool bucket) const -> Bucket&;
+    void close(Bucket& bucket) const;
+    auto load_bucket(Bucket& bucket) const -> bool;
+    auto open_segment(const Lock& lock, Bucket& bucket, const std::uint32_t id)
+        const -> bool;
+    void purge(const std::string& path) const;
+    void start_purge(const Lock& lock, const std::string& path) const;
+    void sweep(const Lock& lock) const;
+    auto root_filename() const -> std::string;
+    auto scan(
+        Bucket& bucket,
+        const std::uint32_t id,
+        const int fd,
+        const bool tail) const -> std::uint64_t;
+    void store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>* promise) const final;
+    void store_batch(const Writes& batch) const final;
+
+    void Init_StorageFSPacked();
+
+    StorageFSPacked(
+        const api::storage::Storage& storage,
+        const StorageConfig& config,
+        const Digest& hash,
+        const Random& random,
+        const Flag& bucket);
+    StorageFSPacked() = delete;
+    StorageFSPacked(const StorageFSPacked&) = delete;
+    StorageFSPacked(StorageFSPacked&&) = delete;
+    auto operator=(const StorageFSPacked&) -> StorageFSPacked& = delete;
+    auto operator=(StorageFSPacked&&) -> StorageFSPacked& = delete;
+};
+}  // namespace opentxs::storage::implementation
@@ -31,4 +31,14 @@ auto Factory::StorageFSGC(
 {
     return nullptr;
 }
+
+auto Factory::StorageFSPacked(
+    const api::storage::Storage& storage,
+    const StorageConfig& config,
+    const Digest& hash,
+    const Random& random,
+    const Flag& bucket) -> opentxs::api::storage::Plugin*
+{
+    return nullptr;
+}
 }  // namespace opentxs
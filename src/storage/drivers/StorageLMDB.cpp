@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                   // IWYU pragma: associated
 #include "storage/drivers/StorageLMDB.hpp"  // IWYU pragma: associated
 
+#include <exception>
 #include <string>
 #include <utility>
 
@@ -61,7 +62,7 @@ StorageLMDB::StorageLMDB(
 
 void StorageLMDB::Cleanup() { Cleanup_StorageLMDB(); }
 
-void StorageLMDB::Cleanup_StorageLMDB() {}
+void StorageLMDB::Cleanup_StorageLMDB() { stop_writer(); }
 
 auto StorageLMDB::EmptyBucket(const bool bucket) const -> bool
 {
@@ -84,8 +85,16 @@ auto StorageLMDB::LoadFromBucket(
     const bool bucket) const -> bool
 {
     value = {};
-    lmdb_.Load(
-        get_table(bucket), key, [&](const auto data) -> void { value = data; });
+    const auto table = get_table(bucket);
+    const auto cb = [&](const auto data) -> void { value = data; };
+
+    // NOTE objects are only committed along with the root hash. If root
+    // commits are batched then the tree may reference objects which are
+    // still pending, so the pending queue must be searched first.
+    const auto queued =
+        (0 < config_.commit_window_) && lmdb_.Queued(table, key, cb);
+
+    if (false == queued) { lmdb_.Load(table, key, cb); }
 
     return false == value.empty();
 }
@@ -117,6 +126,39 @@ void StorageLMDB::store(
     }
 }
 
+void StorageLMDB::store_batch(const Writes& batch) const
+{
+    auto success{true};
+
+    try {
+        auto tx = lmdb_.TransactionRW();
+
+        for (const auto& item : batch) {
+            if (item.transaction_) {
+                success &= lmdb_.Queue(
+                    get_table(item.bucket_), item.key_, item.value_);
+            } else {
+                success &= lmdb_
+                               .Store(
+                                   get_table(item.bucket_),
+                                   item.key_,
+                                   item.value_,
+                                   tx)
+                               .first;
+            }
+
+            if (false == success) { break; }
+        }
+
+        success &= tx.Finalize(success);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+        success = false;
+    }
+
+    for (const auto& item : batch) { item.promise_->set_value(success); }
+}
+
 auto StorageLMDB::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
@@ -73,6 +73,7 @@ private:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    void store_batch(const Writes& batch) const final;
 
     void Init_StorageLMDB();
 
@@ -48,9 +48,9 @@ public:
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
 
-    void Cleanup() final {}
+    void Cleanup() final { stop_writer(); }
 
-    ~StorageMemDB() final = default;
+    ~StorageMemDB() final { stop_writer(); }
 
 private:
     using ot_super = Plugin;
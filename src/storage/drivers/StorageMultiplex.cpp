@@ -23,6 +23,7 @@
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/crypto/key/Symmetric.hpp"
+#include "storage/ObjectCache.hpp"
 #include "storage/StorageConfig.hpp"
 #include "storage/tree/Root.hpp"
 #include "storage/tree/Tree.hpp"
@@ -133,7 +134,11 @@ auto StorageMultiplex::BestRoot(bool& primaryOutOfSync) -> std::string
 
 void StorageMultiplex::Cleanup() { Cleanup_StorageMultiplex(); }
 
-void StorageMultiplex::Cleanup_StorageMultiplex() {}
+void StorageMultiplex::Cleanup_StorageMultiplex()
+{
+    opentxs::storage::ObjectCache::Get().Clear(
+        static_cast<const api::storage::Driver*>(this));
+}
 
 auto StorageMultiplex::EmptyBucket(const bool bucket) const -> bool
 {
@@ -160,6 +165,8 @@ void StorageMultiplex::init(
         init_sqlite(plugin);
     } else if (OT_STORAGE_PRIMARY_PLUGIN_FS == primary) {
         init_fs(plugin);
+    } else if (OT_STORAGE_PRIMARY_PLUGIN_PACKED == primary) {
+        init_packed(plugin);
     }
 
     OT_ASSERT(plugin);
@@ -363,6 +370,10 @@ auto StorageMultiplex::Store(
 
     std::vector<std::promise<bool>> promises{};
     std::vector<std::future<bool>> futures{};
+    // NOTE the plugins hold pointers to these promises until the write
+    // completes so the vector must never reallocate
+    promises.reserve(1u + backup_plugins_.size());
+    futures.reserve(1u + backup_plugins_.size());
     promises.push_back(std::promise<bool>());
     auto& primaryPromise = promises.back();
     futures.push_back(primaryPromise.get_future());
@@ -108,6 +108,8 @@ private:
         -> void;
     auto init_memdb(std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
         -> void;
+    auto init_packed(std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
+        -> void;
     auto init_sqlite(std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
         -> void;
     auto Init_StorageMultiplex(
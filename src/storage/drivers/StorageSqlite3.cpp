@@ -7,9 +7,9 @@
 #include "1_Internal.hpp"                      // IWYU pragma: associated
 #include "storage/drivers/StorageSqlite3.hpp"  // IWYU pragma: associated
 
-#include <iostream>
 #include <limits>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -18,6 +18,10 @@
 #include "opentxs/core/LogSource.hpp"
 #include "storage/StorageConfig.hpp"
 
+// NOTE the writer thread and the other threads use separate connections
+// which wait this long for each other's write transactions
+#define OT_STORAGE_SQLITE3_BUSY_TIMEOUT_MILLISECONDS 10000
+
 #define OT_METHOD "opentxs::StorageSqlite3::"
 
 namespace opentxs
@@ -47,57 +51,75 @@ StorageSqlite3::StorageSqlite3(
     , transaction_lock_()
     , transaction_bucket_(Flag::Factory(false))
     , pending_()
-    , db_(nullptr)
+    , statement_lock_()
+    , db_()
+    , batch_()
 {
     Init_StorageSqlite3();
 }
 
-auto StorageSqlite3::bind_key(
-    const std::string& source,
-    const std::string& key,
-    const std::size_t start) const -> std::string
-{
-    OT_ASSERT(std::numeric_limits<int>::max() >= key.size());
-    OT_ASSERT(std::numeric_limits<int>::max() >= start);
-
-    sqlite3_stmt* statement{nullptr};
-    sqlite3_prepare_v2(db_, source.c_str(), -1, &statement, nullptr);
-    sqlite3_bind_text(
-        statement,
-        static_cast<int>(start),
-        key.c_str(),
-        static_cast<int>(key.size()),
-        SQLITE_STATIC);
-    const auto output = expand_sql(statement);
-    sqlite3_finalize(statement);
-
-    return output;
-}
-
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
-void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
+void StorageSqlite3::Cleanup_StorageSqlite3()
+{
+    stop_writer();
+    close(batch_);
+    Lock lock(statement_lock_);
+    close(db_);
+}
 
-void StorageSqlite3::commit(std::stringstream& sql) const
+auto StorageSqlite3::close(Connection& connection) noexcept -> void
 {
-    sql << "COMMIT TRANSACTION;";
+    for (auto& [sql, statement] : connection.statements_) {
+        sqlite3_finalize(statement);
+    }
+
+    connection.statements_.clear();
+    sqlite3_close(connection.db_);
+    connection.db_ = nullptr;
 }
 
 auto StorageSqlite3::commit_transaction(const std::string& rootHash) const
     -> bool
 {
     Lock lock(transaction_lock_);
-    std::stringstream sql{};
-    start_transaction(sql);
-    set_data(sql);
-    set_root(rootHash, sql);
-    commit(sql);
-    pending_.clear();
-    LogVerbose(OT_METHOD)(__func__)(sql.str()).Flush();
-
-    return (
-        SQLITE_OK ==
-        sqlite3_exec(db_, sql.str().c_str(), nullptr, nullptr, nullptr));
+    // NOTE the statement lock is held for the entire transaction so that no
+    // other write on this connection can become part of it
+    Lock statementLock(statement_lock_);
+
+    if (false == exec(db_, "BEGIN IMMEDIATE TRANSACTION;")) { return false; }
+
+    auto success{true};
+    const auto tablename = GetTableName(transaction_bucket_.get());
+
+    for (const auto& [key, value] : pending_) {
+        success = upsert(db_, key, tablename, value);
+
+        if (false == success) { break; }
+    }
+
+    if (success) {
+        success = upsert(
+            db_,
+            config_.sqlite3_root_key_,
+            config_.sqlite3_control_table_,
+            rootHash);
+    }
+
+    if (success) { success = exec(db_, "COMMIT TRANSACTION;"); }
+
+    if (success) {
+        LogVerbose(OT_METHOD)(__func__)(": Committed ")(pending_.size())(
+            " objects")
+            .Flush();
+        pending_.clear();
+    } else {
+        LogOutput(OT_METHOD)(__func__)(": Failed to commit transaction")
+            .Flush();
+        exec(db_, "ROLLBACK TRANSACTION;");
+    }
+
+    return success;
 }
 
 auto StorageSqlite3::Create(const std::string& tablename) const -> bool
@@ -106,8 +128,7 @@ auto StorageSqlite3::Create(const std::string& tablename) const -> bool
     const std::string tableFormat = " (k text PRIMARY KEY, v BLOB);";
     const std::string sql = createTable + "`" + tablename + "`" + tableFormat;
 
-    return (
-        SQLITE_OK == sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr));
+    return exec(db_, sql.c_str());
 }
 
 auto StorageSqlite3::EmptyBucket(const bool bucket) const -> bool
@@ -115,13 +136,11 @@ auto StorageSqlite3::EmptyBucket(const bool bucket) const -> bool
     return Purge(GetTableName(bucket));
 }
 
-auto StorageSqlite3::expand_sql(sqlite3_stmt* statement) const -> std::string
+auto StorageSqlite3::exec(const Connection& connection, const char* sql)
+    -> bool
 {
-    const auto sql = sqlite3_expanded_sql(statement);
-    const std::string output{sql};
-    sqlite3_free(sql);
-
-    return output;
+    return SQLITE_OK ==
+           sqlite3_exec(connection.db_, sql, nullptr, nullptr, nullptr);
 }
 
 auto StorageSqlite3::GetTableName(const bool bucket) const -> std::string
@@ -132,20 +151,18 @@ auto StorageSqlite3::GetTableName(const bool bucket) const -> std::string
 
 void StorageSqlite3::Init_StorageSqlite3()
 {
-    const std::string filename = folder_ + "/" + config_.sqlite3_db_file_;
+    const auto ready = [&] {
+        if (false == open(db_)) { return false; }
 
-    if (SQLITE_OK ==
-        sqlite3_open_v2(
-            filename.c_str(),
-            &db_,
-            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX,
-            nullptr)) {
-        sqlite3_exec(
-            db_, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+        exec(db_, "PRAGMA journal_mode=WAL;");
         Create(config_.sqlite3_primary_bucket_);
         Create(config_.sqlite3_secondary_bucket_);
         Create(config_.sqlite3_control_table_);
-    } else {
+
+        return open(batch_);
+    }();
+
+    if (false == ready) {
         LogOutput(OT_METHOD)(__func__)(": Failed to initialize database.")
             .Flush();
 
@@ -158,6 +175,21 @@ auto StorageSqlite3::LoadFromBucket(
     std::string& value,
     const bool bucket) const -> bool
 {
+    // NOTE objects are only committed along with the root hash. If root
+    // commits are batched then the tree may reference objects which are
+    // still pending, so the pending queue must be searched first.
+    if (0 < config_.commit_window_) {
+        Lock lock(transaction_lock_);
+
+        if (bucket == transaction_bucket_.get()) {
+            if (auto it = pending_.find(key); pending_.end() != it) {
+                value = it->second;
+
+                return false == value.empty();
+            }
+        }
+    }
+
     return Select(key, GetTableName(bucket), value);
 }
 
@@ -174,15 +206,90 @@ auto StorageSqlite3::LoadRoot() const -> std::string
     return "";
 }
 
+auto StorageSqlite3::open(Connection& connection) const -> bool
+{
+    const std::string filename = folder_ + "/" + config_.sqlite3_db_file_;
+
+    if (SQLITE_OK !=
+        sqlite3_open_v2(
+            filename.c_str(),
+            &connection.db_,
+            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX,
+            nullptr)) {
+
+        return false;
+    }
+
+    static const auto modes = std::set<std::string>{
+        "OFF", "NORMAL", "FULL", "EXTRA", "0", "1", "2", "3"};
+    const auto& mode = config_.sqlite3_synchronous_;
+    const auto synchronous = std::string{"PRAGMA synchronous="} +
+                             (modes.count(mode) ? mode : "FULL") + ";";
+    const auto mmap = std::string{"PRAGMA mmap_size="} +
+                      std::to_string(config_.sqlite3_mmap_size_) + ";";
+    const auto cache = std::string{"PRAGMA cache_size="} +
+                       std::to_string(config_.sqlite3_cache_size_) + ";";
+    sqlite3_busy_timeout(
+        connection.db_, OT_STORAGE_SQLITE3_BUSY_TIMEOUT_MILLISECONDS);
+    exec(connection, synchronous.c_str());
+    exec(connection, mmap.c_str());
+    exec(connection, cache.c_str());
+
+    return true;
+}
+
+auto StorageSqlite3::prepare(Connection& connection, const std::string& sql)
+    -> sqlite3_stmt*
+{
+    auto& statements = connection.statements_;
+
+    if (auto it = statements.find(sql); statements.end() != it) {
+
+        return it->second;
+    }
+
+    sqlite3_stmt* statement{nullptr};
+    const auto prepared = sqlite3_prepare_v2(
+        connection.db_,
+        sql.c_str(),
+        static_cast<int>(sql.size()),
+        &statement,
+        nullptr);
+
+    if (SQLITE_OK != prepared) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to prepare statement: ")(
+            sqlite3_errmsg(connection.db_))
+            .Flush();
+        sqlite3_finalize(statement);
+
+        return nullptr;
+    }
+
+    statements.emplace(sql, statement);
+
+    return statement;
+}
+
 auto StorageSqlite3::Purge(const std::string& tablename) const -> bool
 {
     const std::string sql = "DROP TABLE `" + tablename + "`;";
+    // NOTE dropping a table while another thread is stepping a statement on
+    // the same connection fails, and the writer connection must never
+    // observe the table missing, so the drop and the create are performed
+    // as a single transaction while holding the statement lock
+    Lock lock(statement_lock_);
 
-    if (SQLITE_OK ==
-        sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr)) {
-        return Create(tablename);
+    if (false == exec(db_, "BEGIN IMMEDIATE TRANSACTION;")) { return false; }
+
+    if (exec(db_, sql.c_str()) && Create(tablename) &&
+        exec(db_, "COMMIT TRANSACTION;")) {
+
+        return true;
     }
 
+    LogOutput(OT_METHOD)(__func__)(": Failed to purge ")(tablename).Flush();
+    exec(db_, "ROLLBACK TRANSACTION;");
+
     return false;
 }
 
@@ -191,12 +298,16 @@ auto StorageSqlite3::Select(
     const std::string& tablename,
     std::string& value) const -> bool
 {
-    sqlite3_stmt* statement{nullptr};
-    const std::string query =
-        "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
-    const auto sql = bind_key(query, key, 1);
-    sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, nullptr);
-    LogVerbose(OT_METHOD)(__func__)(sql).Flush();
+    OT_ASSERT(std::numeric_limits<int>::max() >= key.size());
+
+    Lock lock(statement_lock_);
+    auto* statement =
+        prepare(db_, "SELECT v FROM `" + tablename + "` WHERE k = ?1;");
+
+    if (nullptr == statement) { return false; }
+
+    sqlite3_bind_text(
+        statement, 1, key.c_str(), static_cast<int>(key.size()), SQLITE_STATIC);
     auto result = sqlite3_step(statement);
     bool success = false;
     std::size_t retry{3};
@@ -216,6 +327,7 @@ auto StorageSqlite3::Select(
             } break;
             case SQLITE_BUSY: {
                 LogOutput(OT_METHOD)(__func__)(": Busy.").Flush();
+                sqlite3_reset(statement);
                 result = sqlite3_step(statement);
                 --retry;
             } break;
@@ -223,112 +335,19 @@ auto StorageSqlite3::Select(
                 LogOutput(OT_METHOD)(__func__)(": Unknown error (")(
                     result)(").")
                     .Flush();
+                sqlite3_reset(statement);
                 result = sqlite3_step(statement);
                 --retry;
             }
         }
     }
 
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
 
     return success;
 }
 
-void StorageSqlite3::set_data(std::stringstream& sql) const
-{
-    OT_ASSERT(std::numeric_limits<int>::max() >= pending_.size());
-
-    sqlite3_stmt* data{nullptr};
-    std::stringstream dataSQL{};
-    const std::string tablename{GetTableName(transaction_bucket_.get())};
-    dataSQL << "INSERT OR REPLACE INTO '" << tablename << "' (k, v) VALUES ";
-    auto counter{0};
-    const auto size = static_cast<int>(pending_.size());
-
-    for (auto i{0}; i < size; ++i) {
-        dataSQL << "(?" << ++counter << ", ?";
-        dataSQL << ++counter << ")";
-
-        if (counter < (2 * size)) {
-            dataSQL << ", ";
-        } else {
-            dataSQL << "; ";
-        }
-    }
-
-    sqlite3_prepare_v2(db_, dataSQL.str().c_str(), -1, &data, nullptr);
-    counter = 0;
-
-    for (const auto& it : pending_) {
-        const auto& key = it.first;
-        const auto& value = it.second;
-
-        OT_ASSERT(std::numeric_limits<int>::max() >= key.size());
-        OT_ASSERT(std::numeric_limits<int>::max() >= value.size());
-
-        auto bound = sqlite3_bind_text(
-            data,
-            ++counter,
-            key.c_str(),
-            static_cast<int>(key.size()),
-            SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-
-        bound = sqlite3_bind_blob(
-            data,
-            ++counter,
-            value.c_str(),
-            static_cast<int>(value.size()),
-            SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-    }
-
-    sql << expand_sql(data) << " ";
-    sqlite3_finalize(data);
-}
-
-void StorageSqlite3::set_root(
-    const std::string& rootHash,
-    std::stringstream& sql) const
-{
-    OT_ASSERT(
-        std::numeric_limits<int>::max() >= config_.sqlite3_root_key_.size());
-    OT_ASSERT(std::numeric_limits<int>::max() >= rootHash.size());
-
-    sqlite3_stmt* root{nullptr};
-    std::stringstream rootSQL{};
-    rootSQL << "INSERT OR REPLACE INTO '" << config_.sqlite3_control_table_
-            << "'  (k, v) VALUES (?1, ?2); ";
-    sqlite3_prepare_v2(db_, rootSQL.str().c_str(), -1, &root, nullptr);
-    auto bound = sqlite3_bind_text(
-        root,
-        1,
-        config_.sqlite3_root_key_.c_str(),
-        static_cast<int>(config_.sqlite3_root_key_.size()),
-        SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    bound = sqlite3_bind_blob(
-        root,
-        2,
-        rootHash.c_str(),
-        static_cast<int>(rootHash.size()),
-        SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    sql << expand_sql(root) << " ";
-    sqlite3_finalize(root);
-}
-
-void StorageSqlite3::start_transaction(std::stringstream& sql) const
-{
-    sql << "BEGIN TRANSACTION; ";
-}
-
 void StorageSqlite3::store(
     const bool isTransaction,
     const std::string& key,
@@ -341,13 +360,66 @@ void StorageSqlite3::store(
     if (isTransaction) {
         Lock lock(transaction_lock_);
         transaction_bucket_->Set(bucket);
-        pending_.emplace_back(key, value);
+        pending_[key] = value;
         promise->set_value(true);
     } else {
         promise->set_value(Upsert(key, GetTableName(bucket), value));
     }
 }
 
+void StorageSqlite3::store_batch(const Writes& batch) const
+{
+    auto results = std::vector<bool>(batch.size(), false);
+    auto transaction = exec(batch_, "BEGIN IMMEDIATE TRANSACTION;");
+    // Writes which are only durable if the transaction commits
+    auto uncommitted = std::vector<std::size_t>{};
+
+    for (auto i = std::size_t{0}; i < batch.size(); ++i) {
+        const auto& item = batch.at(i);
+
+        if (item.transaction_) {
+            Lock lock(transaction_lock_);
+            transaction_bucket_->Set(item.bucket_);
+            pending_[item.key_] = item.value_;
+            results.at(i) = true;
+
+            continue;
+        }
+
+        const auto stored =
+            upsert(batch_, item.key_, GetTableName(item.bucket_), item.value_);
+        results.at(i) = stored;
+
+        if (false == transaction) { continue; }
+
+        if (stored) {
+            uncommitted.emplace_back(i);
+        } else if (0 != sqlite3_get_autocommit(batch_.db_)) {
+            // NOTE some errors abort the whole transaction, in which case the
+            // writes before this one were lost and the rest of the batch is
+            // written one item at a time
+            LogOutput(OT_METHOD)(__func__)(": Batch transaction aborted")
+                .Flush();
+
+            for (const auto index : uncommitted) { results.at(index) = false; }
+
+            uncommitted.clear();
+            transaction = false;
+        }
+    }
+
+    if (transaction && (false == exec(batch_, "COMMIT TRANSACTION;"))) {
+        LogOutput(OT_METHOD)(__func__)(": Failed to commit batch").Flush();
+        exec(batch_, "ROLLBACK TRANSACTION;");
+
+        for (const auto index : uncommitted) { results.at(index) = false; }
+    }
+
+    for (auto i = std::size_t{0}; i < batch.size(); ++i) {
+        batch.at(i).promise_->set_value(results.at(i));
+    }
+}
+
 auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
@@ -365,15 +437,27 @@ auto StorageSqlite3::Upsert(
     const std::string& key,
     const std::string& tablename,
     const std::string& value) const -> bool
+{
+    Lock lock(statement_lock_);
+
+    return upsert(db_, key, tablename, value);
+}
+
+auto StorageSqlite3::upsert(
+    Connection& connection,
+    const std::string& key,
+    const std::string& tablename,
+    const std::string& value) -> bool
 {
     OT_ASSERT(std::numeric_limits<int>::max() >= key.size());
     OT_ASSERT(std::numeric_limits<int>::max() >= value.size());
 
-    sqlite3_stmt* statement;
-    const std::string query =
-        "insert or replace into `" + tablename + "` (k, v) values (?1, ?2);";
+    auto* statement = prepare(
+        connection,
+        "INSERT OR REPLACE INTO `" + tablename + "` (k, v) VALUES (?1, ?2);");
+
+    if (nullptr == statement) { return false; }
 
-    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr);
     sqlite3_bind_text(
         statement, 1, key.c_str(), static_cast<int>(key.size()), SQLITE_STATIC);
     sqlite3_bind_blob(
@@ -382,9 +466,9 @@ auto StorageSqlite3::Upsert(
         value.c_str(),
         static_cast<int>(value.size()),
         SQLITE_STATIC);
-    LogVerbose(OT_METHOD)(__func__)(expand_sql(statement)).Flush();
     const auto result = sqlite3_step(statement);
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
 
     return (result == SQLITE_DONE);
 }
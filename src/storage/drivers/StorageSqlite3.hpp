@@ -11,7 +11,7 @@ extern "C" {
 
 #include <cstddef>
 #include <future>
-#include <iosfwd>
+#include <map>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -65,36 +65,53 @@ private:
 
     friend Factory;
 
+    // A connection to the database along with its prepared statements,
+    // indexed by their SQL text
+    struct Connection {
+        sqlite3* db_{nullptr};
+        std::map<std::string, sqlite3_stmt*> statements_{};
+    };
+
     std::string folder_;
     mutable std::mutex transaction_lock_;
     mutable OTFlag transaction_bucket_;
-    mutable std::vector<std::pair<const std::string, const std::string>>
-        pending_;
-    sqlite3* db_{nullptr};
+    // Objects waiting for the next root commit. Only the most recent value
+    // of each key is kept.
+    mutable std::map<std::string, std::string> pending_;
+    // A statement on this connection may only be bound or executed while
+    // statement_lock_ is held
+    mutable std::mutex statement_lock_;
+    mutable Connection db_;
+    // NOTE only used by the writer thread so that the transactions it opens
+    // for a batch do not capture or roll back unrelated writes
+    mutable Connection batch_;
 
-    auto bind_key(
-        const std::string& source,
+    static auto close(Connection& connection) noexcept -> void;
+    static auto exec(const Connection& connection, const char* sql) -> bool;
+    static auto prepare(Connection& connection, const std::string& sql)
+        -> sqlite3_stmt*;
+    static auto upsert(
+        Connection& connection,
         const std::string& key,
-        const std::size_t start) const -> std::string;
-    void commit(std::stringstream& sql) const;
+        const std::string& tablename,
+        const std::string& value) -> bool;
+
     auto commit_transaction(const std::string& rootHash) const -> bool;
     auto Create(const std::string& tablename) const -> bool;
-    auto expand_sql(sqlite3_stmt* statement) const -> std::string;
     auto GetTableName(const bool bucket) const -> std::string;
+    auto open(Connection& connection) const -> bool;
     auto Select(
         const std::string& key,
         const std::string& tablename,
         std::string& value) const -> bool;
     auto Purge(const std::string& tablename) const -> bool;
-    void set_data(std::stringstream& sql) const;
-    void set_root(const std::string& rootHash, std::stringstream& sql) const;
-    void start_transaction(std::stringstream& sql) const;
     void store(
         const bool isTransaction,
         const std::string& key,
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    void store_batch(const Writes& batch) const final;
     auto Upsert(
         const std::string& key,
         const std::string& tablename,
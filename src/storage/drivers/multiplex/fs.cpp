@@ -34,4 +34,13 @@ auto StorageMultiplex::init_fs_backup(const std::string& dir) -> void
     backup_plugins_.emplace_back(Factory::StorageFSArchive(
         storage_, config_, digest_, random_, primary_bucket_, dir, null_));
 }
+
+auto StorageMultiplex::init_packed(
+    std::unique_ptr<opentxs::api::storage::Plugin>& plugin) -> void
+{
+    LogVerbose(OT_METHOD)(__func__)(": Initializing primary packed plugin.")
+        .Flush();
+    plugin.reset(Factory::StorageFSPacked(
+        storage_, config_, digest_, random_, primary_bucket_));
+}
 }  // namespace opentxs::storage::implementation
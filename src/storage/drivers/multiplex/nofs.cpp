@@ -24,4 +24,11 @@ auto StorageMultiplex::init_fs_backup(const std::string& dir) -> void
 {
     return;
 }
+
+auto StorageMultiplex::init_packed(
+    std::unique_ptr<opentxs::api::storage::Plugin>& plugin) -> void
+{
+    LogOutput(OT_METHOD)(__func__)(": Filesystem driver not compiled in.")
+        .Flush();
+}
 }  // namespace opentxs::storage::implementation
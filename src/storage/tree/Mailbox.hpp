@@ -13,6 +13,11 @@
 #include "opentxs/protobuf/StorageNymList.pb.h"
 #include "storage/tree/Node.hpp"
 
+namespace ottest
+{
+class Test_StorageThread;
+}  // namespace ottest
+
 namespace opentxs
 {
 namespace api
@@ -31,6 +36,7 @@ class Mailbox final : public Node
 {
 private:
     friend Nym;
+    friend ottest::Test_StorageThread;
 
     void init(const std::string& hash) final;
     auto save(const std::unique_lock<std::mutex>& lock) const -> bool final;
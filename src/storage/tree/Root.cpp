@@ -32,9 +32,12 @@ Root::Root(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
     const std::int64_t interval,
-    Flag& bucket)
+    Flag& bucket,
+    const bool deferSave)
     : ot_super(storage, hash)
     , gc_interval_(interval)
+    , defer_save_(deferSave)
+    , dirty_(false)
     , gc_root_()
     , current_bucket_(bucket)
     , gc_running_(Flag::Factory(false))
@@ -43,6 +46,7 @@ Root::Root(
     , sequence_()
     , gc_lock_()
     , gc_thread_()
+    , gc_(storage)
     , tree_root_()
     , tree_lock_()
     , tree_()
@@ -66,13 +70,8 @@ void Root::blank(const VersionNumber version)
 
 void Root::cleanup() const
 {
-    Lock gclock(gc_lock_);
-
-    if (gc_thread_) {
-        if (gc_thread_->joinable()) { gc_thread_->join(); }
-
-        gc_thread_.reset();
-    }
+    gc_.Stop();
+    join_gc();
 }
 
 void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
@@ -85,6 +84,7 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
     if (resume) {
         oldLocation = !current_bucket_;
     } else {
+        flush_tree(lock);
         gc_root_ = tree()->Root();
         oldLocation = current_bucket_.Toggle();
         save(lock);
@@ -93,12 +93,24 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 
     lock.unlock();
     bool success{false};
+    gc_.Start();
 
     if (Node::check_hash(gc_root_)) {
-        const storage::Tree tree(driver_, gc_root_);
+        // NOTE the tree is loaded through the collector so that every
+        // migrated object is subject to throttling and pausing
+        const storage::Tree tree(gc_, gc_root_);
         success = tree.Migrate(*to);
     }
 
+    if (false == gc_.Finish(success)) {
+        // NOTE the saved root still indicates a collection in progress so
+        // this cycle will be resumed the next time storage is opened
+        LogTrace(OT_METHOD)(__func__)(": Garbage collection interrupted.")
+            .Flush();
+
+        return;
+    }
+
     if (success) {
         driver_.EmptyBucket(oldLocation);
     } else {
@@ -119,6 +131,52 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
     LogTrace(OT_METHOD)(__func__)(": Finished garbage collection.").Flush();
 }
 
+auto Root::commit() const -> std::string
+{
+    Lock lock(write_lock_);
+
+    if (dirty_) {
+        const bool saved = save(lock);
+
+        OT_ASSERT(saved);
+    }
+
+    return root_;
+}
+
+void Root::flush_tree(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    Lock treeLock(tree_lock_);
+
+    if (false == bool(tree_)) { return; }
+
+    auto& tree = *tree_;
+    treeLock.unlock();
+    Lock treeWriteLock(tree.write_lock_);
+
+    if (false == tree.dirty_) { return; }
+
+    const bool saved = tree.save(treeWriteLock);
+
+    OT_ASSERT(saved);
+
+    treeLock.lock();
+    tree_root_ = tree.root_;
+}
+
+void Root::join_gc() const
+{
+    Lock gclock(gc_lock_);
+
+    if (gc_thread_) {
+        if (gc_thread_->joinable()) { gc_thread_->join(); }
+
+        gc_thread_.reset();
+    }
+}
+
 void Root::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageRoot> serialized;
@@ -157,7 +215,7 @@ auto Root::Migrate(const opentxs::api::storage::Driver& to) const -> bool
         const auto running = gc_running_->Set(true);
 
         if (!running) {
-            cleanup();
+            join_gc();
             gc_thread_.reset(
                 new std::thread(&Root::collect_garbage, this, &to));
 
@@ -181,6 +239,7 @@ auto Root::save(const Lock& lock, const opentxs::api::storage::Driver& to) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
+    flush_tree(lock);
     auto serialized = serialize();
 
     if (false == proto::Validate(serialized, VERBOSE)) { return false; }
@@ -193,8 +252,11 @@ auto Root::save(const Lock& lock) const -> bool
     OT_ASSERT(verify_write_lock(lock));
 
     sequence_++;
+    const auto output = save(lock, driver_);
+
+    if (output) { dirty_ = false; }
 
-    return save(lock, driver_);
+    return output;
 }
 
 void Root::save(storage::Tree* tree, const Lock& lock)
@@ -203,6 +265,12 @@ void Root::save(storage::Tree* tree, const Lock& lock)
 
     OT_ASSERT(nullptr != tree);
 
+    if (defer_save_) {
+        dirty_ = true;
+
+        return;
+    }
+
     Lock treeLock(tree_lock_);
     tree_root_ = tree->root_;
     treeLock.unlock();
@@ -239,7 +307,13 @@ auto Root::tree() const -> storage::Tree*
 {
     Lock lock(tree_lock_);
 
-    if (!tree_) { tree_.reset(new storage::Tree(driver_, tree_root_)); }
+    if (!tree_) {
+        tree_.reset(new storage::Tree(driver_, tree_root_));
+
+        OT_ASSERT(tree_);
+
+        tree_->defer_save_ = defer_save_;
+    }
 
     OT_ASSERT(tree_);
 
@@ -18,6 +18,7 @@
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/protobuf/StorageRoot.pb.h"
+#include "storage/GarbageCollector.hpp"
 #include "storage/tree/Node.hpp"
 #include "storage/tree/Tree.hpp"
 
@@ -51,6 +52,10 @@ private:
     friend api::storage::implementation::Storage;
 
     const std::uint64_t gc_interval_{std::numeric_limits<std::int64_t>::max()};
+    // When set, updates to the tree only mark the tree and root dirty. The
+    // owner is responsible for calling commit.
+    const bool defer_save_;
+    mutable bool dirty_;
     mutable std::string gc_root_;
     Flag& current_bucket_;
     mutable OTFlag gc_running_;
@@ -59,7 +64,8 @@ private:
     mutable std::atomic<std::uint64_t> sequence_;
     mutable std::mutex gc_lock_;
     mutable std::unique_ptr<std::thread> gc_thread_;
-    std::string tree_root_;
+    GarbageCollector gc_;
+    mutable std::string tree_root_;
     mutable std::mutex tree_lock_;
     mutable std::unique_ptr<storage::Tree> tree_;
 
@@ -69,7 +75,10 @@ private:
     void blank(const VersionNumber version) final;
     void cleanup() const;
     void collect_garbage(const opentxs::api::storage::Driver* to) const;
+    auto commit() const -> std::string;
+    void flush_tree(const Lock& lock) const;
     void init(const std::string& hash) final;
+    void join_gc() const;
     auto save(const Lock& lock, const opentxs::api::storage::Driver& to) const
         -> bool;
     auto save(const Lock& lock) const -> bool final;
@@ -79,7 +88,8 @@ private:
         const opentxs::api::storage::Driver& storage,
         const std::string& hash,
         const std::int64_t interval,
-        Flag& bucket);
+        Flag& bucket,
+        const bool deferSave = false);
     Root() = delete;
     Root(const Root&) = delete;
     Root(Root&&) = delete;
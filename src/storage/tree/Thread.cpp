@@ -7,6 +7,9 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "storage/tree/Thread.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -16,18 +19,58 @@
 #include "opentxs/protobuf/Check.hpp"
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
+#include "opentxs/protobuf/StorageThreadPage.pb.h"
+#include "opentxs/protobuf/StorageThreadPageRef.pb.h"
 #include "opentxs/protobuf/verify/StorageThread.hpp"
 #include "opentxs/protobuf/verify/StorageThreadItem.hpp"
+#include "opentxs/protobuf/verify/StorageThreadPage.hpp"
 #include "storage/Plugin.hpp"
 #include "storage/tree/Mailbox.hpp"
 #include "storage/tree/Node.hpp"
 
+#define CURRENT_VERSION 2
+#define LEGACY_VERSION 1
+#define ITEM_VERSION 1
+#define PAGE_VERSION 1
+#define PAGE_REF_VERSION 1
+#define OT_STORAGE_THREAD_PAGE_SIZE 128
+
 #define OT_METHOD "opentxs::storage::Thread::"
 
 namespace opentxs
 {
 namespace storage
 {
+Thread::Page::Page(const std::uint32_t level, const bool byID) noexcept
+    : hash_(Node::BLANK_HASH)
+    , level_(level)
+    , by_id_(byID)
+    , loaded_(true)
+    , dirty_(true)
+    , count_(0)
+    , unread_(0)
+    , first_()
+    , children_()
+    , items_()
+{
+}
+
+Thread::Page::Page(
+    const proto::StorageThreadPageRef& ref,
+    const bool byID) noexcept
+    : hash_(ref.hash())
+    , level_(0)
+    , by_id_(byID)
+    , loaded_(false)
+    , dirty_(false)
+    , count_(ref.count())
+    , unread_(ref.unread())
+    , first_(ref.index(), static_cast<std::int64_t>(ref.time()), ref.id())
+    , children_()
+    , items_()
+{
+}
+
 Thread::Thread(
     const opentxs::api::storage::Driver& storage,
     const std::string& id,
@@ -41,13 +84,14 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
-    , items_()
+    , pages_()
+    , ids_()
     , participants_()
 {
     if (check_hash(hash)) {
         init(hash);
     } else {
-        blank(1);
+        blank(CURRENT_VERSION);
     }
 }
 
@@ -63,10 +107,11 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
-    , items_()
+    , pages_()
+    , ids_()
     , participants_(participants)
 {
-    blank(1);
+    blank(CURRENT_VERSION);
 }
 
 auto Thread::Add(
@@ -112,14 +157,15 @@ auto Thread::Add(
         return false;
     }
 
-    auto& item = items_[id];
-    item.set_version(version_);
+    auto item = proto::StorageThreadItem{};
+    item.set_version(ITEM_VERSION);
     item.set_id(id);
 
     if (0 == index) {
         item.set_index(index_++);
     } else {
         item.set_index(index);
+        index_ = std::max<std::size_t>(index_, index + 1);
     }
 
     item.set_time(time);
@@ -134,12 +180,16 @@ auto Thread::Add(
 
     const auto valid = proto::Validate(item, VERBOSE);
 
-    if (false == valid) {
-        items_.erase(id);
+    if (false == valid) { return false; }
 
-        return false;
+    if (const auto existing = find(lock, id); existing.has_value()) {
+        auto replaced = proto::StorageThreadItem{};
+        remove(pages_, existing.value(), replaced);
     }
 
+    insert(ids_, locator(item), true);
+    insert(pages_, std::move(item), false);
+
     return save(lock);
 }
 
@@ -150,6 +200,173 @@ auto Thread::Alias() const -> std::string
     return alias_;
 }
 
+auto Thread::build(
+    std::vector<proto::StorageThreadItem>&& items,
+    const bool byID) const -> std::unique_ptr<Page>
+{
+    if (items.empty()) { return {}; }
+
+    std::sort(
+        items.begin(), items.end(), [byID](const auto& lhs, const auto& rhs) {
+            return key(byID, lhs) < key(byID, rhs);
+        });
+    auto level = std::vector<std::unique_ptr<Page>>{};
+
+    for (auto& item : items) {
+        if (level.empty() ||
+            (OT_STORAGE_THREAD_PAGE_SIZE <= level.back()->items_.size())) {
+            level.emplace_back(std::make_unique<Page>(0, byID));
+        }
+
+        const auto sortKey = key(byID, item);
+        level.back()->items_.emplace(sortKey, std::move(item));
+    }
+
+    for (auto& page : level) { update(*page); }
+
+    while (1 < level.size()) {
+        auto next = std::vector<std::unique_ptr<Page>>{};
+
+        for (auto& page : level) {
+            const auto full = (false == next.empty()) &&
+                              (OT_STORAGE_THREAD_PAGE_SIZE <=
+                               next.back()->children_.size());
+
+            if (next.empty() || full) {
+                next.emplace_back(
+                    std::make_unique<Page>(page->level_ + 1, byID));
+            }
+
+            next.back()->children_.emplace_back(std::move(page));
+        }
+
+        for (auto& page : next) { update(*page); }
+
+        level.swap(next);
+    }
+
+    return std::move(level.front());
+}
+
+auto Thread::Check(const std::string& id) const -> bool
+{
+    Lock lock(write_lock_);
+
+    return find(lock, id).has_value();
+}
+
+auto Thread::collapse(std::unique_ptr<Page>& root) -> void
+{
+    if (false == bool(root)) { return; }
+
+    if (0 == root->count_) {
+        root.reset();
+
+        return;
+    }
+
+    while ((0 < root->level_) && (1 == root->children_.size())) {
+        auto child = std::move(root->children_.front());
+        root = std::move(child);
+    }
+}
+
+auto Thread::copy(
+    Page& page,
+    std::size_t& offset,
+    std::size_t& limit,
+    proto::StorageThread& output) const -> void
+{
+    if (0 == limit) { return; }
+
+    if (offset >= page.count_) {
+        offset -= page.count_;
+
+        return;
+    }
+
+    load(page, false);
+
+    if (0 == page.level_) {
+        auto it = std::next(
+            page.items_.begin(), static_cast<std::ptrdiff_t>(offset));
+        offset = 0;
+
+        for (; (page.items_.end() != it) && (0 < limit); ++it, --limit) {
+            *output.add_item() = it->second;
+        }
+    } else {
+        for (auto& child : page.children_) {
+            copy(*child, offset, limit, output);
+
+            if (0 == limit) { break; }
+        }
+    }
+}
+
+auto Thread::erase(
+    Page& page,
+    const SortKey& key,
+    proto::StorageThreadItem& removed) -> bool
+{
+    if (0 == page.level_) {
+        auto it = page.items_.find(key);
+
+        if (page.items_.end() == it) { return false; }
+
+        removed = std::move(it->second);
+        page.items_.erase(it);
+    } else {
+        const auto position = locate(page, key);
+        auto& child = *page.children_.at(position);
+        load(child, false);
+
+        if (false == erase(child, key, removed)) { return false; }
+
+        if (0 == child.count_) {
+            page.children_.erase(std::next(
+                page.children_.begin(), static_cast<std::ptrdiff_t>(position)));
+        }
+    }
+
+    page.dirty_ = true;
+    update(page);
+
+    return true;
+}
+
+// Descends the id index to the leaf which may contain the id, loading only
+// the pages on that path
+auto Thread::find(const Lock& lock, const std::string& id) const
+    -> std::optional<SortKey>
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (false == bool(ids_)) { return std::nullopt; }
+
+    const auto target = id_key(id);
+    auto* page = ids_.get();
+    load(*page, false);
+
+    while (0 < page->level_) {
+        page = page->children_.at(locate(*page, target)).get();
+        load(*page, false);
+    }
+
+    const auto it = page->items_.find(target);
+
+    if (page->items_.end() == it) { return std::nullopt; }
+
+    return key(it->second);
+}
+
+auto Thread::ID() const -> std::string { return id_; }
+
+auto Thread::id_key(const std::string& id) -> SortKey
+{
+    return SortKey{0, 0, id};
+}
+
 void Thread::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageThread> serialized;
@@ -161,74 +378,327 @@ void Thread::init(const std::string& hash)
         OT_FAIL;
     }
 
-    init_version(1, *serialized);
+    init_version(CURRENT_VERSION, *serialized);
 
     for (const auto& participant : serialized->participant()) {
         participants_.emplace(participant);
     }
 
-    for (const auto& it : serialized->item()) {
-        const auto& index = it.index();
-        items_.emplace(it.id(), it);
+    Lock lock(write_lock_);
 
-        if (index >= index_) { index_ = index + 1; }
-    }
+    if (CURRENT_VERSION > original_version_) {
+        // NOTE legacy threads store every item in the index file. Convert
+        // them to the paged format now so that later changes only touch the
+        // affected pages.
+        auto items = std::vector<proto::StorageThreadItem>{};
+        items.reserve(static_cast<std::size_t>(serialized->item_size()));
 
-    Lock lock(write_lock_);
-    upgrade(lock);
+        for (const auto& it : serialized->item()) {
+            const auto& index = it.index();
+            items.emplace_back(it);
+
+            if (index >= index_) { index_ = index + 1; }
+        }
+
+        upgrade(items);
+        auto locators = std::vector<proto::StorageThreadItem>{};
+        locators.reserve(items.size());
+        std::transform(
+            items.begin(),
+            items.end(),
+            std::back_inserter(locators),
+            [](const auto& item) { return locator(item); });
+        pages_ = build(std::move(items), false);
+        ids_ = build(std::move(locators), true);
+        save(lock);
+    } else {
+        index_ = serialized->nextindex();
+
+        if (serialized->has_root()) {
+            pages_ = std::make_unique<Page>(serialized->root(), false);
+            load(*pages_, false);
+        }
+
+        if (serialized->has_ids()) {
+            ids_ = std::make_unique<Page>(serialized->ids(), true);
+            load(*ids_, false);
+        } else if (pages_) {
+            // NOTE threads written before the id index existed must be read
+            // in full once to create it
+            const auto all =
+                range(lock, 0, std::numeric_limits<std::size_t>::max());
+            auto locators = std::vector<proto::StorageThreadItem>{};
+            locators.reserve(static_cast<std::size_t>(all.item_size()));
+
+            for (const auto& item : all.item()) {
+                locators.emplace_back(locator(item));
+            }
+
+            ids_ = build(std::move(locators), true);
+            save(lock);
+        }
+    }
 }
 
-auto Thread::Check(const std::string& id) const -> bool
+auto Thread::insert(Page& page, proto::StorageThreadItem&& item)
+    -> std::unique_ptr<Page>
 {
-    Lock lock(write_lock_);
+    const auto sortKey = key(page.by_id_, item);
+    page.dirty_ = true;
+
+    if (0 == page.level_) {
+        page.items_[sortKey] = std::move(item);
+    } else {
+        const auto position = locate(page, sortKey);
+        auto& child = *page.children_.at(position);
+        load(child, false);
+
+        if (auto sibling = insert(child, std::move(item)); sibling) {
+            page.children_.emplace(
+                std::next(
+                    page.children_.begin(),
+                    static_cast<std::ptrdiff_t>(position + 1)),
+                std::move(sibling));
+        }
+    }
+
+    update(page);
+    const auto size =
+        (0 == page.level_) ? page.items_.size() : page.children_.size();
+
+    if (OT_STORAGE_THREAD_PAGE_SIZE < size) { return split(page); }
 
-    return items_.end() != items_.find(id);
+    return {};
 }
 
-auto Thread::ID() const -> std::string { return id_; }
+auto Thread::insert(
+    std::unique_ptr<Page>& root,
+    proto::StorageThreadItem&& item,
+    const bool byID) -> void
+{
+    if (false == bool(root)) { root = std::make_unique<Page>(0, byID); }
+
+    if (auto sibling = insert(*root, std::move(item)); sibling) {
+        auto parent = std::make_unique<Page>(root->level_ + 1, byID);
+        parent->children_.emplace_back(std::move(root));
+        parent->children_.emplace_back(std::move(sibling));
+        update(*parent);
+        root = std::move(parent);
+    }
+}
 
 auto Thread::Items() const -> proto::StorageThread
 {
     Lock lock(write_lock_);
 
-    return serialize(lock);
+    return range(lock, 0, std::numeric_limits<std::size_t>::max());
+}
+
+auto Thread::key(const bool byID, const proto::StorageThreadItem& item)
+    -> SortKey
+{
+    if (byID) { return id_key(item.id()); }
+
+    return key(item);
+}
+
+auto Thread::key(const proto::StorageThreadItem& item) -> SortKey
+{
+    return SortKey{
+        item.index(), static_cast<std::int64_t>(item.time()), item.id()};
+}
+
+auto Thread::load(Page& page, const bool recursive) const -> void
+{
+    if (false == page.loaded_) {
+        std::shared_ptr<proto::StorageThreadPage> serialized;
+
+        if (false == driver_.LoadProto(page.hash_, serialized, false)) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to load thread page ")(
+                page.hash_)
+                .Flush();
+            OT_FAIL;
+        }
+
+        page.level_ = serialized->level();
+
+        for (const auto& item : serialized->item()) {
+            page.items_.emplace(key(page.by_id_, item), item);
+        }
+
+        for (const auto& ref : serialized->child()) {
+            auto& child = page.children_.emplace_back(
+                std::make_unique<Page>(ref, page.by_id_));
+            child->level_ = page.level_ - 1;
+        }
+
+        page.loaded_ = true;
+    }
+
+    if (recursive) {
+        for (auto& child : page.children_) { load(*child, true); }
+    }
+}
+
+auto Thread::locate(const Page& page, const SortKey& key) -> std::size_t
+{
+    const auto& children = page.children_;
+
+    OT_ASSERT(false == children.empty());
+
+    const auto it = std::upper_bound(
+        children.begin(),
+        children.end(),
+        key,
+        [](const auto& lhs, const auto& rhs) { return lhs < rhs->first_; });
+
+    if (children.begin() == it) { return 0; }
+
+    return static_cast<std::size_t>(std::distance(children.begin(), it)) - 1;
+}
+
+// Entries of the id index only need the fields which make up the sort key of
+// the item they refer to
+auto Thread::locator(const proto::StorageThreadItem& item)
+    -> proto::StorageThreadItem
+{
+    auto output = proto::StorageThreadItem{};
+    output.set_version(item.version());
+    output.set_id(item.id());
+    output.set_index(item.index());
+    output.set_time(item.time());
+    output.set_box(item.box());
+    output.set_unread(false);
+
+    return output;
 }
 
 auto Thread::Migrate(const opentxs::api::storage::Driver& to) const -> bool
 {
-    return Node::migrate(root_, to);
+    Lock lock(write_lock_);
+    auto output = Node::migrate(root_, to);
+
+    if (pages_) { output &= migrate(*pages_, to); }
+
+    if (ids_) { output &= migrate(*ids_, to); }
+
+    return output;
+}
+
+auto Thread::migrate(Page& page, const opentxs::api::storage::Driver& to) const
+    -> bool
+{
+    auto output = Node::migrate(page.hash_, to);
+
+    // NOTE leaves can be copied without parsing them
+    if (0 < page.level_) {
+        load(page, false);
+
+        for (auto& child : page.children_) { output &= migrate(*child, to); }
+    }
+
+    return output;
 }
 
-auto Thread::Read(const std::string& id, const bool unread) -> bool
+auto Thread::range(
+    const Lock& lock,
+    const std::size_t offset,
+    const std::size_t limit) const -> proto::StorageThread
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    proto::StorageThread output;
+    output.set_version(LEGACY_VERSION);
+    output.set_id(id_);
+
+    for (const auto& nym : participants_) {
+        if (!nym.empty()) { *output.add_participant() = nym; }
+    }
+
+    if (pages_) {
+        auto skip{offset};
+        auto remaining{limit};
+        copy(*pages_, skip, remaining, output);
+    }
+
+    return output;
+}
+
+auto Thread::Range(const std::size_t offset, const std::size_t limit) const
+    -> proto::StorageThread
 {
     Lock lock(write_lock_);
 
-    auto it = items_.find(id);
+    return range(lock, offset, limit);
+}
 
-    if (items_.end() == it) {
+auto Thread::Read(const std::string& id, const bool unread) -> bool
+{
+    Lock lock(write_lock_);
+    const auto existing = find(lock, id);
+
+    if (false == existing.has_value()) {
         LogOutput(OT_METHOD)(__func__)(": Item does not exist.").Flush();
 
         return false;
     }
 
-    auto& item = it->second;
+    OT_ASSERT(pages_);
 
-    item.set_unread(unread);
+    if (false == read(*pages_, existing.value(), unread)) { return false; }
 
     return save(lock);
 }
 
+auto Thread::read(Page& page, const SortKey& key, const bool unread) -> bool
+{
+    if (0 == page.level_) {
+        auto it = page.items_.find(key);
+
+        if (page.items_.end() == it) { return false; }
+
+        it->second.set_unread(unread);
+    } else {
+        auto& child = *page.children_.at(locate(page, key));
+        load(child, false);
+
+        if (false == read(child, key, unread)) { return false; }
+    }
+
+    page.dirty_ = true;
+    update(page);
+
+    return true;
+}
+
+auto Thread::reference(const Page& page) -> proto::StorageThreadPageRef
+{
+    auto output = proto::StorageThreadPageRef{};
+    output.set_version(PAGE_REF_VERSION);
+    output.set_hash(page.hash_);
+    output.set_count(page.count_);
+    output.set_unread(page.unread_);
+    output.set_index(std::get<0>(page.first_));
+    output.set_time(static_cast<std::uint64_t>(std::get<1>(page.first_)));
+    output.set_id(std::get<2>(page.first_));
+
+    return output;
+}
+
 auto Thread::Remove(const std::string& id) -> bool
 {
     Lock lock(write_lock_);
+    const auto existing = find(lock, id);
+
+    if (false == existing.has_value()) { return false; }
 
-    auto it = items_.find(id);
+    auto item = proto::StorageThreadItem{};
 
-    if (items_.end() == it) { return false; }
+    if (false == remove(pages_, existing.value(), item)) { return false; }
 
-    auto& item = it->second;
+    auto removed = proto::StorageThreadItem{};
+    remove(ids_, id_key(id), removed);
     auto box = static_cast<StorageBox>(item.box());
-    items_.erase(it);
 
     switch (box) {
         case StorageBox::MAILINBOX: {
@@ -247,6 +717,20 @@ auto Thread::Remove(const std::string& id) -> bool
     return save(lock);
 }
 
+auto Thread::remove(
+    std::unique_ptr<Page>& root,
+    const SortKey& key,
+    proto::StorageThreadItem& removed) -> bool
+{
+    OT_ASSERT(root);
+
+    if (false == erase(*root, key, removed)) { return false; }
+
+    collapse(root);
+
+    return true;
+}
+
 auto Thread::Rename(const std::string& newID) -> bool
 {
     Lock lock(write_lock_);
@@ -265,6 +749,10 @@ auto Thread::save(const Lock& lock) const -> bool
 {
     OT_ASSERT(verify_write_lock(lock));
 
+    if (pages_ && (false == save(*pages_))) { return false; }
+
+    if (ids_ && (false == save(*ids_))) { return false; }
+
     auto serialized = serialize(lock);
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
@@ -272,6 +760,35 @@ auto Thread::save(const Lock& lock) const -> bool
     return driver_.StoreProto(serialized, root_);
 }
 
+auto Thread::save(Page& page) const -> bool
+{
+    if (false == page.dirty_) { return true; }
+
+    proto::StorageThreadPage serialized;
+    serialized.set_version(PAGE_VERSION);
+    serialized.set_level(page.level_);
+
+    if (0 == page.level_) {
+        for (const auto& it : page.items_) {
+            *serialized.add_item() = it.second;
+        }
+    } else {
+        for (const auto& child : page.children_) {
+            if (false == save(*child)) { return false; }
+
+            *serialized.add_child() = reference(*child);
+        }
+    }
+
+    if (!proto::Validate(serialized, VERBOSE)) { return false; }
+
+    if (false == driver_.StoreProto(serialized, page.hash_)) { return false; }
+
+    page.dirty_ = false;
+
+    return true;
+}
+
 auto Thread::serialize(const Lock& lock) const -> proto::StorageThread
 {
     OT_ASSERT(verify_write_lock(lock));
@@ -284,14 +801,11 @@ auto Thread::serialize(const Lock& lock) const -> proto::StorageThread
         if (!nym.empty()) { *serialized.add_participant() = nym; }
     }
 
-    auto sorted = sort(lock);
+    if (pages_) { *serialized.mutable_root() = reference(*pages_); }
 
-    for (const auto& it : sorted) {
-        OT_ASSERT(nullptr != it.second);
+    if (ids_) { *serialized.mutable_ids() = reference(*ids_); }
 
-        const auto& item = *it.second;
-        *serialized.add_item() = item;
-    }
+    serialized.set_nextindex(index_);
 
     return serialized;
 }
@@ -305,62 +819,82 @@ auto Thread::SetAlias(const std::string& alias) -> bool
     return true;
 }
 
-auto Thread::sort(const Lock& lock) const -> Thread::SortedItems
+auto Thread::split(Page& page) -> std::unique_ptr<Page>
 {
-    OT_ASSERT(verify_write_lock(lock));
-
-    SortedItems output;
+    auto output = std::make_unique<Page>(page.level_, page.by_id_);
 
-    for (const auto& it : items_) {
-        const auto& id = it.first;
-        const auto& item = it.second;
+    if (0 == page.level_) {
+        auto& items = page.items_;
+        auto it = std::next(
+            items.begin(), static_cast<std::ptrdiff_t>(items.size() / 2));
 
-        if (!id.empty()) {
-            SortKey key{item.index(), item.time(), id};
-            output.emplace(key, &item);
+        while (items.end() != it) {
+            output->items_.insert(items.extract(it++));
         }
+    } else {
+        auto& children = page.children_;
+        auto it = std::next(
+            children.begin(), static_cast<std::ptrdiff_t>(children.size() / 2));
+        std::move(it, children.end(), std::back_inserter(output->children_));
+        children.erase(it, children.end());
     }
 
+    page.dirty_ = true;
+    update(page);
+    update(*output);
+
     return output;
 }
 
 auto Thread::UnreadCount() const -> std::size_t
 {
     Lock lock(write_lock_);
-    std::size_t output{0};
-
-    for (const auto& it : items_) {
-        const auto& item = it.second;
 
-        if (item.unread()) { ++output; }
-    }
+    if (pages_) { return pages_->unread_; }
 
-    return output;
+    return 0;
 }
 
-void Thread::upgrade(const Lock& lock)
+void Thread::update(Page& page)
 {
-    OT_ASSERT(verify_write_lock(lock));
+    page.count_ = 0;
+    page.unread_ = 0;
+
+    if (0 == page.level_) {
+        for (const auto& it : page.items_) {
+            ++page.count_;
 
-    bool changed{false};
+            if (it.second.unread()) { ++page.unread_; }
+        }
 
-    for (auto& it : items_) {
-        auto& item = it.second;
+        if (false == page.items_.empty()) {
+            page.first_ = page.items_.begin()->first;
+        }
+    } else {
+        for (const auto& child : page.children_) {
+            page.count_ += child->count_;
+            page.unread_ += child->unread_;
+        }
+
+        if (false == page.children_.empty()) {
+            page.first_ = page.children_.front()->first_;
+        }
+    }
+}
+
+void Thread::upgrade(std::vector<proto::StorageThreadItem>& items) const
+{
+    for (auto& item : items) {
         const auto box = static_cast<StorageBox>(item.box());
 
         switch (box) {
             case StorageBox::MAILOUTBOX: {
-                if (item.unread()) {
-                    item.set_unread(false);
-                    changed = true;
-                }
+                item.set_unread(false);
             } break;
             default: {
             }
         }
     }
-
-    if (changed) { save(lock); }
 }
 }  // namespace storage
 }  // namespace opentxs
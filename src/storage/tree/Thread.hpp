@@ -10,17 +10,26 @@
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "Proto.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
+#include "opentxs/protobuf/StorageThreadPageRef.pb.h"
 #include "storage/tree/Node.hpp"
 
+namespace ottest
+{
+class Test_StorageThread;
+}  // namespace ottest
+
 namespace opentxs
 {
 namespace api
@@ -42,28 +51,97 @@ namespace opentxs
 {
 namespace storage
 {
+// Thread items are stored in a tree of content-addressed pages so that
+// modifying a single item only rewrites the leaf which contains it and the
+// pages on the path to the root. Leaves are loaded on demand.
+//
+// A second tree of the same shape, ordered by item id, maps each id to the
+// index and time which locate the item in the first tree. Operations on a
+// single item load one path through each tree instead of every page.
 class Thread final : public Node
 {
 private:
     friend Threads;
+    friend ottest::Test_StorageThread;
     using SortKey = std::tuple<std::size_t, std::int64_t, std::string>;
-    using SortedItems = std::map<SortKey, const proto::StorageThreadItem*>;
+
+    struct Page {
+        std::string hash_;
+        std::uint32_t level_;
+        // True for pages of the id index
+        bool by_id_;
+        bool loaded_;
+        bool dirty_;
+        std::size_t count_;
+        std::size_t unread_;
+        SortKey first_;
+        std::vector<std::unique_ptr<Page>> children_;
+        std::map<SortKey, proto::StorageThreadItem> items_;
+
+        Page(const std::uint32_t level, const bool byID) noexcept;
+        Page(const proto::StorageThreadPageRef& ref, const bool byID) noexcept;
+    };
 
     std::string id_;
     std::string alias_;
     std::size_t index_;
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    std::map<std::string, proto::StorageThreadItem> items_;
+    mutable std::unique_ptr<Page> pages_;
+    mutable std::unique_ptr<Page> ids_;
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
 
+    static auto collapse(std::unique_ptr<Page>& root) -> void;
+    static auto id_key(const std::string& id) -> SortKey;
+    static auto key(const bool byID, const proto::StorageThreadItem& item)
+        -> SortKey;
+    static auto key(const proto::StorageThreadItem& item) -> SortKey;
+    static auto locate(const Page& page, const SortKey& key) -> std::size_t;
+    static auto locator(const proto::StorageThreadItem& item)
+        -> proto::StorageThreadItem;
+    static auto reference(const Page& page) -> proto::StorageThreadPageRef;
+    static auto split(Page& page) -> std::unique_ptr<Page>;
+    static void update(Page& page);
+
+    auto build(std::vector<proto::StorageThreadItem>&& items, const bool byID)
+        const -> std::unique_ptr<Page>;
+    auto copy(
+        Page& page,
+        std::size_t& offset,
+        std::size_t& limit,
+        proto::StorageThread& output) const -> void;
+    auto find(const Lock& lock, const std::string& id) const
+        -> std::optional<SortKey>;
     void init(const std::string& hash) final;
+    auto load(Page& page, const bool recursive) const -> void;
+    auto migrate(Page& page, const opentxs::api::storage::Driver& to) const
+        -> bool;
+    auto range(
+        const Lock& lock,
+        const std::size_t offset,
+        const std::size_t limit) const -> proto::StorageThread;
     auto save(const Lock& lock) const -> bool final;
+    auto save(Page& page) const -> bool;
     auto serialize(const Lock& lock) const -> proto::StorageThread;
-    auto sort(const Lock& lock) const -> SortedItems;
-    void upgrade(const Lock& lock);
+    void upgrade(std::vector<proto::StorageThreadItem>& items) const;
+
+    auto erase(
+        Page& page,
+        const SortKey& key,
+        proto::StorageThreadItem& removed) -> bool;
+    auto insert(Page& page, proto::StorageThreadItem&& item)
+        -> std::unique_ptr<Page>;
+    auto insert(
+        std::unique_ptr<Page>& root,
+        proto::StorageThreadItem&& item,
+        const bool byID) -> void;
+    auto read(Page& page, const SortKey& key, const bool unread) -> bool;
+    auto remove(
+        std::unique_ptr<Page>& root,
+        const SortKey& key,
+        proto::StorageThreadItem& removed) -> bool;
 
     Thread(
         const opentxs::api::storage::Driver& storage,
@@ -90,8 +168,21 @@ public:
     auto ID() const -> std::string;
     auto Items() const -> proto::StorageThread;
     auto Migrate(const opentxs::api::storage::Driver& to) const -> bool final;
+    /** Returns up to limit items in sort order starting at offset
+     *
+     *  Only the leaves which contain the requested items are loaded.
+     */
+    auto Range(const std::size_t offset, const std::size_t limit) const
+        -> proto::StorageThread;
     auto UnreadCount() const -> std::size_t;
 
+    /** Adds an item, replacing any existing item with the same id
+     *
+     *  Items without an explicit index are numbered sequentially. An
+     *  explicit index also advances the sequence past itself, which matches
+     *  the version 1 format where the next index was recalculated from the
+     *  stored items every time the thread was loaded.
+     */
     auto Add(
         const std::string& id,
         const std::uint64_t time,
@@ -111,6 +111,8 @@ Tree::Tree(const Tree& rhs)
     server_root_ = rhs.server_root_;
     unit_root_ = rhs.unit_root_;
     master_key_ = rhs.master_key_;
+    defer_save_ = rhs.defer_save_;
+    dirty_ = rhs.dirty_;
 }
 
 auto Tree::accounts() const -> storage::Accounts*
@@ -316,7 +318,11 @@ auto Tree::save(const Lock& lock) const -> bool
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    const auto output = driver_.StoreProto(serialized, root_);
+
+    if (output) { dirty_ = false; }
+
+    return output;
 }
 
 template <typename T>
@@ -340,6 +346,14 @@ void Tree::save_child(
     hash = input->Root();
     rootLock.unlock();
 
+    // NOTE in group commit mode the root object is responsible for saving
+    // the tree before the next commit
+    if (defer_save_) {
+        dirty_ = true;
+
+        return;
+    }
+
     if (false == save(lock)) {
         LogOutput(OT_METHOD)(__func__)(": Save error.").Flush();
         OT_FAIL
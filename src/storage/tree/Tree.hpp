@@ -114,6 +114,8 @@ private:
     mutable std::unique_ptr<storage::Units> units_;
     mutable std::mutex master_key_lock_;
     mutable std::shared_ptr<proto::Ciphertext> master_key_;
+    bool defer_save_{false};
+    mutable bool dirty_{false};
 
     template <typename T, typename... Args>
     auto get_child(
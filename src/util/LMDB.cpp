@@ -11,10 +11,18 @@ extern "C" {
 #include <lmdb.h>
 }
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <functional>
 #include <limits>
+#include <map>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
 
 #include "opentxs/Types.hpp"
@@ -31,6 +39,8 @@ extern "C" {
 #define OT_LMDB_SIZE 512_MiB
 #endif
 
+#define OT_LMDB_READER_POOL_SIZE 64
+
 #define OT_METHOD "opentxs::storage::lmdb::LMDB::"
 
 namespace opentxs::storage::lmdb
@@ -42,7 +52,10 @@ struct LMDB::Imp {
             auto lock = Lock{pending_lock_};
             auto tx = TransactionRW(nullptr);
             auto& success = tx.success_;
-            auto post = ScopeGuard{[&] { pending_.clear(); }};
+            auto post = ScopeGuard{[&] {
+                pending_.clear();
+                pending_index_.clear();
+            }};
 
             for (auto& [table, mode, index, data] : pending_) {
                 auto dbi = db_.at(table);
@@ -138,20 +151,8 @@ struct LMDB::Imp {
     auto Exists(const Table table, const ReadView index) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
-            MDB_cursor* cursor{nullptr};
-            auto post = ScopeGuard{[&] {
-                if (nullptr != cursor) {
-                    ::mdb_cursor_close(cursor);
-                    cursor = nullptr;
-                }
-            }};
-            const auto dbi = db_.at(table);
-
-            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
-                throw std::runtime_error{"Failed to get cursor"};
-            }
-
+            auto tx = ReadTransaction{*this};
+            auto* cursor = tx.Cursor(db_.at(table));
             auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
             auto value = MDB_val{};
 
@@ -169,19 +170,8 @@ struct LMDB::Imp {
         const Mode multiple) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
-            MDB_cursor* cursor{nullptr};
-            auto post = ScopeGuard{[&] {
-                if (nullptr != cursor) {
-                    ::mdb_cursor_close(cursor);
-                    cursor = nullptr;
-                }
-            }};
-            const auto dbi = db_.at(table);
-
-            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
-                throw std::runtime_error{"Failed to get cursor"};
-            }
+            auto tx = ReadTransaction{*this};
+            auto* cursor = tx.Cursor(db_.at(table));
 
             auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
             auto value = MDB_val{};
@@ -220,6 +210,42 @@ struct LMDB::Imp {
             return false;
         }
     }
+    auto Load(
+        const Table table,
+        const std::vector<ReadView>& keys,
+        const IndexedCallback cb) const noexcept -> bool
+    {
+        try {
+            auto tx = ReadTransaction{*this};
+            auto* cursor = tx.Cursor(db_.at(table));
+
+            for (auto i = std::size_t{0}; i < keys.size(); ++i) {
+                const auto& index = keys.at(i);
+                auto key =
+                    MDB_val{index.size(), const_cast<char*>(index.data())};
+                auto value = MDB_val{};
+                const auto rc =
+                    ::mdb_cursor_get(cursor, &key, &value, MDB_SET_KEY);
+
+                if (MDB_NOTFOUND == rc) { continue; }
+
+                if (0 != rc) {
+                    throw std::runtime_error{::mdb_strerror(rc)};
+                }
+
+                const auto again =
+                    cb(i, {static_cast<char*>(value.mv_data), value.mv_size});
+
+                if (false == again) { break; }
+            }
+
+            return true;
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+
+            return false;
+        }
+    }
     auto Queue(
         const Table table,
         const ReadView key,
@@ -227,30 +253,52 @@ struct LMDB::Imp {
         const Mode mode) const noexcept -> bool
     {
         auto lock = Lock{pending_lock_};
+        pending_index_[table][std::string{key}] = pending_.size();
         pending_.emplace_back(NewKey{table, mode, key, value});
 
         return true;
     }
+    auto Queued(const Table table, const ReadView key, const Callback cb)
+        const noexcept -> bool
+    {
+        auto lock = Lock{pending_lock_};
+        const auto keys = pending_index_.find(table);
+
+        if (pending_index_.end() == keys) { return false; }
+
+        const auto position = keys->second.find(key);
+
+        if (keys->second.end() == position) { return false; }
+
+        cb(std::get<3>(pending_.at(position->second)));
+
+        return true;
+    }
     auto Read(const Table table, const ReadCallback cb, const Dir dir)
         const noexcept -> bool
     {
         return read(db_.at(table), cb, dir);
     }
 
-    auto read(const MDB_dbi dbi, const ReadCallback cb, const Dir dir)
-        const noexcept -> bool
+    auto read(
+        const MDB_dbi dbi,
+        const ReadCallback cb,
+        const Dir dir,
+        const bool cache = true) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
+            auto tx = ReadTransaction{*this};
             MDB_cursor* cursor{nullptr};
             auto post = ScopeGuard{[&] {
-                if (nullptr != cursor) {
+                if ((false == cache) && (nullptr != cursor)) {
                     ::mdb_cursor_close(cursor);
                     cursor = nullptr;
                 }
             }};
 
-            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
+            if (cache) {
+                cursor = tx.Cursor(dbi);
+            } else if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
                 throw std::runtime_error{"Failed to get cursor"};
             }
 
@@ -310,7 +358,9 @@ struct LMDB::Imp {
         }
 
         LogNormal("Beginning database upgrade for ")(message).Flush();
-        read(dbi, cb, Dir::Forward);
+        // NOTE the table is about to be dropped so its cursor must not be
+        // cached
+        read(dbi, cb, Dir::Forward, false);
 
         if (0 != ::mdb_drop(&tx, dbi, 1)) {
             LogOutput(OT_METHOD)(__func__)(": Failed to delete table").Flush();
@@ -318,6 +368,11 @@ struct LMDB::Imp {
             return false;
         }
 
+        // NOTE the handle of the dropped table may be reused by a table
+        // opened later. Pooled cursors are looked up by handle so they must
+        // not survive this point.
+        invalidate_cursors();
+
         LogNormal("Finished database upgrade for ")(message).Flush();
 
         return true;
@@ -329,19 +384,8 @@ struct LMDB::Imp {
         const Dir dir) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
-            MDB_cursor* cursor{nullptr};
-            auto post = ScopeGuard{[&] {
-                if (nullptr != cursor) {
-                    ::mdb_cursor_close(cursor);
-                    cursor = nullptr;
-                }
-            }};
-            const auto dbi = db_.at(table);
-
-            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
-                throw std::runtime_error{"Failed to get cursor"};
-            }
+            auto tx = ReadTransaction{*this};
+            auto* cursor = tx.Cursor(db_.at(table));
 
             const auto next =
                 MDB_cursor_op{(Dir::Forward == dir) ? MDB_NEXT : MDB_PREV};
@@ -451,18 +495,68 @@ struct LMDB::Imp {
 
         return output;
     }
+    auto Submit(std::vector<Batch::Operation>&& operations) const noexcept
+        -> Batch::Future
+    {
+        auto promise = std::promise<bool>{};
+        auto output = promise.get_future().share();
+
+        if (operations.empty()) {
+            promise.set_value(true);
+
+            return output;
+        }
+
+        auto lock = Lock{batch_lock_};
+
+        if (false == running_) {
+            promise.set_value(false);
+
+            return output;
+        }
+
+        start_writer(lock);
+        batches_.emplace_back(std::move(operations), std::move(promise));
+        batch_cv_.notify_one();
+
+        return output;
+    }
+    auto SyncInterval(const std::chrono::milliseconds interval) const noexcept
+        -> bool
+    {
+        auto lock = Lock{batch_lock_};
+        const auto enable = interval > std::chrono::milliseconds{0};
+
+        if (0 != ::mdb_env_set_flags(env_, MDB_NOSYNC, enable ? 1 : 0)) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to set sync mode")
+                .Flush();
+
+            return false;
+        }
+
+        sync_interval_ = enable ? interval : std::chrono::milliseconds{0};
+
+        if (false == enable) { return 0 == ::mdb_env_sync(env_, 1); }
+
+        start_writer(lock);
+        batch_cv_.notify_one();
+
+        return true;
+    }
     auto TransactionRO() const noexcept(false) -> Transaction
     {
         return {env_, false, nullptr};
     }
     auto TransactionRW(MDB_txn* parent) const noexcept(false) -> Transaction
     {
-        return {
-            env_,
-            true,
-            (nullptr == parent) ? std::make_unique<Lock>(write_lock_)
-                                : std::make_unique<Lock>(),
-            parent};
+        if (nullptr == parent) {
+            auto lock = std::make_unique<Lock>(write_lock_);
+            unsynced();
+
+            return {env_, true, std::move(lock), parent};
+        }
+
+        return {env_, true, std::make_unique<Lock>(), parent};
     }
 
     Imp(const TableNames& names,
@@ -474,8 +568,20 @@ struct LMDB::Imp {
         , env_(nullptr)
         , db_()
         , pending_()
+        , pending_index_()
         , pending_lock_()
         , write_lock_()
+        , reader_lock_()
+        , readers_()
+        , cursor_epoch_(0)
+        , batch_lock_()
+        , batch_cv_()
+        , batches_()
+        , sync_interval_(0)
+        , unsynced_(false)
+        , unsynced_since_(Clock::now())
+        , running_(true)
+        , writer_()
     {
         init_environment(folder, init.size() + extraTables, flags);
         init_tables(init);
@@ -487,6 +593,21 @@ struct LMDB::Imp {
 
     ~Imp()
     {
+        {
+            auto lock = Lock{batch_lock_};
+            running_ = false;
+        }
+
+        batch_cv_.notify_all();
+
+        if (writer_.joinable()) { writer_.join(); }
+
+        if ((nullptr != env_) && deferred()) { ::mdb_env_sync(env_, 1); }
+
+        for (auto& reader : readers_) { close_reader(*reader); }
+
+        readers_.clear();
+
         if (nullptr != env_) {
             ::mdb_env_close(env_);
             env_ = nullptr;
@@ -494,15 +615,319 @@ struct LMDB::Imp {
     }
 
 private:
+    // Read transactions are reset instead of aborted when a lookup finishes
+    // and renewed by the next lookup. Each one keeps the cursors it has
+    // opened so they only need to be renewed rather than reallocated.
+    struct Reader {
+        MDB_txn* tx_{nullptr};
+        std::map<MDB_dbi, MDB_cursor*> cursors_{};
+        // Value of cursor_epoch_ when the cursors were opened
+        std::size_t epoch_{};
+    };
+
+    class ReadTransaction
+    {
+    public:
+        operator MDB_txn*() noexcept { return reader_->tx_; }
+
+        auto Cursor(const MDB_dbi dbi) noexcept(false) -> MDB_cursor*
+        {
+            auto& cursor = reader_->cursors_[dbi];
+
+            if (nullptr == cursor) {
+                if (0 != ::mdb_cursor_open(reader_->tx_, dbi, &cursor)) {
+                    reader_->cursors_.erase(dbi);
+
+                    throw std::runtime_error{"Failed to get cursor"};
+                }
+            }
+
+            return cursor;
+        }
+
+        ReadTransaction(const Imp& parent) noexcept(false)
+            : parent_(parent)
+            , reader_(parent_.get_reader())
+        {
+        }
+
+        ~ReadTransaction() { parent_.release_reader(std::move(reader_)); }
+
+    private:
+        const Imp& parent_;
+        std::unique_ptr<Reader> reader_;
+
+        ReadTransaction() = delete;
+        ReadTransaction(const ReadTransaction&) = delete;
+        ReadTransaction(ReadTransaction&&) = delete;
+        auto operator=(const ReadTransaction&) -> ReadTransaction& = delete;
+        auto operator=(ReadTransaction&&) -> ReadTransaction& = delete;
+    };
+
+    using Clock = std::chrono::steady_clock;
     using NewKey = std::tuple<Table, Mode, std::string, std::string>;
     using Pending = std::vector<NewKey>;
+    // Position in pending_ of the most recent write to each key
+    using PendingIndex =
+        std::map<Table, std::map<std::string, std::size_t, std::less<>>>;
+    using QueuedBatch =
+        std::pair<std::vector<Batch::Operation>, std::promise<bool>>;
 
     const TableNames& names_;
     mutable MDB_env* env_;
     mutable Databases db_;
     mutable Pending pending_;
+    mutable PendingIndex pending_index_;
     mutable std::mutex pending_lock_;
     mutable std::mutex write_lock_;
+    mutable std::mutex reader_lock_;
+    mutable std::vector<std::unique_ptr<Reader>> readers_;
+    mutable std::atomic<std::size_t> cursor_epoch_;
+    mutable std::mutex batch_lock_;
+    mutable std::condition_variable batch_cv_;
+    mutable std::deque<QueuedBatch> batches_;
+    mutable std::chrono::milliseconds sync_interval_;
+    // Set by every top level write transaction and cleared by the writer
+    // thread before it flushes the environment. Only modified while holding
+    // write_lock_.
+    mutable std::atomic<bool> unsynced_;
+    mutable Clock::time_point unsynced_since_;
+    mutable bool running_;
+    mutable std::thread writer_;
+
+    auto apply(MDB_txn* tx, const std::vector<Batch::Operation>& operations)
+        const noexcept(false) -> bool
+    {
+        for (const auto& [remove, table, index, data, flags] : operations) {
+            const auto dbi = db_.at(table);
+            auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
+
+            if (remove) {
+                auto value = data.has_value()
+                                 ? MDB_val{data->size(), const_cast<char*>(
+                                                             data->data())}
+                                 : MDB_val{};
+                const auto rc = ::mdb_del(
+                    tx, dbi, &key, data.has_value() ? &value : nullptr);
+
+                if ((0 != rc) && (MDB_NOTFOUND != rc)) {
+                    LogOutput(OT_METHOD)(__func__)(": Delete failed: ")(
+                        ::mdb_strerror(rc))
+                        .Flush();
+
+                    return false;
+                }
+            } else {
+                OT_ASSERT(data.has_value());
+
+                auto value =
+                    MDB_val{data->size(), const_cast<char*>(data->data())};
+                const auto rc = ::mdb_put(tx, dbi, &key, &value, flags);
+
+                if (0 != rc) {
+                    LogOutput(OT_METHOD)(__func__)(": Store failed: ")(
+                        ::mdb_strerror(rc))
+                        .Flush();
+
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+    static auto close_cursors(Reader& reader) noexcept -> void
+    {
+        for (auto& [dbi, cursor] : reader.cursors_) {
+            ::mdb_cursor_close(cursor);
+        }
+
+        reader.cursors_.clear();
+    }
+    static auto close_reader(Reader& reader) noexcept -> void
+    {
+        close_cursors(reader);
+
+        if (nullptr != reader.tx_) {
+            ::mdb_txn_abort(reader.tx_);
+            reader.tx_ = nullptr;
+        }
+    }
+    auto commit(std::deque<QueuedBatch>& batches) const noexcept -> void
+    {
+        auto results = std::vector<bool>(batches.size(), false);
+        auto committed{false};
+
+        try {
+            auto tx = TransactionRW(nullptr);
+            auto i = std::size_t{0};
+
+            for (const auto& [operations, promise] : batches) {
+                auto child = TransactionRW(tx);
+                auto applied{false};
+
+                try {
+                    applied = apply(child, operations);
+                } catch (const std::exception& e) {
+                    LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+                }
+
+                results.at(i++) = child.Finalize(applied) && applied;
+            }
+
+            committed = tx.Finalize(true);
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__func__)(": ")(e.what()).Flush();
+        }
+
+        auto i = std::size_t{0};
+
+        for (auto& [operations, promise] : batches) {
+            promise.set_value(committed && results.at(i++));
+        }
+    }
+    auto get_reader() const noexcept(false) -> std::unique_ptr<Reader>
+    {
+        auto output = std::unique_ptr<Reader>{};
+
+        {
+            auto lock = Lock{reader_lock_};
+
+            if (false == readers_.empty()) {
+                output = std::move(readers_.back());
+                readers_.pop_back();
+            }
+        }
+
+        const auto epoch = cursor_epoch_.load();
+
+        if (output) {
+            if (output->epoch_ != epoch) {
+                close_cursors(*output);
+                output->epoch_ = epoch;
+            }
+
+            if (0 == ::mdb_txn_renew(output->tx_)) {
+                auto& cursors = output->cursors_;
+
+                for (auto i = cursors.begin(); i != cursors.end();) {
+                    if (0 == ::mdb_cursor_renew(output->tx_, i->second)) {
+                        ++i;
+                    } else {
+                        ::mdb_cursor_close(i->second);
+                        i = cursors.erase(i);
+                    }
+                }
+
+                return output;
+            }
+
+            close_reader(*output);
+        } else {
+            output = std::make_unique<Reader>();
+            output->epoch_ = epoch;
+        }
+
+        if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &output->tx_)) {
+            throw std::runtime_error("Failed to start transaction");
+        }
+
+        return output;
+    }
+    auto invalidate_cursors() const noexcept -> void
+    {
+        ++cursor_epoch_;
+        auto lock = Lock{reader_lock_};
+
+        for (auto& reader : readers_) { close_cursors(*reader); }
+    }
+    auto release_reader(std::unique_ptr<Reader> reader) const noexcept -> void
+    {
+        if (false == bool(reader)) { return; }
+
+        ::mdb_txn_reset(reader->tx_);
+        auto lock = Lock{reader_lock_};
+
+        if (OT_LMDB_READER_POOL_SIZE > readers_.size()) {
+            readers_.emplace_back(std::move(reader));
+        } else {
+            lock.unlock();
+            close_reader(*reader);
+        }
+    }
+    auto start_writer(const Lock&) const noexcept -> void
+    {
+        if (false == writer_.joinable()) {
+            writer_ = std::thread{&Imp::write, this};
+        }
+    }
+    auto deferred() const noexcept -> bool
+    {
+        return sync_interval_ > std::chrono::milliseconds{0};
+    }
+    auto sync(Lock& lock) const noexcept -> void
+    {
+        lock.unlock();
+
+        {
+            // NOTE no write transaction can be open while the flag is
+            // cleared so every commit which preceded it is flushed below
+            auto write = Lock{write_lock_};
+            unsynced_ = false;
+        }
+
+        if (0 != ::mdb_env_sync(env_, 1)) {
+            LogOutput(OT_METHOD)(__func__)(": Failed to sync environment")
+                .Flush();
+        }
+
+        lock.lock();
+    }
+    auto unsynced() const noexcept -> void
+    {
+        if (unsynced_.exchange(true)) { return; }
+
+        auto lock = Lock{batch_lock_};
+        unsynced_since_ = Clock::now();
+
+        if (deferred()) { batch_cv_.notify_one(); }
+    }
+    auto write() const noexcept -> void
+    {
+        auto lock = Lock{batch_lock_};
+        auto work = std::deque<QueuedBatch>{};
+        const auto ready = [&] {
+            return (false == batches_.empty()) || (false == running_);
+        };
+        const auto due = [&] {
+            return deferred() && unsynced_ &&
+                   (Clock::now() >= (unsynced_since_ + sync_interval_));
+        };
+
+        while (true) {
+            // NOTE the writer only wakes up to flush the environment if
+            // something has been written since the last flush
+            if (deferred() && unsynced_) {
+                batch_cv_.wait_until(
+                    lock, unsynced_since_ + sync_interval_, ready);
+            } else {
+                batch_cv_.wait(
+                    lock, [&] { return ready() || (deferred() && unsynced_); });
+            }
+
+            if (false == batches_.empty()) {
+                work.swap(batches_);
+                lock.unlock();
+                commit(work);
+                work.clear();
+                lock.lock();
+            } else if (false == running_) {
+                break;
+            }
+
+            if (due()) { sync(lock); }
+        }
+    }
 
     auto init_db(const Table table, unsigned int flags) noexcept -> MDB_dbi
     {
@@ -551,7 +976,9 @@ private:
 
         OT_ASSERT(set);
 
-        set = 0 == ::mdb_env_open(env_, folder.c_str(), flags, 0664);
+        // NOTE read transactions are pooled and may be renewed by any thread
+        set = 0 ==
+              ::mdb_env_open(env_, folder.c_str(), flags | MDB_NOTLS, 0664);
 
         OT_ASSERT(set);
     }
@@ -579,6 +1006,111 @@ LMDB::LMDB(LMDB&& rhs) noexcept
 {
 }
 
+LMDB::Batch::Batch(Imp& parent) noexcept
+    : parent_(&parent)
+    , lock_(std::make_unique<std::mutex>())
+    , operations_()
+    , submitted_(false)
+{
+}
+
+LMDB::Batch::Batch(Batch&& rhs) noexcept
+    : parent_(rhs.parent_)
+    , lock_(std::move(rhs.lock_))
+    , operations_(std::move(rhs.operations_))
+    , submitted_(rhs.submitted_)
+{
+    rhs.parent_ = nullptr;
+}
+
+auto LMDB::Batch::add(Operation&& operation) noexcept -> Batch&
+{
+    if (false == bool(lock_)) { return *this; }
+
+    auto lock = Lock{*lock_};
+
+    if (submitted_) {
+        LogOutput(OT_METHOD)(__func__)(": Batch already submitted").Flush();
+    } else {
+        operations_.emplace_back(std::move(operation));
+    }
+
+    return *this;
+}
+
+auto LMDB::Batch::Delete(const Table table, const ReadView key) noexcept
+    -> Batch&
+{
+    return add({true, table, std::string{key}, std::nullopt, 0});
+}
+
+auto LMDB::Batch::Delete(
+    const Table table,
+    const std::size_t key,
+    const ReadView value) noexcept -> Batch&
+{
+    return Delete(
+        table,
+        ReadView{reinterpret_cast<const char*>(&key), sizeof(key)},
+        value);
+}
+
+auto LMDB::Batch::Delete(
+    const Table table,
+    const ReadView key,
+    const ReadView value) noexcept -> Batch&
+{
+    return add({true, table, std::string{key}, std::string{value}, 0});
+}
+
+auto LMDB::Batch::Store(
+    const Table table,
+    const ReadView key,
+    const ReadView value,
+    const Flags flags) noexcept -> Batch&
+{
+    return add({false, table, std::string{key}, std::string{value}, flags});
+}
+
+auto LMDB::Batch::Store(
+    const Table table,
+    const std::size_t key,
+    const ReadView value,
+    const Flags flags) noexcept -> Batch&
+{
+    return Store(
+        table,
+        ReadView{reinterpret_cast<const char*>(&key), sizeof(key)},
+        value,
+        flags);
+}
+
+auto LMDB::Batch::Submit() noexcept -> Future
+{
+    if ((nullptr == parent_) || (false == bool(lock_))) {
+        auto promise = std::promise<bool>{};
+        promise.set_value(false);
+
+        return promise.get_future().share();
+    }
+
+    auto lock = Lock{*lock_};
+
+    if (submitted_) {
+        LogOutput(OT_METHOD)(__func__)(": Batch already submitted").Flush();
+        auto promise = std::promise<bool>{};
+        promise.set_value(false);
+
+        return promise.get_future().share();
+    }
+
+    submitted_ = true;
+
+    return parent_->Submit(std::move(operations_));
+}
+
+LMDB::Batch::~Batch() = default;
+
 LMDB::Transaction::Transaction(
     MDB_env* env,
     const bool rw,
@@ -690,6 +1222,14 @@ auto LMDB::Load(
     return imp_->Load(table, index, cb, multiple);
 }
 
+auto LMDB::Load(
+    const Table table,
+    const std::vector<ReadView>& keys,
+    const IndexedCallback cb) const noexcept -> bool
+{
+    return imp_->Load(table, keys, cb);
+}
+
 auto LMDB::Load(
     const Table table,
     const std::size_t index,
@@ -712,6 +1252,12 @@ auto LMDB::Queue(
     return imp_->Queue(table, key, value, mode);
 }
 
+auto LMDB::Queued(const Table table, const ReadView key, const Callback cb)
+    const noexcept -> bool
+{
+    return imp_->Queued(table, key, cb);
+}
+
 auto LMDB::Read(const Table table, const ReadCallback cb, const Dir dir)
     const noexcept -> bool
 {
@@ -784,6 +1330,14 @@ auto LMDB::StoreOrUpdate(
     return imp_->StoreOrUpdate(table, index, cb, parent, flags);
 }
 
+auto LMDB::StartBatch() const noexcept -> Batch { return Batch{*imp_}; }
+
+auto LMDB::SyncInterval(const std::chrono::milliseconds interval) const noexcept
+    -> bool
+{
+    return imp_->SyncInterval(interval);
+}
+
 auto LMDB::TransactionRO() const noexcept(false) -> Transaction
 {
     return imp_->TransactionRO();
@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <future>
 #include <iosfwd>
 #include <map>
 #include <memory>
@@ -31,6 +33,8 @@ namespace opentxs::storage::lmdb
 {
 using Callback = std::function<void(const ReadView data)>;
 using Flags = unsigned int;
+using IndexedCallback =
+    std::function<bool(const std::size_t index, const ReadView value)>;
 using ReadCallback =
     std::function<bool(const ReadView key, const ReadView value)>;
 using Result = std::pair<bool, int>;
@@ -42,10 +46,83 @@ using UpdateCallback = std::function<Space(const ReadView data)>;
 
 class LMDB
 {
+private:
+    struct Imp;
+
 public:
     enum class Dir : bool { Forward = false, Backward = true };
     enum class Mode : bool { One = false, Multiple = true };
 
+    /** Collects writes to be committed asynchronously
+     *
+     *  A batch may be filled from several threads. Submitted batches are
+     *  committed by a dedicated writer thread which combines every batch
+     *  waiting in the queue into a single transaction. Each batch is applied
+     *  in its own nested transaction so a failed batch does not prevent the
+     *  others from being committed.
+     *
+     *  Deleting a key which does not exist is not an error.
+     */
+    class Batch
+    {
+    public:
+        using Future = std::shared_future<bool>;
+
+        auto Delete(const Table table, const ReadView key) noexcept -> Batch&;
+        auto Delete(
+            const Table table,
+            const std::size_t key,
+            const ReadView value) noexcept -> Batch&;
+        auto Delete(
+            const Table table,
+            const ReadView key,
+            const ReadView value) noexcept -> Batch&;
+        auto Store(
+            const Table table,
+            const ReadView key,
+            const ReadView value,
+            const Flags flags = 0) noexcept -> Batch&;
+        auto Store(
+            const Table table,
+            const std::size_t key,
+            const ReadView value,
+            const Flags flags = 0) noexcept -> Batch&;
+        /** Queue the batch for the writer thread
+         *
+         *  The returned future becomes ready when the transaction containing
+         *  the batch has been committed or aborted. A batch may only be
+         *  submitted once.
+         */
+        auto Submit() noexcept -> Future;
+
+        Batch(Batch&&) noexcept;
+        ~Batch();
+
+    private:
+        friend LMDB;
+
+        struct Operation {
+            bool delete_;
+            Table table_;
+            std::string key_;
+            std::optional<std::string> value_;
+            Flags flags_;
+        };
+
+        Imp* parent_;
+        std::unique_ptr<std::mutex> lock_;
+        std::vector<Operation> operations_;
+        bool submitted_;
+
+        auto add(Operation&& operation) noexcept -> Batch&;
+
+        Batch(Imp& parent) noexcept;
+        Batch() = delete;
+        Batch(const Batch&) = delete;
+        auto operator=(const Batch&) -> Batch& = delete;
+        auto operator=(Batch&&) -> Batch& = delete;
+    };
+
     struct Transaction {
         bool success_;
 
@@ -102,11 +179,24 @@ public:
         const std::size_t key,
         const Callback cb,
         const Mode mode = Mode::One) const noexcept -> bool;
+    /** Look up several keys in a single snapshot
+     *
+     *  The callback is executed for every key which exists, in the order
+     *  the keys were provided, with the position of that key in the
+     *  request. It may return false to stop early.
+     */
+    auto Load(
+        const Table table,
+        const std::vector<ReadView>& keys,
+        const IndexedCallback cb) const noexcept -> bool;
     auto Queue(
         const Table table,
         const ReadView key,
         const ReadView value,
         const Mode mode = Mode::One) const noexcept -> bool;
+    // Searches values which have been queued but not yet committed
+    auto Queued(const Table table, const ReadView key, const Callback cb)
+        const noexcept -> bool;
     auto Read(const Table table, const ReadCallback cb, const Dir dir)
         const noexcept -> bool;
     auto ReadAndDelete(
@@ -142,6 +232,18 @@ public:
         const UpdateCallback cb,
         MDB_txn* parent = nullptr,
         const Flags flags = 0) const noexcept -> Result;
+    auto StartBatch() const noexcept -> Batch;
+    /** Trade durability for commit throughput
+     *
+     *  A non-zero interval disables the fsync performed by every commit and
+     *  instead flushes the environment from the writer thread no later than
+     *  interval after the first unflushed commit, bounding the amount of data
+     *  an operating system crash can lose. The setting applies to every
+     *  transaction on this environment. A zero interval restores synchronous
+     *  commits.
+     */
+    auto SyncInterval(const std::chrono::milliseconds interval) const noexcept
+        -> bool;
     auto TransactionRO() const noexcept(false) -> Transaction;
     auto TransactionRW(MDB_txn* parent = nullptr) const noexcept(false)
         -> Transaction;
@@ -159,8 +261,6 @@ public:
     ~LMDB();
 
 private:
-    struct Imp;
-
     std::unique_ptr<Imp> imp_;
 
     auto read(const MDB_dbi dbi, const ReadCallback cb, const Dir dir)
@@ -9,7 +9,12 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
@@ -60,6 +65,45 @@ constexpr auto get_start_position(const std::size_t file) noexcept
     return file * target_file_size_;
 }
 
+static auto prefetch(std::vector<ReadView> views) noexcept -> void
+{
+#ifndef _WIN32
+    static const auto page =
+        static_cast<std::uintptr_t>(std::max(::sysconf(_SC_PAGESIZE), 1l));
+    const auto advise = [](std::uintptr_t begin, std::uintptr_t end) {
+        begin -= begin % page;
+        ::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+    };
+    std::sort(views.begin(), views.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.data() < rhs.data();
+    });
+    auto begin = std::uintptr_t{0};
+    auto end = std::uintptr_t{0};
+
+    for (const auto& view : views) {
+        if ((nullptr == view.data()) || (0 == view.size())) { continue; }
+
+        const auto start = reinterpret_cast<std::uintptr_t>(view.data());
+        const auto stop = start + view.size();
+
+        // NOTE adjacent items are coalesced so each run of pages is only
+        // advised once
+        if ((0 != end) && (start <= end + page)) {
+            end = std::max(end, stop);
+
+            continue;
+        }
+
+        if (0 != end) { advise(begin, end); }
+
+        begin = start;
+        end = stop;
+    }
+
+    if (0 != end) { advise(begin, end); }
+#endif
+}
+
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
 
@@ -141,6 +185,20 @@ struct MappedFileStorage::Imp {
 
         return ReadView{files_.at(file).const_data() + offset, index.size_};
     }
+    auto get_read_views(const std::vector<IndexData>& indices) noexcept
+        -> std::vector<ReadView>
+    {
+        auto output = std::vector<ReadView>{};
+        output.reserve(indices.size());
+
+        for (const auto& index : indices) {
+            output.emplace_back(get_read_view(index));
+        }
+
+        prefetch(output);
+
+        return output;
+    }
     auto get_write_view(
         LMDB::Transaction& tx,
         IndexData& index,
@@ -313,6 +371,13 @@ auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     return imp_.get_read_view(index);
 }
 
+auto MappedFileStorage::get_read_views(
+    const std::vector<IndexData>& indices) const noexcept
+    -> std::vector<ReadView>
+{
+    return imp_.get_read_views(indices);
+}
+
 auto MappedFileStorage::get_write_view(
     LMDB::Transaction& tx,
     IndexData& existing,
@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Version.hpp"
@@ -36,6 +37,10 @@ protected:
     // NOTE: this class performs no locking. Inheritors must ensure these
     // functions are not called simultaneously from multiple threads.
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
+    // Returns views in the same order as the supplied indices. The kernel is
+    // asked to read the underlying pages ahead of time in file order.
+    auto get_read_views(const std::vector<IndexData>& indices) const noexcept
+        -> std::vector<ReadView>;
     // Default construct an IndexData if you just want to append a new item, or
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"          // IWYU pragma: associated
+#include "1_Internal.hpp"        // IWYU pragma: associated
+#include "util/ParallelFor.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs
+{
+namespace
+{
+// NOTE helpers may outlive the call to ParallelFor so they share ownership
+// of this state. The chunk belongs to the caller and is only reached through
+// the pointer while unclaimed items remain, which prevents ParallelFor from
+// returning.
+struct Job {
+    const ParallelChunk* chunk_;
+    const std::size_t count_;
+    const std::size_t batch_;
+    std::atomic<std::size_t> next_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::size_t done_;
+
+    auto Run() noexcept -> void
+    {
+        while (true) {
+            const auto first = next_.fetch_add(batch_);
+
+            if (first >= count_) { return; }
+
+            const auto last = std::min(first + batch_, count_);
+
+            try {
+                (*chunk_)(first, last);
+            } catch (...) {
+            }
+
+            auto lock = Lock{lock_};
+            done_ += (last - first);
+
+            if (done_ == count_) { cv_.notify_all(); }
+        }
+    }
+    auto Wait() noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        cv_.wait(lock, [&] { return done_ == count_; });
+    }
+
+    Job(const ParallelChunk& chunk,
+        const std::size_t count,
+        const std::size_t batch) noexcept
+        : chunk_(&chunk)
+        , count_(count)
+        , batch_(std::max(batch, std::size_t{1}))
+        , next_(0)
+        , lock_()
+        , cv_()
+        , done_(0)
+    {
+    }
+};
+}  // namespace
+
+auto ParallelFor(
+    const std::size_t count,
+    const std::size_t batch,
+    const ParallelExecutor& executor,
+    const ParallelChunk& chunk) noexcept -> void
+{
+    if ((0u == count) || (false == bool(chunk))) { return; }
+
+    auto job = std::make_shared<Job>(chunk, count, batch);
+
+    if (executor) {
+        const auto batches = (count + job->batch_ - 1u) / job->batch_;
+        const auto helpers = std::min<std::size_t>(
+            batches - 1u, std::max(std::thread::hardware_concurrency(), 1u));
+
+        for (auto i = std::size_t{0}; i < helpers; ++i) {
+            if (false == executor([job] { job->Run(); })) { break; }
+        }
+    }
+
+    job->Run();
+    job->Wait();
+}
+}  // namespace opentxs
@@ -0,0 +1,35 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace opentxs
+{
+/// Processes items [first, last)
+using ParallelChunk =
+    std::function<void(const std::size_t first, const std::size_t last)>;
+/// Schedules a job on another thread. Returns false if it was not scheduled.
+using ParallelExecutor = std::function<bool(std::function<void()>)>;
+
+/** Processes count items in chunks of at most batch items
+ *
+ *  Up to one helper per hardware thread is scheduled on the executor while
+ *  the calling thread processes chunks as well, so progress does not depend
+ *  on the availability of executor threads. An empty executor processes
+ *  every chunk on the calling thread.
+ *
+ *  Chunks never overlap and every chunk has been processed when this
+ *  function returns. Helpers which start later than that find no work left
+ *  and never touch the chunk, so it may refer to state owned by the caller.
+ */
+auto ParallelFor(
+    const std::size_t count,
+    const std::size_t batch,
+    const ParallelExecutor& executor,
+    const ParallelChunk& chunk) noexcept -> void;
+}  // namespace opentxs
@@ -0,0 +1,111 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "util/Timer.hpp"  // IWYU pragma: associated
+
+#include <boost/asio.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace opentxs
+{
+struct Timer::Imp : public std::enable_shared_from_this<Imp> {
+    auto Cancel() noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        cancel(lock);
+    }
+    auto SetRelative(const std::chrono::microseconds& interval) noexcept
+        -> void
+    {
+        auto lock = Lock{lock_};
+        cancel(lock);
+
+        try {
+            timer_.expires_after(interval);
+        } catch (...) {
+        }
+    }
+    auto Wait(SimpleCallback&& cb) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        cb_ = std::move(cb);
+        const auto generation = ++generation_;
+        timer_.async_wait(
+            [imp = shared_from_this(),
+             generation](const boost::system::error_code& ec) {
+                if (ec) { return; }
+
+                // NOTE holding the lock while the callback executes prevents
+                // Cancel from returning before the callback has finished
+                auto lock = Lock{imp->lock_};
+
+                if (generation != imp->generation_) { return; }
+
+                auto cb = SimpleCallback{};
+                std::swap(cb, imp->cb_);
+
+                if (cb) { cb(); }
+            });
+    }
+
+    Imp(boost::asio::io_context& context) noexcept
+        : lock_()
+        , timer_(context)
+        , cb_()
+        , generation_(0)
+    {
+    }
+
+private:
+    std::mutex lock_;
+    boost::asio::steady_timer timer_;
+    SimpleCallback cb_;
+    std::uint64_t generation_;
+
+    auto cancel(const Lock&) noexcept -> void
+    {
+        ++generation_;
+        cb_ = {};
+
+        try {
+            timer_.cancel();
+        } catch (...) {
+        }
+    }
+};
+
+Timer::Timer(boost::asio::io_context& context) noexcept
+    : imp_(std::make_shared<Imp>(context))
+{
+}
+
+Timer::Timer(Timer&& rhs) noexcept
+    : imp_(std::move(rhs.imp_))
+{
+}
+
+auto Timer::Cancel() noexcept -> void
+{
+    if (imp_) { imp_->Cancel(); }
+}
+
+auto Timer::SetRelative(const std::chrono::microseconds& interval) noexcept
+    -> void
+{
+    if (imp_) { imp_->SetRelative(interval); }
+}
+
+auto Timer::Wait(SimpleCallback&& cb) noexcept -> void
+{
+    if (imp_) { imp_->Wait(std::move(cb)); }
+}
+
+Timer::~Timer() { Cancel(); }
+}  // namespace opentxs
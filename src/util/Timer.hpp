@@ -0,0 +1,48 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "opentxs/Types.hpp"
+
+namespace boost
+{
+namespace asio
+{
+class io_context;
+}  // namespace asio
+}  // namespace boost
+
+namespace opentxs
+{
+// One shot timer which executes its callback on an asio context. The
+// callback is never executed after Cancel returns or the timer is destroyed.
+class Timer
+{
+public:
+    auto Cancel() noexcept -> void;
+    auto SetRelative(const std::chrono::microseconds& interval) noexcept
+        -> void;
+    auto Wait(SimpleCallback&& cb) noexcept -> void;
+
+    Timer(boost::asio::io_context& context) noexcept;
+    Timer(Timer&&) noexcept;
+
+    ~Timer();
+
+private:
+    struct Imp;
+
+    std::shared_ptr<Imp> imp_;
+
+    Timer() = delete;
+    Timer(const Timer&) = delete;
+    auto operator=(const Timer&) -> Timer& = delete;
+    auto operator=(Timer&&) -> Timer& = delete;
+};
+}  // namespace opentxs
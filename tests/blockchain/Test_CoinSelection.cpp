@@ -0,0 +1,149 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include "blockchain/database/wallet/CoinSelection.hpp"
+#include "opentxs/Types.hpp"
+
+namespace ot = opentxs;
+namespace wallet = ot::blockchain::database::wallet;
+
+namespace ottest
+{
+class Test_CoinSelection : public ::testing::Test
+{
+public:
+    using Candidates = wallet::Candidates;
+    using Selection = wallet::Selection;
+
+    // Candidates are identified by their position so results can be
+    // compared directly
+    static auto candidates(const std::vector<ot::Amount>& values)
+        -> Candidates
+    {
+        auto output = Candidates{};
+        auto id = std::uint32_t{0};
+
+        for (const auto value : values) { output.emplace_back(value, id++); }
+
+        return output;
+    }
+    static auto selection(const ot::Amount target, const ot::Amount threshold)
+        -> Selection
+    {
+        auto output = Selection{};
+        output.target_ = target;
+        output.input_fee_ = 0;
+        output.change_threshold_ = threshold;
+
+        return output;
+    }
+    static auto sum(const Candidates& in) -> ot::Amount
+    {
+        auto output = ot::Amount{0};
+
+        for (const auto& [value, id] : in) { output += value; }
+
+        return output;
+    }
+};
+
+TEST_F(Test_CoinSelection, bnb_exact_match)
+{
+    const auto in = candidates({5000, 3000, 2000, 1000});
+    const auto out = wallet::SelectBnB(in, selection(4000, 0));
+
+    EXPECT_EQ(out, (Candidates{{3000, 1}, {1000, 3}}));
+}
+
+TEST_F(Test_CoinSelection, bnb_within_threshold)
+{
+    const auto in = candidates({5000, 3000, 2000});
+    const auto out = wallet::SelectBnB(in, selection(4800, 300));
+
+    EXPECT_EQ(out, (Candidates{{5000, 0}}));
+}
+
+TEST_F(Test_CoinSelection, bnb_no_solution)
+{
+    // Every combination either falls short or needs change
+    EXPECT_TRUE(
+        wallet::SelectBnB(candidates({5000, 3000}), selection(4000, 100))
+            .empty());
+    // Not enough value available at all
+    EXPECT_TRUE(
+        wallet::SelectBnB(candidates({2000, 1000}), selection(4000, 1000))
+            .empty());
+    EXPECT_TRUE(wallet::SelectBnB({}, selection(1, 0)).empty());
+}
+
+TEST_F(Test_CoinSelection, bnb_change_avoidance)
+{
+    // A single input would be closer in count but leaves excess, while two
+    // smaller inputs match the target exactly
+    const auto in = candidates({4200, 2500, 1500});
+    const auto out = wallet::SelectBnB(in, selection(4000, 300));
+
+    EXPECT_EQ(out, (Candidates{{2500, 1}, {1500, 2}}));
+}
+
+TEST_F(Test_CoinSelection, bnb_duplicate_values)
+{
+    const auto in = candidates({1000, 1000, 1000, 1000, 500});
+    const auto out = wallet::SelectBnB(in, selection(2500, 0));
+
+    EXPECT_EQ(sum(out), 2500);
+    EXPECT_EQ(out.size(), 3u);
+}
+
+TEST_F(Test_CoinSelection, knapsack_exact_match)
+{
+    const auto in = candidates({600, 400});
+    const auto out = wallet::SelectKnapsack(in, selection(700, 300), 1);
+
+    EXPECT_EQ(out, in);
+}
+
+TEST_F(Test_CoinSelection, knapsack_change_output)
+{
+    const auto target = selection(4000, 500);
+    const auto in = candidates({3000, 1000, 800, 600, 400, 300, 200, 100});
+
+    for (auto seed = std::uint64_t{0}; seed < 20; ++seed) {
+        const auto out = wallet::SelectKnapsack(in, target, seed);
+
+        // Every result leaves enough value to create a change output
+        EXPECT_GE(sum(out), target.target_ + target.change_threshold_);
+        // and is reproducible from its seed
+        EXPECT_EQ(out, wallet::SelectKnapsack(in, target, seed));
+    }
+}
+
+TEST_F(Test_CoinSelection, knapsack_prefers_single_larger)
+{
+    // The smaller candidates can not reach the target with change
+    const auto in = candidates({10000, 2000, 1000});
+    const auto out = wallet::SelectKnapsack(in, selection(3500, 500), 1);
+
+    EXPECT_EQ(out, (Candidates{{10000, 0}}));
+}
+
+TEST_F(Test_CoinSelection, knapsack_fallback)
+{
+    // Enough to cover the target, but not the target plus change, so the
+    // excess is given up as fee
+    const auto in = candidates({2000, 1500});
+    const auto out = wallet::SelectKnapsack(in, selection(3000, 1000), 1);
+
+    EXPECT_EQ(out, in);
+
+    // Not enough to cover the target
+    EXPECT_TRUE(wallet::SelectKnapsack(in, selection(4000, 1000), 1).empty());
+    EXPECT_TRUE(wallet::SelectKnapsack({}, selection(1, 0), 1).empty());
+}
+}  // namespace ottest
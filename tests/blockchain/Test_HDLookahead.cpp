@@ -0,0 +1,172 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/HDSeed.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/crypto/Account.hpp"
+#include "opentxs/blockchain/crypto/Element.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/HDProtocol.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/crypto/Bip32Child.hpp"
+#include "opentxs/crypto/Bip43Purpose.hpp"
+#include "opentxs/crypto/Bip44Type.hpp"
+#include "opentxs/crypto/Language.hpp"
+#include "opentxs/crypto/SeedStyle.hpp"
+#include "opentxs/crypto/Types.hpp"
+#include "opentxs/crypto/key/HD.hpp"  // IWYU pragma: keep
+#include "opentxs/identity/Nym.hpp"
+#include "paymentcode/VectorsV3.hpp"
+
+namespace ottest
+{
+class Test_HDLookahead : public ::testing::Test
+{
+protected:
+    using Subchain = ot::blockchain::crypto::Subchain;
+
+    // NOTE large enough that the lookahead is split over several batches
+    static constexpr auto count_{200u};
+
+    static std::string seed_id_;
+    static ot::Nym_p nym_;
+
+    const ot::api::client::Manager& api_;
+    const ot::OTPasswordPrompt reason_;
+    const ot::blockchain::crypto::HD& account_;
+
+    // Derive a key one at a time directly from the seed
+    auto serial(const Subchain subchain, const ot::Bip32Index index) const
+        -> ot::Space
+    {
+        constexpr auto hard =
+            static_cast<ot::Bip32Index>(ot::Bip32Child::HARDENED);
+        constexpr auto purpose =
+            static_cast<ot::Bip32Index>(ot::Bip43Purpose::HDWALLET) | hard;
+        constexpr auto coin =
+            static_cast<ot::Bip32Index>(ot::Bip44Type::TESTNET) | hard;
+        constexpr auto account = ot::Bip32Index{0} | hard;
+        const auto change = (Subchain::Internal == subchain) ? 1u : 0u;
+        const auto pKey = api_.Seeds().GetHDKey(
+            seed_id_,
+            ot::EcdsaCurve::secp256k1,
+            {purpose, coin, account, change, index},
+            reason_);
+
+        if (!pKey) { return {}; }
+
+        return ot::space(pKey->PublicKey());
+    }
+    // Every generated key must match the serially derived key at its index
+    auto verify(const Subchain subchain) const -> void
+    {
+        const auto last = account_.LastGenerated(subchain);
+
+        ASSERT_TRUE(last.has_value());
+
+        for (auto i = ot::Bip32Index{0}; i <= last.value(); ++i) {
+            const auto& element = account_.BalanceElement(subchain, i);
+            const auto pKey = element.Key();
+            const auto expected = serial(subchain, i);
+
+            ASSERT_TRUE(pKey);
+            ASSERT_FALSE(expected.empty());
+            EXPECT_EQ(element.Index(), i);
+            EXPECT_EQ(pKey->PublicKey(), ot::reader(expected));
+        }
+    }
+
+    Test_HDLookahead()
+        : api_(ot::Context().StartClient(0))
+        , reason_(api_.Factory().PasswordPrompt(__func__))
+        , account_([&]() -> const ot::blockchain::crypto::HD& {
+            if (seed_id_.empty()) {
+                const auto words =
+                    api_.Factory().SecretFromText(GetVectors3().alice_.words_);
+                const auto phrase = api_.Factory().Secret(0);
+                seed_id_ = api_.Seeds().ImportSeed(
+                    words,
+                    phrase,
+                    ot::crypto::SeedStyle::BIP39,
+                    ot::crypto::Language::en,
+                    reason_);
+            }
+
+            OT_ASSERT(0 < seed_id_.size());
+
+            if (!nym_) {
+                nym_ = api_.Wallet().Nym(reason_, "Alice", {seed_id_, 0});
+
+                OT_ASSERT(nym_);
+
+                api_.Blockchain().NewHDSubaccount(
+                    nym_->ID(),
+                    ot::blockchain::crypto::HDProtocol::BIP_44,
+                    ot::blockchain::Type::UnitTest,
+                    reason_);
+            }
+
+            return api_.Blockchain()
+                .Account(nym_->ID(), ot::blockchain::Type::UnitTest)
+                .GetHD()
+                .at(0);
+        }())
+    {
+    }
+};
+
+std::string Test_HDLookahead::seed_id_{};
+ot::Nym_p Test_HDLookahead::nym_{};
+
+TEST_F(Test_HDLookahead, batch_matches_serial)
+{
+    const auto reserved = account_.Reserve(Subchain::External, count_, reason_);
+
+    ASSERT_EQ(reserved.size(), count_);
+
+    for (auto i = ot::Bip32Index{0}; i < count_; ++i) {
+        EXPECT_EQ(reserved.at(i), i);
+    }
+
+    // The lookahead window is refilled beyond the reserved keys
+    EXPECT_GE(
+        account_.LastGenerated(Subchain::External).value_or(0),
+        count_ - 1u + account_.Lookahead());
+
+    verify(Subchain::External);
+}
+
+TEST_F(Test_HDLookahead, single_matches_serial)
+{
+    // After the initial window each reservation extends the lookahead by a
+    // single key so the work is not split
+    for (auto i = ot::Bip32Index{0}; i < count_; ++i) {
+        const auto next = account_.Reserve(Subchain::Internal, reason_);
+
+        ASSERT_TRUE(next.has_value());
+        EXPECT_EQ(next.value(), i);
+    }
+
+    verify(Subchain::Internal);
+}
+
+TEST_F(Test_HDLookahead, shutdown) { nym_.reset(); }
+}  // namespace ottest
@@ -0,0 +1,185 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/endian/buffers.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "blockchain/activity/Helpers.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"
+
+namespace ottest
+{
+class Test_LegacyPreimages : public Test_BlockchainActivity
+{
+public:
+    using CompactSize = ot::network::blockchain::bitcoin::CompactSize;
+    using Input =
+        std::unique_ptr<ot::blockchain::block::bitcoin::internal::Input>;
+    using Output =
+        std::unique_ptr<ot::blockchain::block::bitcoin::internal::Output>;
+    using SigHash = ot::blockchain::bitcoin::SigHash;
+    using SigOption = ot::blockchain::bitcoin::SigOption;
+    using Subchain = ot::blockchain::crypto::Subchain;
+    using UTXO = ot::factory::UTXO;
+
+    static constexpr auto chain_{ot::blockchain::Type::Bitcoin};
+    static constexpr auto outputs_{2u};
+
+    // Spendable outputs paying to keys in the first test account
+    auto utxos(const std::size_t count) const -> std::vector<UTXO>
+    {
+        const auto& hd =
+            api_.Blockchain().HDSubaccount(nym_1_id(), account_1_id());
+        auto output = std::vector<UTXO>{};
+
+        while (output.size() < count) {
+            const auto first = hd.Reserve(Subchain::External, reason_);
+            const auto second = hd.Reserve(Subchain::External, reason_);
+
+            OT_ASSERT(first.has_value());
+            OT_ASSERT(second.has_value());
+
+            const auto tx = get_test_transaction(
+                hd.BalanceElement(Subchain::External, first.value()),
+                hd.BalanceElement(Subchain::External, second.value()));
+
+            OT_ASSERT(tx);
+
+            for (auto i = std::uint32_t{0};
+                 (i < tx->Outputs().size()) && (output.size() < count);
+                 ++i) {
+                auto& [outpoint, proto] = output.emplace_back(
+                    ot::blockchain::block::Outpoint{tx->ID().Bytes(), i},
+                    ot::proto::BlockchainTransactionOutput{});
+
+                const auto serialized =
+                    tx->Outputs().at(i).Serialize(api_.Blockchain(), proto);
+
+                OT_ASSERT(serialized);
+            }
+        }
+
+        return output;
+    }
+    // Every preimage must match the reference serialization of a transaction
+    // spending the same inputs
+    auto check(const std::size_t count, const bool anyoneCanPay) const -> void
+    {
+        const auto spends = utxos(count);
+        const auto script = spends.at(0).second.script();
+        auto inputs = std::vector<Input>{};
+        auto copies = std::vector<Input>{};
+        auto outputs = std::vector<Output>{};
+        auto legacy = ot::blockchain::bitcoin::LegacyPreimages{};
+        legacy.version_ = 1;
+        legacy.locktime_ = 0;
+
+        for (const auto& utxo : spends) {
+            const auto& input =
+                inputs.emplace_back(ot::factory::BitcoinTransactionInput(
+                    api_, api_.Blockchain(), chain_, utxo));
+
+            ASSERT_TRUE(input);
+
+            const auto& copy = copies.emplace_back(input->SignatureVersion());
+
+            ASSERT_TRUE(copy);
+
+            auto& bytes = legacy.inputs_.emplace_back();
+
+            ASSERT_TRUE(copy->Serialize(ot::writer(bytes)).has_value());
+        }
+
+        for (auto i = std::uint32_t{0}; i < outputs_; ++i) {
+            const auto& out = outputs.emplace_back(
+                ot::factory::BitcoinTransactionOutput(
+                    api_,
+                    api_.Blockchain(),
+                    chain_,
+                    i,
+                    1000u * (i + 1u),
+                    CompactSize{script.size()},
+                    script));
+
+            ASSERT_TRUE(out);
+        }
+
+        {
+            const auto cs = CompactSize{outputs_};
+            auto& preimage = legacy.outputs_;
+
+            ASSERT_TRUE(cs.Encode(ot::writer(preimage)));
+
+            for (const auto& out : outputs) {
+                auto bytes = ot::Space{};
+
+                ASSERT_TRUE(out->Serialize(ot::writer(bytes)).has_value());
+
+                preimage.insert(preimage.end(), bytes.begin(), bytes.end());
+            }
+        }
+
+        const auto tx = ot::factory::BitcoinTransaction(
+            api_,
+            api_.Blockchain(),
+            chain_,
+            ot::Clock::now(),
+            legacy.version_,
+            legacy.locktime_,
+            false,
+            ot::factory::BitcoinTransactionInputs(std::move(copies)),
+            ot::factory::BitcoinTransactionOutputs(std::move(outputs)));
+
+        ASSERT_TRUE(tx);
+
+        const auto sigHash = SigHash{chain_, SigOption::All, anyoneCanPay};
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            auto expected = tx->ForTestingOnlyGetPreimageBTC(i, sigHash);
+
+            ASSERT_FALSE(expected.empty());
+
+            expected.insert(expected.end(), sigHash.begin(), sigHash.end());
+            const auto preimage = legacy.Preimage(i, sigHash, *inputs.at(i));
+
+            EXPECT_EQ(
+                api_.Factory().Data(ot::reader(preimage))->asHex(),
+                api_.Factory().Data(ot::reader(expected))->asHex());
+        }
+    }
+};
+
+TEST_F(Test_LegacyPreimages, all_inputs)
+{
+    for (const auto count : {1u, 2u, 5u}) { check(count, false); }
+}
+
+TEST_F(Test_LegacyPreimages, anyone_can_pay)
+{
+    for (const auto count : {1u, 2u, 5u}) { check(count, true); }
+}
+}  // namespace ottest
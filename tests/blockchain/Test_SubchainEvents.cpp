@@ -0,0 +1,143 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+#include "blockchain/node/wallet/SubchainStateData.hpp"
+#include "opentxs/Types.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_SubchainEvents : public ::testing::Test
+{
+public:
+    using Event = ot::blockchain::node::wallet::SubchainStateData::Event;
+    using EventQueue =
+        ot::blockchain::node::wallet::SubchainStateData::EventQueue;
+    using Events = std::vector<Event>;
+
+    static const Events all_;
+
+    EventQueue queue_;
+
+    // Every phase of the state machine is reached only through the handler,
+    // so an event which is not passed to it can not query an oracle
+    auto run(const bool enabled, const std::optional<Event> stop = {})
+        -> Events
+    {
+        auto output = Events{};
+        queue_.Run(enabled, [&](const auto type, const auto) {
+            output.emplace_back(type);
+
+            return stop == type;
+        });
+
+        return output;
+    }
+
+    Test_SubchainEvents()
+        : queue_()
+    {
+    }
+};
+
+const Test_SubchainEvents::Events Test_SubchainEvents::all_{
+    Event::reorg,
+    Event::blocks,
+    Event::key,
+    Event::mempool,
+    Event::filter,
+    Event::block,
+};
+
+TEST_F(Test_SubchainEvents, initial_pass)
+{
+    EXPECT_TRUE(queue_.Pending());
+    EXPECT_EQ(run(true), all_);
+    EXPECT_FALSE(queue_.Pending());
+}
+
+TEST_F(Test_SubchainEvents, idle)
+{
+    run(true);
+
+    ASSERT_FALSE(queue_.Pending());
+
+    for (auto i = 0; i < 10; ++i) {
+        EXPECT_TRUE(run(true).empty());
+        EXPECT_TRUE(run(false).empty());
+    }
+}
+
+TEST_F(Test_SubchainEvents, one_phase_per_event)
+{
+    run(true);
+
+    for (const auto type : all_) {
+        queue_.Post(type);
+
+        EXPECT_TRUE(queue_.Pending());
+        EXPECT_EQ(run(true), Events{type});
+        EXPECT_FALSE(queue_.Pending());
+    }
+}
+
+TEST_F(Test_SubchainEvents, repeated_events)
+{
+    run(true);
+
+    for (auto i = 0; i < 3; ++i) {
+        queue_.Post(Event::filter);
+        queue_.Post(Event::key);
+    }
+
+    // Repeated events are handled once, in state machine order
+    EXPECT_EQ(run(true), (Events{Event::key, Event::filter}));
+    EXPECT_TRUE(run(true).empty());
+}
+
+TEST_F(Test_SubchainEvents, disabled)
+{
+    // Only local phases advance while the chain is not enabled
+    EXPECT_EQ(run(false), (Events{Event::key, Event::mempool}));
+    EXPECT_TRUE(queue_.Pending());
+    EXPECT_EQ(
+        run(true),
+        (Events{Event::reorg, Event::blocks, Event::filter, Event::block}));
+    EXPECT_FALSE(queue_.Pending());
+}
+
+TEST_F(Test_SubchainEvents, stop_after_job)
+{
+    // A phase which starts a job ends the pass and leaves the later events
+    // pending
+    EXPECT_EQ(run(true, Event::blocks), (Events{Event::reorg, Event::blocks}));
+    EXPECT_TRUE(queue_.Pending());
+    EXPECT_EQ(
+        run(true),
+        (Events{Event::key, Event::mempool, Event::filter, Event::block}));
+    EXPECT_FALSE(queue_.Pending());
+}
+
+TEST_F(Test_SubchainEvents, statistics)
+{
+    queue_.Run(true, [&](const auto type, const auto posted) {
+        queue_.Record(type, posted);
+
+        return false;
+    });
+
+    for (const auto type : all_) {
+        const auto stats = queue_.Statistics(type);
+
+        EXPECT_EQ(stats.count_, 1u);
+        EXPECT_GE(stats.total_, stats.max_);
+    }
+}
+}  // namespace ottest
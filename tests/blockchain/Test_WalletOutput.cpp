@@ -0,0 +1,422 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "blockchain/activity/Helpers.hpp"
+#include "blockchain/database/Wallet.hpp"
+#include "internal/api/client/Client.hpp"
+#include "internal/api/network/Network.hpp"
+#include "internal/blockchain/database/Database.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"
+#include "opentxs/protobuf/BlockchainTransactionProposal.pb.h"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+
+namespace ottest
+{
+class Test_WalletOutput : public Test_BlockchainActivity
+{
+public:
+    using Balance = ot::blockchain::Balance;
+    using Selection = ot::blockchain::database::Wallet::Selection;
+    using Spend = ot::blockchain::database::Wallet::Spend;
+    using State = ot::blockchain::database::Wallet::State;
+    using Subchain = ot::blockchain::crypto::Subchain;
+    using Wallet = ot::blockchain::database::Wallet;
+
+    static constexpr auto chain_{ot::blockchain::Type::Bitcoin};
+    static const ot::storage::lmdb::TableNames names_;
+
+    const ot::api::client::internal::Blockchain& blockchain_;
+    const fs::path path_;
+    std::unique_ptr<ot::storage::lmdb::LMDB> lmdb_;
+    std::unique_ptr<Wallet> wallet_;
+
+    using UTXO = Wallet::UTXO;
+
+    // Every output must be the matching output of the transaction
+    static auto check(
+        const std::vector<UTXO>& outputs,
+        const Transaction& tx) -> void
+    {
+        for (const auto& [outpoint, data] : outputs) {
+            ASSERT_EQ(outpoint.Txid(), tx.ID().Bytes());
+            ASSERT_LT(outpoint.Index(), tx.Outputs().size());
+            EXPECT_EQ(
+                data.value(),
+                static_cast<std::uint64_t>(
+                    tx.Outputs().at(outpoint.Index()).Value()));
+            EXPECT_EQ(data.index(), outpoint.Index());
+        }
+    }
+    static auto value(const Transaction& tx) -> ot::Amount
+    {
+        auto output = ot::Amount{0};
+
+        for (const auto& out : tx.Outputs()) { output += out.Value(); }
+
+        return output;
+    }
+
+    auto position(const ot::blockchain::block::Height height) const
+        -> ot::blockchain::block::Position
+    {
+        return {
+            height,
+            api_.Factory().Data(
+                std::string(32u, static_cast<char>(height)),
+                ot::StringStyle::Raw)};
+    }
+    // Build a transaction with two outputs paying to new keys in the account
+    auto receive(
+        const ot::identifier::Nym& nym,
+        const ot::Identifier& account) const
+        -> std::unique_ptr<const Transaction>
+    {
+        const auto& hd = api_.Blockchain().HDSubaccount(nym, account);
+        const auto first = hd.Reserve(Subchain::External, reason_);
+        const auto second = hd.Reserve(Subchain::External, reason_);
+
+        if ((false == first.has_value()) || (false == second.has_value())) {
+            return {};
+        }
+
+        return get_test_transaction(
+            hd.BalanceElement(Subchain::External, first.value()),
+            hd.BalanceElement(Subchain::External, second.value()));
+    }
+    auto restart() -> void
+    {
+        wallet_.reset();
+        wallet_ = std::make_unique<Wallet>(
+            api_,
+            blockchain_,
+            api_.Network().Blockchain().Internal().Database(),
+            *lmdb_,
+            chain_);
+    }
+
+    Test_WalletOutput()
+        : blockchain_(
+              dynamic_cast<const ot::api::client::internal::Blockchain&>(
+                  api_.Blockchain()))
+        , path_(fs::temp_directory_path() / fs::unique_path())
+        , lmdb_()
+        , wallet_()
+    {
+        namespace db = ot::blockchain::database;
+        fs::create_directories(path_);
+        lmdb_ = std::make_unique<ot::storage::lmdb::LMDB>(
+            names_,
+            path_.string(),
+            ot::storage::lmdb::TablesToInit{
+                {db::WalletOutputs, 0},
+                {db::WalletOutputJournal, MDB_INTEGERKEY},
+                {db::WalletOutputOwners, MDB_DUPSORT},
+                {db::WalletSubchainScanned, 0},
+            });
+        restart();
+    }
+
+    ~Test_WalletOutput() override
+    {
+        wallet_.reset();
+        lmdb_.reset();
+        fs::remove_all(path_);
+    }
+};
+
+const ot::storage::lmdb::TableNames Test_WalletOutput::names_{
+    {ot::blockchain::database::WalletOutputs, "wallet_outputs"},
+    {ot::blockchain::database::WalletOutputJournal, "wallet_output_journal"},
+    {ot::blockchain::database::WalletOutputOwners, "wallet_output_owners"},
+    {ot::blockchain::database::WalletSubchainScanned,
+     "wallet_subchain_scanned"},
+};
+
+TEST_F(Test_WalletOutput, totals)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    const auto tx = receive(nym, account);
+
+    ASSERT_TRUE(tx);
+
+    const auto amount = value(*tx);
+
+    ASSERT_TRUE(wallet_->AddMempoolTransaction(
+        account, Subchain::External, {0, 1}, *tx));
+    EXPECT_EQ(wallet_->GetBalance(), (Balance{0, amount}));
+    EXPECT_EQ(wallet_->GetBalance(nym), (Balance{0, amount}));
+    EXPECT_EQ(wallet_->GetBalance(nym, account), (Balance{0, amount}));
+
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account, Subchain::External, position(1), 0, {0, 1}, *tx));
+    EXPECT_EQ(wallet_->GetBalance(), (Balance{amount, amount}));
+    EXPECT_EQ(wallet_->GetBalance(nym), (Balance{amount, amount}));
+    EXPECT_EQ(wallet_->GetBalance(nym, account), (Balance{amount, amount}));
+    EXPECT_EQ(wallet_->GetOutputs(State::ConfirmedNew).size(), 2u);
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedNew).size(), 0u);
+}
+
+TEST_F(Test_WalletOutput, totals_scoped_to_owner)
+{
+    const auto tx1 = receive(nym_1_id(), account_1_id());
+    const auto tx2 = receive(nym_2_id(), account_2_id());
+
+    ASSERT_TRUE(tx1);
+    ASSERT_TRUE(tx2);
+
+    const auto amount1 = value(*tx1);
+    const auto amount2 = value(*tx2);
+
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account_1_id(), Subchain::External, position(1), 0, {0, 1}, *tx1));
+    ASSERT_TRUE(wallet_->AddMempoolTransaction(
+        account_2_id(), Subchain::External, {0, 1}, *tx2));
+    EXPECT_EQ(wallet_->GetBalance(), (Balance{amount1, amount1 + amount2}));
+    EXPECT_EQ(wallet_->GetBalance(nym_1_id()), (Balance{amount1, amount1}));
+    EXPECT_EQ(wallet_->GetBalance(nym_2_id()), (Balance{0, amount2}));
+    EXPECT_EQ(
+        wallet_->GetBalance(nym_1_id(), account_1_id()),
+        (Balance{amount1, amount1}));
+    EXPECT_EQ(
+        wallet_->GetBalance(nym_2_id(), account_2_id()),
+        (Balance{0, amount2}));
+    // An account is only counted for the nym which owns its outputs
+    EXPECT_EQ(wallet_->GetBalance(nym_2_id(), account_1_id()), (Balance{}));
+    EXPECT_EQ(wallet_->GetBalance(nym_1_id(), account_2_id()), (Balance{}));
+
+    // Confirming the second transaction leaves the first owner untouched
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account_2_id(), Subchain::External, position(2), 0, {0, 1}, *tx2));
+    EXPECT_EQ(wallet_->GetBalance(nym_1_id()), (Balance{amount1, amount1}));
+    EXPECT_EQ(wallet_->GetBalance(nym_2_id()), (Balance{amount2, amount2}));
+    EXPECT_EQ(
+        wallet_->GetBalance(),
+        (Balance{amount1 + amount2, amount1 + amount2}));
+}
+
+TEST_F(Test_WalletOutput, totals_follow_reservations)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    const auto tx = receive(nym, account);
+
+    ASSERT_TRUE(tx);
+
+    const auto amount = value(*tx);
+
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account, Subchain::External, position(1), 0, {0, 1}, *tx));
+
+    auto proposal = api_.Factory().Identifier();
+    proposal->Randomize(32);
+    auto selection = Selection{};
+    selection.target_ = 1;
+    const auto reserved =
+        wallet_->ReserveUTXOs(nym, proposal, Spend::ConfirmedOnly, selection);
+
+    ASSERT_EQ(reserved.size(), 1u);
+
+    const auto spent = reserved.front().second.value();
+
+    // Reserved outputs count as confirmed until the spend confirms
+    EXPECT_EQ(wallet_->GetBalance(), (Balance{amount, amount - spent}));
+    EXPECT_EQ(wallet_->GetBalance(nym), (Balance{amount, amount - spent}));
+    EXPECT_EQ(
+        wallet_->GetBalance(nym, account), (Balance{amount, amount - spent}));
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedSpend).size(), 1u);
+
+    ASSERT_TRUE(wallet_->CancelProposal(proposal));
+    EXPECT_EQ(wallet_->GetBalance(), (Balance{amount, amount}));
+    EXPECT_EQ(wallet_->GetBalance(nym, account), (Balance{amount, amount}));
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedSpend).size(), 0u);
+}
+
+TEST_F(Test_WalletOutput, outputs_loaded_from_database)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    const auto tx = receive(nym, account);
+
+    ASSERT_TRUE(tx);
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account, Subchain::External, position(1), 0, {0, 1}, *tx));
+
+    const auto verify = [&] {
+        const auto all = wallet_->GetOutputs(State::ConfirmedNew);
+        const auto owned = wallet_->GetOutputs(nym, account, State::All);
+
+        EXPECT_EQ(all.size(), 2u);
+        EXPECT_EQ(owned.size(), 2u);
+
+        check(all, *tx);
+        check(owned, *tx);
+    };
+
+    verify();
+    restart();
+    verify();
+    EXPECT_EQ(wallet_->GetBalance(nym), (Balance{value(*tx), value(*tx)}));
+}
+
+TEST_F(Test_WalletOutput, state_changes)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    auto txs = std::vector<std::unique_ptr<const Transaction>>{};
+
+    for (auto i = 0; i < 3; ++i) {
+        auto& tx = txs.emplace_back(receive(nym, account));
+
+        ASSERT_TRUE(tx);
+        ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+            account, Subchain::External, position(i + 1), 0, {0, 1}, *tx));
+    }
+
+    auto proposal = api_.Factory().Identifier();
+    proposal->Randomize(32);
+    const auto reserved =
+        wallet_->ReserveUTXO(nym, proposal, Spend::ConfirmedOnly);
+
+    ASSERT_TRUE(reserved.has_value());
+
+    const auto spent = wallet_->GetOutputs(State::UnconfirmedSpend);
+    const auto available = wallet_->GetOutputs(State::ConfirmedNew);
+
+    ASSERT_EQ(spent.size(), 1u);
+    EXPECT_EQ(available.size(), 5u);
+    EXPECT_EQ(spent.front().first, reserved->first);
+    EXPECT_EQ(spent.front().second.value(), reserved->second.value());
+
+    // The largest output is reserved first
+    for (const auto& [outpoint, data] : available) {
+        EXPECT_NE(outpoint, reserved->first);
+        EXPECT_LE(data.value(), reserved->second.value());
+    }
+
+    EXPECT_EQ(wallet_->GetOutputs(State::All).size(), 6u);
+    ASSERT_TRUE(wallet_->CancelProposal(proposal));
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedSpend).size(), 0u);
+    EXPECT_EQ(wallet_->GetOutputs(nym, State::ConfirmedNew).size(), 6u);
+}
+
+TEST_F(Test_WalletOutput, journal_replay)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    const auto tx = receive(nym, account);
+
+    ASSERT_TRUE(tx);
+
+    const auto amount = value(*tx);
+
+    ASSERT_TRUE(wallet_->AddMempoolTransaction(
+        account, Subchain::External, {0, 1}, *tx));
+
+    restart();
+
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedNew).size(), 2u);
+    EXPECT_EQ(wallet_->GetBalance(nym, account), (Balance{0, amount}));
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account, Subchain::External, position(1), 0, {0, 1}, *tx));
+
+    restart();
+
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedNew).size(), 0u);
+    EXPECT_EQ(wallet_->GetOutputs(State::ConfirmedNew).size(), 2u);
+    EXPECT_EQ(wallet_->GetBalance(), (Balance{amount, amount}));
+    EXPECT_EQ(wallet_->GetBalance(nym, account), (Balance{amount, amount}));
+}
+
+TEST_F(Test_WalletOutput, reservations_not_persisted)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    const auto confirmed = receive(nym, account);
+    const auto unconfirmed = receive(nym, account);
+
+    ASSERT_TRUE(confirmed);
+    ASSERT_TRUE(unconfirmed);
+
+    const auto amount1 = value(*confirmed);
+    const auto amount2 = value(*unconfirmed);
+
+    ASSERT_TRUE(wallet_->AddConfirmedTransaction(
+        account, Subchain::External, position(1), 0, {0, 1}, *confirmed));
+
+    auto proposal = api_.Factory().Identifier();
+    proposal->Randomize(32);
+
+    ASSERT_TRUE(
+        wallet_->ReserveUTXO(nym, proposal, Spend::ConfirmedOnly).has_value());
+
+    // Journal entries written while the reservation is held
+    ASSERT_TRUE(wallet_->AddMempoolTransaction(
+        account, Subchain::External, {0, 1}, *unconfirmed));
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedSpend).size(), 1u);
+
+    // The proposal is gone after a restart so the output must be spendable
+    restart();
+
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedSpend).size(), 0u);
+    EXPECT_EQ(wallet_->GetOutputs(State::ConfirmedNew).size(), 2u);
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedNew).size(), 2u);
+    EXPECT_EQ(
+        wallet_->GetBalance(nym, account),
+        (Balance{amount1, amount1 + amount2}));
+}
+
+TEST_F(Test_WalletOutput, cancel_restores_previous_state)
+{
+    const auto& nym = nym_1_id();
+    const auto& account = account_1_id();
+    const auto tx = receive(nym, account);
+
+    ASSERT_TRUE(tx);
+    ASSERT_TRUE(wallet_->AddMempoolTransaction(
+        account, Subchain::External, {0, 1}, *tx));
+
+    auto proposal = api_.Factory().Identifier();
+    proposal->Randomize(32);
+
+    ASSERT_TRUE(wallet_->ReserveUTXO(nym, proposal, Spend::UnconfirmedToo)
+                    .has_value());
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedNew).size(), 1u);
+    ASSERT_TRUE(wallet_->CancelProposal(proposal));
+    EXPECT_EQ(wallet_->GetOutputs(State::UnconfirmedNew).size(), 2u);
+    EXPECT_EQ(wallet_->GetOutputs(State::ConfirmedNew).size(), 0u);
+    EXPECT_EQ(wallet_->GetBalance(nym, account), (Balance{0, value(*tx)}));
+}
+}  // namespace ottest
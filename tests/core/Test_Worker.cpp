@@ -0,0 +1,208 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "core/Worker.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "util/Work.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class RateLimited final : public ot::Worker<RateLimited>
+{
+public:
+    using Times = std::vector<ot::Time>;
+
+    enum class Work : ot::OTZMQWorkType {
+        ping = ot::OT_ZMQ_INTERNAL_SIGNAL + 0,
+        statemachine = ot::OT_ZMQ_STATE_MACHINE_SIGNAL,
+    };
+
+    // Number of state machine runs which request another run
+    std::atomic<int> repeat_;
+    std::atomic<int> pings_;
+
+    auto Ping() const noexcept -> void
+    {
+        pipeline_->Push(MakeWork(Work::ping));
+    }
+    auto Runs() const noexcept -> Times
+    {
+        auto lock = ot::Lock{lock_};
+
+        return runs_;
+    }
+    auto Trigger() const noexcept -> void { trigger(); }
+
+    RateLimited(
+        const ot::api::client::Manager& api,
+        const std::chrono::milliseconds rateLimit) noexcept
+        : Worker(api, rateLimit)
+        , repeat_(0)
+        , pings_(0)
+        , lock_()
+        , runs_()
+    {
+        init_executor();
+    }
+
+    ~RateLimited() { stop_worker().get(); }
+
+private:
+    friend ot::Worker<RateLimited>;
+
+    mutable std::mutex lock_;
+    Times runs_;
+
+    auto pipeline(const ot::network::zeromq::Message& in) noexcept -> void
+    {
+        if (false == running_.get()) { return; }
+
+        const auto body = in.Body();
+
+        if (0 == body.size()) { return; }
+
+        switch (body.at(0).as<Work>()) {
+            case Work::ping: {
+                ++pings_;
+            } break;
+            case Work::statemachine: {
+                do_work();
+            } break;
+            default: {
+            }
+        }
+    }
+    auto shutdown(std::promise<void>& promise) noexcept -> void
+    {
+        running_->Off();
+
+        try {
+            promise.set_value();
+        } catch (...) {
+        }
+    }
+    auto state_machine() noexcept -> bool
+    {
+        {
+            auto lock = ot::Lock{lock_};
+            runs_.emplace_back(ot::Clock::now());
+        }
+
+        return 0 <= --repeat_;
+    }
+};
+
+class Test_Worker : public ::testing::Test
+{
+public:
+    static constexpr auto rate_limit_ = std::chrono::milliseconds{200};
+    // NOTE timers fire at or after their deadline, so only an early run is
+    // an error while the upper bound is generous
+    static constexpr auto early_ = std::chrono::milliseconds{5};
+
+    const ot::api::client::Manager& api_;
+
+    auto wait(const RateLimited& worker, const std::size_t runs) const noexcept
+        -> RateLimited::Times
+    {
+        const auto limit = ot::Clock::now() + std::chrono::seconds{10};
+
+        while (ot::Clock::now() < limit) {
+            auto output = worker.Runs();
+
+            if (runs <= output.size()) { return output; }
+
+            ot::Sleep(std::chrono::milliseconds(5));
+        }
+
+        return worker.Runs();
+    }
+
+    Test_Worker()
+        : api_(ot::Context().StartClient(0))
+    {
+    }
+};
+
+TEST_F(Test_Worker, deferred_run)
+{
+    const auto start = ot::Clock::now();
+    auto worker = std::make_unique<RateLimited>(api_, rate_limit_);
+    worker->Trigger();
+    const auto runs = wait(*worker, 1);
+
+    // The timer fired once the rate limit had elapsed
+    ASSERT_EQ(runs.size(), 1u);
+    EXPECT_GE(runs.at(0) - start, rate_limit_ - early_);
+}
+
+TEST_F(Test_Worker, pipeline_not_blocked)
+{
+    auto worker = std::make_unique<RateLimited>(api_, rate_limit_);
+    worker->Trigger();
+    worker->Ping();
+    const auto limit = ot::Clock::now() + rate_limit_ / 2;
+
+    while ((0 == worker->pings_) && (ot::Clock::now() < limit)) {
+        ot::Sleep(std::chrono::milliseconds(1));
+    }
+
+    // Other work is processed while the state machine waits for the timer
+    EXPECT_EQ(worker->pings_.load(), 1);
+    EXPECT_TRUE(worker->Runs().empty());
+    EXPECT_EQ(wait(*worker, 1).size(), 1u);
+}
+
+TEST_F(Test_Worker, rescheduled)
+{
+    constexpr auto repeats = 3;
+    auto worker = std::make_unique<RateLimited>(api_, rate_limit_);
+    worker->repeat_ = repeats;
+    worker->Trigger();
+    const auto runs = wait(*worker, repeats + 1);
+
+    // Every repeated run was deferred by the timer again
+    ASSERT_EQ(runs.size(), repeats + 1u);
+
+    for (auto i = std::size_t{1}; i < runs.size(); ++i) {
+        EXPECT_GE(runs.at(i) - runs.at(i - 1), rate_limit_ - early_);
+    }
+
+    ot::Sleep(2 * rate_limit_);
+
+    EXPECT_EQ(worker->Runs().size(), repeats + 1u);
+}
+
+TEST_F(Test_Worker, coalesced_triggers)
+{
+    auto worker = std::make_unique<RateLimited>(api_, rate_limit_);
+
+    for (auto i = 0; i < 10; ++i) { worker->Trigger(); }
+
+    EXPECT_EQ(wait(*worker, 1).size(), 1u);
+
+    ot::Sleep(2 * rate_limit_);
+
+    // Triggers issued while the timer was pending cost a single run
+    EXPECT_EQ(worker->Runs().size(), 1u);
+}
+}  // namespace ottest
@@ -4,10 +4,15 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/OT.hpp"
@@ -263,6 +268,59 @@ public:
 
         return !verified;
     }
+
+    // Every fourth item is signed over a different plaintext and every
+    // fourth item is presented with the wrong public key
+    [[maybe_unused]] void test_batch(
+        const crypto::EcdsaProvider& lib,
+        const crypto::key::Asymmetric& key1,
+        const crypto::key::Asymmetric& key2,
+        const crypto::HashType hash)
+    {
+        // NOTE large enough to be split over several jobs
+        constexpr auto count = std::size_t{150};
+        auto reason = client_.Factory().PasswordPrompt(__func__);
+        auto sigs = std::vector<ot::Space>(count);
+        auto items = std::vector<crypto::EcdsaProvider::Verification>{};
+        auto expected = std::vector<bool>{};
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& signer = (1u == (i % 4u)) ? key2 : key1;
+            const auto& verifier = (3u == (i % 4u)) ? key2 : signer;
+            const auto& plaintext =
+                (2u == (i % 4u)) ? plaintext_2 : plaintext_1;
+            auto& sig = sigs.at(i);
+
+            ASSERT_TRUE(lib.Sign(
+                plaintext_1->Bytes(),
+                signer.PrivateKey(reason),
+                hash,
+                writer(sig)));
+
+            items.emplace_back(
+                plaintext->Bytes(), verifier.PublicKey(), reader(sig));
+            expected.emplace_back(2u > (i % 4u));
+        }
+
+        // A malformed signature fails without affecting the other items
+        items.emplace_back(plaintext_1->Bytes(), key1.PublicKey(), ReadView{});
+        expected.emplace_back(false);
+
+        EXPECT_EQ(lib.VerifyBatch(items, hash, {}), expected);
+
+        auto threads = std::vector<std::thread>{};
+        const auto executor = [&](std::function<void()> job) {
+            threads.emplace_back(std::move(job));
+
+            return true;
+        };
+
+        EXPECT_EQ(lib.VerifyBatch(items, hash, executor), expected);
+
+        for (auto& thread : threads) { thread.join(); }
+
+        EXPECT_TRUE(lib.VerifyBatch({}, hash, executor).empty());
+    }
 };
 
 #if OT_CRYPTO_SUPPORTED_KEY_RSA
@@ -337,6 +395,11 @@ TEST_F(Test_Signatures, Ed25519_ECDH)
 
     EXPECT_TRUE(test_dh(ed25519_, ed_, ed_2_, expected));
 }
+
+TEST_F(Test_Signatures, Ed25519_batch)
+{
+    test_batch(client_.Crypto().ED25519(), ed_, ed_2_, blake256_);
+}
 #endif  // OT_CRYPTO_SUPPORTED_KEY_ED25519
 
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
@@ -383,5 +446,10 @@ TEST_F(Test_Signatures, Secp256k1_ECDH)
 
     EXPECT_TRUE(test_dh(secp256k1_, secp_, secp_2_, expected));
 }
+
+TEST_F(Test_Signatures, Secp256k1_batch)
+{
+    test_batch(client_.Crypto().SECP256K1(), secp_, secp_2_, sha256_);
+}
 #endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
 }  // namespace ottest
@@ -0,0 +1,176 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <secp256k1.h>
+}
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "crypto/library/secp256k1/PubkeyCache.hpp"
+#include "opentxs/Bytes.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_PubkeyCache : public ::testing::Test
+{
+public:
+    using Cache = ot::crypto::implementation::PubkeyCache;
+
+    static constexpr auto capacity_ = std::size_t{64};
+
+    ::secp256k1_context* context_;
+    const Cache cache_;
+
+    // Public key for a scalar unique to the index
+    auto key(const std::uint32_t index, const bool compressed = true) const
+        -> ot::Space
+    {
+        auto scalar = ot::Space(32u, std::byte{0x0});
+
+        for (auto i = std::size_t{0}; i < sizeof(index); ++i) {
+            scalar.at(scalar.size() - 1u - i) =
+                static_cast<std::byte>((index >> (8u * i)) & 0xff);
+        }
+
+        auto pubkey = ::secp256k1_pubkey{};
+        const auto created = ::secp256k1_ec_pubkey_create(
+            context_,
+            &pubkey,
+            reinterpret_cast<const unsigned char*>(scalar.data()));
+
+        EXPECT_EQ(created, 1);
+
+        auto output = ot::Space(compressed ? 33u : 65u);
+        auto size = output.size();
+        ::secp256k1_ec_pubkey_serialize(
+            context_,
+            reinterpret_cast<unsigned char*>(output.data()),
+            &size,
+            &pubkey,
+            compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+
+        return output;
+    }
+    auto parse(const ot::Space& pubkey) const -> bool
+    {
+        try {
+            cache_.Parse(context_, ot::reader(pubkey));
+
+            return true;
+        } catch (const std::runtime_error&) {
+
+            return false;
+        }
+    }
+
+    Test_PubkeyCache()
+        : context_(::secp256k1_context_create(
+              SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY))
+        , cache_(capacity_)
+    {
+    }
+
+    ~Test_PubkeyCache() override { ::secp256k1_context_destroy(context_); }
+};
+
+TEST_F(Test_PubkeyCache, capacity)
+{
+    EXPECT_EQ(cache_.Statistics().capacity_, capacity_);
+
+    // Every shard holds at least one key
+    EXPECT_EQ(Cache{1}.Statistics().capacity_, 16u);
+}
+
+TEST_F(Test_PubkeyCache, hits)
+{
+    const auto pubkey = key(1);
+
+    EXPECT_TRUE(parse(pubkey));
+
+    const auto first = cache_.Statistics();
+
+    EXPECT_EQ(first.hits_, 0u);
+    EXPECT_EQ(first.misses_, 1u);
+    EXPECT_EQ(first.keys_, 1u);
+
+    for (auto i = 0; i < 3; ++i) { EXPECT_TRUE(parse(pubkey)); }
+
+    const auto after = cache_.Statistics();
+
+    EXPECT_EQ(after.hits_, 3u);
+    EXPECT_EQ(after.misses_, 1u);
+    EXPECT_EQ(after.keys_, 1u);
+}
+
+TEST_F(Test_PubkeyCache, invalid_keys)
+{
+    // NOTE the x coordinate is larger than the field size
+    auto invalid = ot::Space(33u, std::byte{0xff});
+    invalid.at(0) = std::byte{0x02};
+
+    EXPECT_FALSE(parse(invalid));
+    EXPECT_FALSE(parse(invalid));
+
+    const auto stats = cache_.Statistics();
+
+    // Rejected keys are parsed every time and never stored
+    EXPECT_EQ(stats.hits_, 0u);
+    EXPECT_EQ(stats.misses_, 2u);
+    EXPECT_EQ(stats.keys_, 0u);
+}
+
+TEST_F(Test_PubkeyCache, uncompressed_bypass)
+{
+    const auto uncompressed = key(1, false);
+
+    EXPECT_TRUE(parse(uncompressed));
+    EXPECT_TRUE(parse(uncompressed));
+
+    const auto stats = cache_.Statistics();
+
+    EXPECT_EQ(stats.hits_, 0u);
+    EXPECT_EQ(stats.misses_, 0u);
+    EXPECT_EQ(stats.keys_, 0u);
+}
+
+TEST_F(Test_PubkeyCache, lru_eviction)
+{
+    // NOTE enough keys that every shard overflows many times over
+    constexpr auto count = static_cast<std::uint32_t>(16u * capacity_);
+    const auto oldest = key(1);
+    const auto recent = key(2);
+
+    ASSERT_TRUE(parse(oldest));
+    ASSERT_TRUE(parse(recent));
+
+    for (auto i = std::uint32_t{3}; i < count + 3u; ++i) {
+        ASSERT_TRUE(parse(key(i)));
+        // Keeps this key at the front of its shard
+        ASSERT_TRUE(parse(recent));
+    }
+
+    const auto after = cache_.Statistics();
+
+    EXPECT_EQ(after.hits_, count);
+    EXPECT_EQ(after.misses_, count + 2u);
+    EXPECT_EQ(after.keys_, capacity_);
+    EXPECT_EQ(after.evictions_, after.misses_ - after.keys_);
+
+    ASSERT_TRUE(parse(recent));
+    ASSERT_TRUE(parse(oldest));
+
+    const auto last = cache_.Statistics();
+
+    // The recently used key is still cached while the oldest was evicted
+    EXPECT_EQ(last.hits_ - after.hits_, 1u);
+    EXPECT_EQ(last.misses_ - after.misses_, 1u);
+}
+}  // namespace ottest
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <iterator>
 #include <string>
+#include <utility>
 
 #include "opentxs/OT.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -64,6 +65,47 @@ TEST(Message, AddFrame_string)
     ASSERT_STREQ("testString", messageString.c_str());
 }
 
+TEST(Message, AddFrame_string_move)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    const auto expected = std::string(1024, 'x');
+    auto input = expected;
+    const auto* buffer = input.data();
+
+    auto& message = multipartMessage->AddFrame(std::move(input));
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_EQ(message.size(), expected.size());
+    EXPECT_EQ(message.data(), buffer);
+    EXPECT_EQ(message.Bytes(), expected);
+}
+
+TEST(Message, AddFrame_Space_move)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    const auto expected = std::string(1024, 'y');
+    auto input = space(expected);
+    const auto* buffer = input.data();
+
+    auto& message = multipartMessage->AddFrame(std::move(input));
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_EQ(message.size(), expected.size());
+    EXPECT_EQ(message.data(), buffer);
+    EXPECT_EQ(message.Bytes(), expected);
+}
+
+TEST(Message, copy_shares_frames)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    multipartMessage->AddFrame(std::string(1024, 'z'));
+    multipartMessage->AddFrame(std::string{"short"});
+
+    const auto copy = OTZMQMessage{multipartMessage};
+    ASSERT_EQ(copy->size(), 2);
+    EXPECT_EQ(copy->at(0).data(), multipartMessage->at(0).data());
+    EXPECT_EQ(copy->at(0).Bytes(), multipartMessage->at(0).Bytes());
+    EXPECT_EQ(copy->at(1).Bytes(), multipartMessage->at(1).Bytes());
+}
+
 TEST(Message, at)
 {
     auto multipartMessage = network::zeromq::Message::Factory();
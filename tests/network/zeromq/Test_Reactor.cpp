@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/network/zeromq/socket/Pull.hpp"
+#include "opentxs/network/zeromq/socket/Push.hpp"
+#include "opentxs/network/zeromq/socket/Sender.tpp"
+#include "opentxs/network/zeromq/socket/Socket.hpp"
+
+namespace ot = opentxs;
+namespace zmq = ot::network::zeromq;
+
+namespace ottest
+{
+class Test_Reactor : public ::testing::Test
+{
+public:
+    using Direction = zmq::socket::Socket::Direction;
+
+    static constexpr auto timeout_ = std::chrono::seconds{30};
+
+    const zmq::Context& context_;
+    // NOTE more listening sockets than the worker pool will start threads
+    // for, max(16, 4 x hardware threads)
+    const std::size_t count_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::size_t started_;
+    std::atomic<std::size_t> released_;
+    std::atomic<std::size_t> abandoned_;
+
+    // Blocks until every callback has started
+    auto wait_for_all() noexcept -> void
+    {
+        auto lock = ot::Lock{lock_};
+        ++started_;
+        cv_.notify_all();
+        const auto all =
+            cv_.wait_for(lock, timeout_, [&] { return started_ >= count_; });
+
+        if (all) {
+            ++released_;
+        } else {
+            ++abandoned_;
+        }
+    }
+
+    Test_Reactor()
+        : context_(ot::Context().ZMQ())
+        , count_(
+              std::max(16u, 4u * std::thread::hardware_concurrency()) + 4u)
+        , lock_()
+        , cv_()
+        , started_(0)
+        , released_(0)
+        , abandoned_(0)
+    {
+    }
+};
+
+TEST_F(Test_Reactor, blocking_callbacks)
+{
+    auto callback = zmq::ListenCallback::Factory(
+        [&](zmq::Message&) -> void { wait_for_all(); });
+    auto pull = std::vector<ot::OTZMQPullSocket>{};
+    auto push = std::vector<ot::OTZMQPushSocket>{};
+    pull.reserve(count_);
+    push.reserve(count_);
+
+    for (auto i = std::size_t{0}; i < count_; ++i) {
+        const auto endpoint =
+            std::string{"inproc://opentxs/test/reactor/"} + std::to_string(i);
+        const auto& listener =
+            pull.emplace_back(context_.PullSocket(callback, Direction::Bind));
+
+        ASSERT_TRUE(listener->Start(endpoint));
+
+        const auto& sender =
+            push.emplace_back(context_.PushSocket(Direction::Connect));
+
+        ASSERT_TRUE(sender->Start(endpoint));
+    }
+
+    for (const auto& sender : push) { ASSERT_TRUE(sender->Send("wait")); }
+
+    const auto limit = ot::Clock::now() + 2 * timeout_;
+
+    while (((released_ + abandoned_) < count_) && (ot::Clock::now() < limit)) {
+        ot::Sleep(std::chrono::milliseconds(10));
+    }
+
+    // Every callback was running at the same time
+    EXPECT_EQ(released_.load(), count_);
+    EXPECT_EQ(abandoned_.load(), 0u);
+}
+}  // namespace ottest
@@ -135,5 +135,53 @@ TEST_F(Test_PaymentCode_v1, unblind)
     EXPECT_EQ(pPC->asBase58(), expected);
 }
 
+TEST_F(Test_PaymentCode_v1, batch_outgoing)
+{
+    for (const auto first : {ot::Bip32Index{0}, ot::Bip32Index{5}}) {
+        const auto keys = alice_pc_secret_.Outgoing(
+            bob_pc_public_, first, 10u, chain_, reason_, version_);
+
+        ASSERT_EQ(keys.size(), 10u);
+
+        for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+            const auto pKey = alice_pc_secret_.Outgoing(
+                bob_pc_public_, first + i, chain_, reason_, version_);
+
+            ASSERT_TRUE(pKey);
+            ASSERT_TRUE(keys.at(i));
+            EXPECT_EQ(keys.at(i)->PublicKey(), pKey->PublicKey());
+        }
+    }
+
+    const auto none = alice_pc_secret_.Outgoing(
+        bob_pc_public_, 0u, 0u, chain_, reason_, version_);
+
+    EXPECT_TRUE(none.empty());
+}
+
+TEST_F(Test_PaymentCode_v1, batch_incoming)
+{
+    for (const auto first : {ot::Bip32Index{0}, ot::Bip32Index{5}}) {
+        const auto keys = bob_pc_secret_.Incoming(
+            alice_pc_public_, first, 10u, chain_, reason_, version_);
+
+        ASSERT_EQ(keys.size(), 10u);
+
+        for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+            const auto pKey = bob_pc_secret_.Incoming(
+                alice_pc_public_, first + i, chain_, reason_, version_);
+
+            ASSERT_TRUE(pKey);
+            ASSERT_TRUE(keys.at(i));
+            EXPECT_EQ(keys.at(i)->PublicKey(), pKey->PublicKey());
+        }
+    }
+
+    const auto none = bob_pc_secret_.Incoming(
+        alice_pc_public_, 0u, 0u, chain_, reason_, version_);
+
+    EXPECT_TRUE(none.empty());
+}
+
 TEST_F(Test_PaymentCode_v1, shutdown) { Shutdown(); }
 }  // namespace ottest
@@ -32,6 +32,7 @@ class Test_PaymentCode_v3 : public PC_Fixture_Base
 {
 public:
     static constexpr auto version_ = std::uint8_t{3};
+    static constexpr auto chain_ = ot::blockchain::Type::Bitcoin;
 
     const ot::crypto::key::EllipticCurve& alice_blind_secret_;
     const ot::crypto::key::EllipticCurve& alice_blind_public_;
@@ -435,5 +436,53 @@ TEST_F(Test_PaymentCode_v3, blind_bob)
     }
 }
 
+TEST_F(Test_PaymentCode_v3, batch_outgoing)
+{
+    for (const auto first : {ot::Bip32Index{0}, ot::Bip32Index{5}}) {
+        const auto keys = alice_pc_secret_.Outgoing(
+            bob_pc_public_, first, 10u, chain_, reason_, version_);
+
+        ASSERT_EQ(keys.size(), 10u);
+
+        for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+            const auto pKey = alice_pc_secret_.Outgoing(
+                bob_pc_public_, first + i, chain_, reason_, version_);
+
+            ASSERT_TRUE(pKey);
+            ASSERT_TRUE(keys.at(i));
+            EXPECT_EQ(keys.at(i)->PublicKey(), pKey->PublicKey());
+        }
+    }
+
+    const auto none = alice_pc_secret_.Outgoing(
+        bob_pc_public_, 0u, 0u, chain_, reason_, version_);
+
+    EXPECT_TRUE(none.empty());
+}
+
+TEST_F(Test_PaymentCode_v3, batch_incoming)
+{
+    for (const auto first : {ot::Bip32Index{0}, ot::Bip32Index{5}}) {
+        const auto keys = bob_pc_secret_.Incoming(
+            alice_pc_public_, first, 10u, chain_, reason_, version_);
+
+        ASSERT_EQ(keys.size(), 10u);
+
+        for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+            const auto pKey = bob_pc_secret_.Incoming(
+                alice_pc_public_, first + i, chain_, reason_, version_);
+
+            ASSERT_TRUE(pKey);
+            ASSERT_TRUE(keys.at(i));
+            EXPECT_EQ(keys.at(i)->PublicKey(), pKey->PublicKey());
+        }
+    }
+
+    const auto none = bob_pc_secret_.Incoming(
+        alice_pc_public_, 0u, 0u, chain_, reason_, version_);
+
+    EXPECT_TRUE(none.empty());
+}
+
 TEST_F(Test_PaymentCode_v3, shutdown) { Shutdown(); }
 }  // namespace ottest
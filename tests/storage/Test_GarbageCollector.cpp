@@ -0,0 +1,144 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "2_Factory.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/storage/Driver.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "opentxs/protobuf/StorageThread.pb.h"
+#include "opentxs/protobuf/verify/StorageThread.hpp"
+#include "storage/GarbageCollector.hpp"
+#include "storage/ObjectCache.hpp"
+#include "storage/Plugin.hpp"
+#include "storage/StorageConfig.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_GarbageCollector : public ::testing::Test
+{
+public:
+    using Object = ot::proto::StorageThread;
+
+    const ot::api::client::Manager& api_;
+    const ot::StorageConfig config_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    ot::OTFlag bucket_;
+    std::unique_ptr<ot::api::storage::Plugin> driver_;
+    ot::storage::GarbageCollector gc_;
+
+    static auto cached(
+        const ot::api::storage::Driver& owner,
+        const std::string& hash) -> bool
+    {
+        return bool(ot::storage::ObjectCache::Get().Find<Object>(&owner, hash));
+    }
+
+    auto store(const std::string& id) const -> std::string
+    {
+        auto object = Object{};
+        object.set_version(1);
+        object.set_id(id);
+        object.add_participant("participantparticipant");
+        auto hash = std::string{};
+
+        EXPECT_TRUE(driver_->StoreProto(object, hash));
+
+        return hash;
+    }
+
+    Test_GarbageCollector()
+        : api_(dynamic_cast<const ot::api::client::Manager&>(
+              ot::Context().StartClient(0)))
+        , config_()
+        , digest_([this](
+                      const std::uint32_t type,
+                      const ot::ReadView data,
+                      const ot::AllocateOutput output) -> bool {
+            return api_.Crypto().Hash().Digest(type, data, output);
+        })
+        , random_([] { return std::string{}; })
+        , bucket_(ot::Flag::Factory(false))
+        , driver_(ot::Factory::StorageMemDB(
+              api_.Storage(),
+              config_,
+              digest_,
+              random_,
+              bucket_))
+        , gc_(*driver_)
+    {
+    }
+};
+
+TEST_F(Test_GarbageCollector, uncached_loads)
+{
+    const auto hash = store("threadthreadthreadthread");
+    auto loaded = std::shared_ptr<Object>{};
+
+    gc_.Start();
+
+    // Objects loaded during garbage collection are not cached under either
+    // driver
+    ASSERT_TRUE(gc_.LoadProto(hash, loaded));
+    EXPECT_EQ(loaded->id(), "threadthreadthreadthread");
+    EXPECT_FALSE(cached(gc_, hash));
+    EXPECT_FALSE(cached(*driver_, hash));
+    EXPECT_TRUE(gc_.Finish(true));
+
+    // Foreground loads still are
+    ASSERT_TRUE(driver_->LoadProto(hash, loaded));
+    EXPECT_TRUE(cached(*driver_, hash));
+}
+
+TEST_F(Test_GarbageCollector, shared_objects)
+{
+    const auto a = store("threadthreadthreadthread1");
+    const auto b = store("threadthreadthreadthread2");
+    const auto c = store("threadthreadthreadthread3");
+    auto value = std::string{};
+
+    // Start a cycle which moves every object into the other bucket
+    bucket_->On();
+    gc_.Start();
+
+    for (const auto& hash : {a, b, a, c, b}) {
+        EXPECT_TRUE(gc_.Migrate(hash, *driver_));
+    }
+
+    const auto status = gc_.Status();
+
+    // Keys seen earlier in the cycle are not copied again
+    EXPECT_EQ(status.visited_, 3u);
+    EXPECT_EQ(status.skipped_, 2u);
+    EXPECT_EQ(status.failed_, 0u);
+    EXPECT_TRUE(gc_.Finish(true));
+
+    for (const auto& hash : {a, b, c}) {
+        EXPECT_TRUE(driver_->LoadFromBucket(hash, value, true));
+    }
+
+    // Every cycle starts with an empty history
+    gc_.Start();
+
+    EXPECT_TRUE(gc_.Migrate(a, *driver_));
+    EXPECT_EQ(gc_.Status().visited_, 1u);
+    EXPECT_TRUE(gc_.Finish(true));
+}
+}  // namespace ottest
@@ -0,0 +1,348 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "2_Factory.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "storage/StorageConfig.hpp"
+
+namespace ot = opentxs;
+namespace fs = boost::filesystem;
+
+namespace
+{
+class Test_StorageFSPacked : public ::testing::Test
+{
+public:
+    using Driver = std::unique_ptr<ot::api::storage::Plugin>;
+
+    const ot::api::client::Manager& api_;
+    const fs::path path_;
+    ot::StorageConfig config_;
+    // Values returned by random_ before it falls back to a counter
+    std::deque<std::string> names_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    const ot::OTFlag bucket_;
+
+    auto make() const -> Driver
+    {
+        return Driver{ot::Factory::StorageFSPacked(
+            api_.Storage(), config_, digest_, random_, bucket_)};
+    }
+
+    auto segment(const std::uint32_t id) const -> fs::path
+    {
+        auto name = std::to_string(id);
+        name.insert(0, 8 - name.size(), '0');
+
+        return path_ / "packed" / "a" / (name + ".segment");
+    }
+
+    auto purged() const -> std::size_t
+    {
+        auto output = std::size_t{0};
+
+        for (const auto& entry : fs::directory_iterator(path_ / "packed")) {
+            const auto name = entry.path().filename().string();
+
+            if (0 == name.compare(0, 6, "purge-")) { ++output; }
+        }
+
+        return output;
+    }
+
+    Test_StorageFSPacked()
+        : api_(dynamic_cast<const ot::api::client::Manager&>(
+              ot::Context().StartClient(0)))
+        , path_(fs::temp_directory_path() / fs::unique_path())
+        , config_()
+        , names_()
+        , digest_()
+        , random_([this] {
+            static auto counter = int{0};
+
+            if (false == names_.empty()) {
+                auto output = names_.front();
+                names_.pop_front();
+
+                return output;
+            }
+
+            return std::to_string(++counter);
+        })
+        , bucket_(ot::Flag::Factory(false))
+    {
+        fs::create_directories(path_);
+        config_.path_ = path_.string();
+    }
+
+    ~Test_StorageFSPacked() override { fs::remove_all(path_); }
+};
+
+TEST_F(Test_StorageFSPacked, round_trip)
+{
+    {
+        auto driver = make();
+
+        ASSERT_TRUE(driver);
+        EXPECT_TRUE(driver->Store(false, "key 1", "value 1", false));
+        EXPECT_TRUE(driver->Store(false, "key 2", "value 2", true));
+        EXPECT_TRUE(driver->StoreRoot(true, "root hash"));
+
+        auto value = std::string{};
+
+        EXPECT_TRUE(driver->LoadFromBucket("key 1", value, false));
+        EXPECT_EQ(value, "value 1");
+        EXPECT_TRUE(driver->LoadFromBucket("key 2", value, true));
+        EXPECT_EQ(value, "value 2");
+        EXPECT_FALSE(driver->LoadFromBucket("key 1", value, true));
+        EXPECT_FALSE(driver->LoadFromBucket("key 3", value, false));
+    }
+
+    auto driver = make();
+    auto value = std::string{};
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->LoadFromBucket("key 1", value, false));
+    EXPECT_EQ(value, "value 1");
+    EXPECT_TRUE(driver->LoadFromBucket("key 2", value, true));
+    EXPECT_EQ(value, "value 2");
+    EXPECT_EQ(driver->LoadRoot(), "root hash");
+}
+
+TEST_F(Test_StorageFSPacked, segment_rollover)
+{
+    config_.fs_segment_size_ = 64;
+    const auto count = 32;
+
+    {
+        auto driver = make();
+
+        for (auto i = 0; i < count; ++i) {
+            const auto key = std::to_string(i);
+
+            EXPECT_TRUE(driver->Store(false, key, "value " + key, false));
+        }
+    }
+
+    auto segments = std::size_t{0};
+
+    for (const auto& entry : fs::directory_iterator(path_ / "packed" / "a")) {
+        if (".segment" == entry.path().extension().string()) { ++segments; }
+    }
+
+    EXPECT_GT(segments, 1u);
+
+    auto driver = make();
+    auto value = std::string{};
+
+    for (auto i = 0; i < count; ++i) {
+        const auto key = std::to_string(i);
+
+        EXPECT_TRUE(driver->LoadFromBucket(key, value, false));
+        EXPECT_EQ(value, "value " + key);
+    }
+}
+
+TEST_F(Test_StorageFSPacked, overwrite)
+{
+    {
+        auto driver = make();
+
+        EXPECT_TRUE(driver->Store(false, "key", "old", false));
+        EXPECT_TRUE(driver->Store(false, "key", "new", false));
+    }
+
+    auto driver = make();
+    auto value = std::string{};
+
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "new");
+}
+
+TEST_F(Test_StorageFSPacked, purge)
+{
+    {
+        auto driver = make();
+
+        EXPECT_TRUE(driver->Store(false, "key 1", "value 1", false));
+        EXPECT_TRUE(driver->Store(false, "key 2", "value 2", true));
+        EXPECT_TRUE(driver->EmptyBucket(false));
+
+        auto value = std::string{};
+
+        EXPECT_FALSE(driver->LoadFromBucket("key 1", value, false));
+        EXPECT_TRUE(driver->LoadFromBucket("key 2", value, true));
+        EXPECT_EQ(value, "value 2");
+        EXPECT_TRUE(fs::is_directory(path_ / "packed" / "a"));
+        EXPECT_TRUE(driver->Store(false, "key 3", "value 3", false));
+        EXPECT_TRUE(driver->EmptyBucket(false));
+        EXPECT_TRUE(driver->Store(false, "key 4", "value 4", false));
+    }
+
+    // The driver must not return until its deletions are finished
+    EXPECT_EQ(purged(), 0u);
+
+    auto driver = make();
+    auto value = std::string{};
+
+    EXPECT_FALSE(driver->LoadFromBucket("key 1", value, false));
+    EXPECT_FALSE(driver->LoadFromBucket("key 3", value, false));
+    EXPECT_TRUE(driver->LoadFromBucket("key 4", value, false));
+    EXPECT_EQ(value, "value 4");
+    EXPECT_TRUE(driver->LoadFromBucket("key 2", value, true));
+    EXPECT_EQ(value, "value 2");
+}
+
+TEST_F(Test_StorageFSPacked, sweep_abandoned_purge)
+{
+    const auto abandoned = path_ / "packed" / "purge-abandoned";
+    fs::create_directories(abandoned / "a");
+    fs::ofstream{abandoned / "a" / "00000000.segment"} << "garbage";
+
+    EXPECT_EQ(purged(), 1u);
+
+    {
+        auto driver = make();
+
+        EXPECT_TRUE(driver->Store(false, "key", "value", false));
+    }
+
+    EXPECT_EQ(purged(), 0u);
+    EXPECT_FALSE(fs::exists(abandoned));
+}
+
+TEST_F(Test_StorageFSPacked, failed_purge)
+{
+    auto driver = make();
+    auto value = std::string{};
+
+    EXPECT_TRUE(driver->Store(false, "key 1", "value 1", false));
+
+    // Moving the old bucket aside fails if its destination is occupied
+    const auto blocker = path_ / "packed" / "purge-blocked";
+    fs::create_directories(blocker / "occupied");
+    names_ = {"replacement", "blocked"};
+
+    EXPECT_FALSE(driver->EmptyBucket(false));
+
+    // The bucket is unchanged and still accepts writes
+    EXPECT_TRUE(driver->LoadFromBucket("key 1", value, false));
+    EXPECT_EQ(value, "value 1");
+    EXPECT_TRUE(driver->Store(false, "key 2", "value 2", false));
+    EXPECT_TRUE(driver->LoadFromBucket("key 2", value, false));
+
+    fs::remove_all(blocker);
+
+    EXPECT_TRUE(driver->EmptyBucket(false));
+    EXPECT_FALSE(driver->LoadFromBucket("key 1", value, false));
+    EXPECT_TRUE(driver->Store(false, "key 3", "value 3", false));
+    EXPECT_TRUE(driver->LoadFromBucket("key 3", value, false));
+}
+
+TEST_F(Test_StorageFSPacked, truncated_tail)
+{
+    config_.fs_segment_size_ = 64;
+    const auto count = 32;
+    auto tail = std::uint32_t{0};
+
+    {
+        auto driver = make();
+
+        for (auto i = 0; i < count; ++i) {
+            const auto key = std::to_string(i);
+
+            EXPECT_TRUE(driver->Store(false, key, "value " + key, false));
+        }
+    }
+
+    while (fs::exists(segment(tail + 1))) { ++tail; }
+
+    ASSERT_LT(0u, tail);
+
+    const auto size = fs::file_size(segment(tail));
+    fs::ofstream{segment(tail), std::ios::binary | std::ios::app}
+        << "interrupted write";
+
+    {
+        auto driver = make();
+        auto value = std::string{};
+
+        for (auto i = 0; i < count; ++i) {
+            const auto key = std::to_string(i);
+
+            EXPECT_TRUE(driver->LoadFromBucket(key, value, false));
+        }
+
+        EXPECT_EQ(fs::file_size(segment(tail)), size);
+        EXPECT_TRUE(driver->Store(false, "new", "value", false));
+    }
+
+    auto driver = make();
+    auto value = std::string{};
+
+    EXPECT_TRUE(driver->LoadFromBucket("new", value, false));
+    EXPECT_EQ(value, "value");
+}
+
+TEST_F(Test_StorageFSPacked, corrupt_record)
+{
+    config_.fs_segment_size_ = 64;
+    const auto count = 32;
+
+    {
+        auto driver = make();
+
+        for (auto i = 0; i < count; ++i) {
+            const auto key = std::to_string(i);
+
+            EXPECT_TRUE(driver->Store(false, key, "value " + key, false));
+        }
+    }
+
+    ASSERT_TRUE(fs::exists(segment(1)));
+
+    // Damage the value of the first record in the first segment
+    const auto size = fs::file_size(segment(0));
+
+    {
+        auto file = fs::fstream{
+            segment(0), std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(12 + 1);
+        file << 'X';
+    }
+
+    auto driver = make();
+    auto value = std::string{};
+
+    // Only the damaged record is lost and the segment is left intact
+    EXPECT_FALSE(driver->LoadFromBucket("0", value, false));
+
+    for (auto i = 1; i < count; ++i) {
+        const auto key = std::to_string(i);
+
+        EXPECT_TRUE(driver->LoadFromBucket(key, value, false));
+        EXPECT_EQ(value, "value " + key);
+    }
+
+    EXPECT_EQ(fs::file_size(segment(0)), size);
+}
+}  // namespace
\ No newline at end of file
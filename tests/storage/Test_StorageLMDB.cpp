@@ -0,0 +1,98 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <memory>
+#include <string>
+
+#include "2_Factory.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "storage/StorageConfig.hpp"
+
+namespace ot = opentxs;
+namespace fs = boost::filesystem;
+
+namespace
+{
+class Test_StorageLMDB : public ::testing::Test
+{
+public:
+    using Driver = std::unique_ptr<ot::api::storage::Plugin>;
+
+    const ot::api::client::Manager& api_;
+    const fs::path path_;
+    ot::StorageConfig config_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    const ot::OTFlag bucket_;
+
+    auto make() const -> Driver
+    {
+        return Driver{ot::Factory::StorageLMDB(
+            api_.Storage(), config_, digest_, random_, bucket_)};
+    }
+
+    Test_StorageLMDB()
+        : api_(dynamic_cast<const ot::api::client::Manager&>(
+              ot::Context().StartClient(0)))
+        , path_(fs::temp_directory_path() / fs::unique_path())
+        , config_()
+        , digest_()
+        , random_([] {
+            static auto counter = int{0};
+
+            return std::to_string(++counter);
+        })
+        , bucket_(ot::Flag::Factory(false))
+    {
+        fs::create_directories(path_);
+        config_.path_ = path_.string();
+    }
+
+    ~Test_StorageLMDB() override { fs::remove_all(path_); }
+};
+
+TEST_F(Test_StorageLMDB, pending_writes)
+{
+    config_.commit_window_ = 100;
+    auto driver = make();
+    auto value = std::string{};
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->Store(true, "key", "first", false));
+    EXPECT_TRUE(driver->Store(true, "key", "second", false));
+
+    // Objects waiting for the root commit can be read back
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "second");
+    EXPECT_FALSE(driver->LoadFromBucket("key", value, true));
+    EXPECT_TRUE(driver->StoreRoot(true, "root hash"));
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "second");
+}
+
+TEST_F(Test_StorageLMDB, pending_writes_without_window)
+{
+    config_.commit_window_ = 0;
+    auto driver = make();
+    auto value = std::string{};
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->Store(true, "key", "value", false));
+
+    // Without a commit window the pending queue is not searched
+    EXPECT_FALSE(driver->LoadFromBucket("key", value, false));
+    EXPECT_TRUE(driver->StoreRoot(true, "root hash"));
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "value");
+}
+}  // namespace
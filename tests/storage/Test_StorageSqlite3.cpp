@@ -0,0 +1,317 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <sqlite3.h>
+}
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "2_Factory.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "storage/Plugin.hpp"
+#include "storage/StorageConfig.hpp"
+
+namespace ot = opentxs;
+namespace fs = boost::filesystem;
+
+namespace
+{
+class Test_StorageSqlite3 : public ::testing::Test
+{
+public:
+    using Driver = std::unique_ptr<ot::api::storage::Plugin>;
+    using Promises = std::vector<std::promise<bool>>;
+
+    const ot::api::client::Manager& api_;
+    const fs::path path_;
+    ot::StorageConfig config_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    const ot::OTFlag bucket_;
+
+    auto make() const -> Driver
+    {
+        return Driver{ot::Factory::StorageSqlite3(
+            api_.Storage(), config_, digest_, random_, bucket_)};
+    }
+    // Makes every insert of the specified key into the primary bucket fail.
+    // An abort only fails the statement while a rollback also aborts the
+    // transaction which contains it.
+    auto reject(const std::string& key, const bool rollback) const -> void
+    {
+        const auto file = path_ / config_.sqlite3_db_file_;
+        sqlite3* db{nullptr};
+
+        ASSERT_EQ(SQLITE_OK, sqlite3_open(file.string().c_str(), &db));
+
+        const auto sql = std::string{"CREATE TRIGGER `reject_"} + key +
+                         "` BEFORE INSERT ON `" +
+                         config_.sqlite3_primary_bucket_ + "` WHEN NEW.k = '" +
+                         key + "' BEGIN SELECT RAISE(" +
+                         (rollback ? "ROLLBACK" : "ABORT") +
+                         ", 'rejected'); END;";
+
+        EXPECT_EQ(
+            SQLITE_OK,
+            sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr));
+
+        sqlite3_close(db);
+    }
+    // Queues every write on the writer thread before waiting for any
+    auto store(
+        const ot::api::storage::Plugin& driver,
+        const std::vector<std::string>& keys) const -> std::vector<bool>
+    {
+        auto promises = Promises(keys.size());
+        auto output = std::vector<bool>{};
+
+        for (auto i = std::size_t{0}; i < keys.size(); ++i) {
+            driver.Store(false, keys.at(i), "value", false, promises.at(i));
+        }
+
+        for (auto& promise : promises) {
+            output.emplace_back(promise.get_future().get());
+        }
+
+        return output;
+    }
+
+    Test_StorageSqlite3()
+        : api_(dynamic_cast<const ot::api::client::Manager&>(
+              ot::Context().StartClient(0)))
+        , path_(fs::temp_directory_path() / fs::unique_path())
+        , config_()
+        , digest_()
+        , random_([] {
+            static auto counter = int{0};
+
+            return std::to_string(++counter);
+        })
+        , bucket_(ot::Flag::Factory(false))
+    {
+        fs::create_directories(path_);
+        config_.path_ = path_.string();
+    }
+
+    ~Test_StorageSqlite3() override { fs::remove_all(path_); }
+};
+
+TEST_F(Test_StorageSqlite3, round_trip)
+{
+    {
+        auto driver = make();
+
+        ASSERT_TRUE(driver);
+        EXPECT_TRUE(driver->Store(false, "key 1", "value 1", false));
+        EXPECT_TRUE(driver->Store(true, "key 2", "value 2", true));
+        EXPECT_TRUE(driver->StoreRoot(true, "root hash"));
+    }
+
+    auto driver = make();
+    auto value = std::string{};
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->LoadFromBucket("key 1", value, false));
+    EXPECT_EQ(value, "value 1");
+    EXPECT_TRUE(driver->LoadFromBucket("key 2", value, true));
+    EXPECT_EQ(value, "value 2");
+    EXPECT_EQ(driver->LoadRoot(), "root hash");
+}
+
+TEST_F(Test_StorageSqlite3, pending_writes)
+{
+    config_.commit_window_ = 100;
+    auto driver = make();
+    auto value = std::string{};
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->Store(true, "key", "first", false));
+    EXPECT_TRUE(driver->Store(true, "key", "second", false));
+
+    // Objects waiting for the root commit can be read back
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "second");
+    EXPECT_FALSE(driver->LoadFromBucket("key", value, true));
+    EXPECT_TRUE(driver->StoreRoot(true, "root hash"));
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "second");
+}
+
+TEST_F(Test_StorageSqlite3, pending_writes_without_window)
+{
+    config_.commit_window_ = 0;
+    auto driver = make();
+    auto value = std::string{};
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->Store(true, "key", "value", false));
+
+    // Without a commit window the pending queue is not searched
+    EXPECT_FALSE(driver->LoadFromBucket("key", value, false));
+    EXPECT_TRUE(driver->StoreRoot(true, "root hash"));
+    EXPECT_TRUE(driver->LoadFromBucket("key", value, false));
+    EXPECT_EQ(value, "value");
+}
+
+TEST_F(Test_StorageSqlite3, failed_item)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    reject("bad", false);
+    const auto keys = std::vector<std::string>{"a", "b", "bad", "c", "d"};
+    const auto results = store(*driver, keys);
+    auto value = std::string{};
+
+    // Only the rejected write fails
+    ASSERT_EQ(results.size(), keys.size());
+
+    for (auto i = std::size_t{0}; i < keys.size(); ++i) {
+        const auto& key = keys.at(i);
+        const auto expected = ("bad" != key);
+
+        EXPECT_EQ(results.at(i), expected);
+        EXPECT_EQ(driver->LoadFromBucket(key, value, false), expected);
+    }
+}
+
+TEST_F(Test_StorageSqlite3, aborted_batch)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    reject("bad", true);
+    auto keys = std::vector<std::string>{};
+
+    for (auto i = 0; i < 100; ++i) { keys.emplace_back(std::to_string(i)); }
+
+    keys.emplace(keys.begin() + 50, "bad");
+    const auto results = store(*driver, keys);
+    auto value = std::string{};
+
+    // Batch boundaries depend on timing, but every result must match what
+    // was actually stored
+    ASSERT_EQ(results.size(), keys.size());
+
+    for (auto i = std::size_t{0}; i < keys.size(); ++i) {
+        const auto& key = keys.at(i);
+
+        EXPECT_EQ(results.at(i), driver->LoadFromBucket(key, value, false));
+    }
+
+    EXPECT_FALSE(results.at(50));
+    EXPECT_TRUE(results.back());
+}
+
+TEST_F(Test_StorageSqlite3, concurrent_writes)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    reject("bad", true);
+    auto running = std::atomic<bool>{true};
+    auto roots = std::atomic<int>{0};
+    auto thread = std::thread{[&] {
+        while (running) {
+            EXPECT_TRUE(driver->StoreRoot(false, std::to_string(++roots)));
+        }
+    }};
+
+    for (auto i = 0; i < 20; ++i) {
+        store(*driver, {"x" + std::to_string(i), "bad", "y"});
+    }
+
+    running = false;
+    thread.join();
+
+    // Writes outside of the writer thread are not part of a batch, so a
+    // batch which is rolled back does not take them with it
+    EXPECT_EQ(driver->LoadRoot(), std::to_string(roots.load()));
+}
+
+TEST_F(Test_StorageSqlite3, empty_bucket)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+    EXPECT_TRUE(driver->Store(false, "old", "value", false));
+    EXPECT_TRUE(driver->Store(false, "kept", "value", true));
+
+    auto running = std::atomic<bool>{true};
+    auto readers = std::vector<std::thread>{};
+
+    for (auto i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            auto value = std::string{};
+
+            while (running) {
+                driver->LoadFromBucket("kept", value, true);
+                driver->LoadFromBucket("old", value, false);
+            }
+        });
+    }
+
+    // Purging while other threads use prepared statements on the same
+    // connection succeeds every time
+    for (auto i = 0; i < 20; ++i) {
+        EXPECT_TRUE(driver->EmptyBucket(false));
+        EXPECT_TRUE(driver->Store(false, "new", "value", false));
+    }
+
+    running = false;
+
+    for (auto& reader : readers) { reader.join(); }
+
+    auto value = std::string{};
+
+    EXPECT_FALSE(driver->LoadFromBucket("old", value, false));
+    EXPECT_TRUE(driver->LoadFromBucket("new", value, false));
+    EXPECT_TRUE(driver->LoadFromBucket("kept", value, true));
+}
+
+TEST_F(Test_StorageSqlite3, write_queue)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    const auto* plugin = dynamic_cast<const ot::Plugin*>(driver.get());
+
+    ASSERT_NE(plugin, nullptr);
+
+    auto keys = std::vector<std::string>{};
+
+    for (auto i = 0; i < 1000; ++i) { keys.emplace_back(std::to_string(i)); }
+
+    for (const auto result : store(*driver, keys)) { EXPECT_TRUE(result); }
+
+    const auto stats = plugin->WriteQueue();
+
+    EXPECT_EQ(stats.pending_, 0u);
+    EXPECT_EQ(stats.written_, keys.size());
+    EXPECT_GE(stats.batches_, 1u);
+    EXPECT_LE(stats.batches_, keys.size());
+    EXPECT_LE(stats.average_latency_, stats.max_latency_);
+}
+}  // namespace
@@ -0,0 +1,325 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "2_Factory.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/storage/Driver.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "opentxs/protobuf/StorageThread.pb.h"
+#include "opentxs/protobuf/StorageThreadItem.pb.h"
+#include "opentxs/protobuf/verify/StorageThread.hpp"
+#include "storage/StorageConfig.hpp"
+#include "storage/tree/Mailbox.hpp"
+#include "storage/tree/Thread.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_StorageThread : public ::testing::Test
+{
+public:
+    using Thread = ot::storage::Thread;
+    using Page = Thread::Page;
+
+    static const std::string thread_id_;
+    static const std::set<std::string> participants_;
+
+    const ot::api::client::Manager& api_;
+    const ot::StorageConfig config_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    const ot::OTFlag bucket_;
+    std::unique_ptr<ot::api::storage::Plugin> driver_;
+    std::unique_ptr<ot::storage::Mailbox> inbox_;
+    std::unique_ptr<ot::storage::Mailbox> outbox_;
+
+    static auto item_id(const std::size_t i) -> std::string
+    {
+        auto output = std::stringstream{};
+        output << "item" << std::setw(20) << std::setfill('0') << i;
+
+        return output.str();
+    }
+
+    // Number of leaves which have been read from storage or created
+    static auto leaves(const Page& page) -> std::size_t
+    {
+        if (false == page.loaded_) { return 0; }
+
+        if (0 == page.level_) { return 1; }
+
+        auto output = std::size_t{0};
+
+        for (const auto& child : page.children_) { output += leaves(*child); }
+
+        return output;
+    }
+
+    auto add(Thread& thread, const std::size_t count) const -> bool
+    {
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto added = thread.Add(
+                item_id(i),
+                static_cast<std::uint64_t>(i),
+                ot::StorageBox::INCOMINGCHEQUE,
+                "",
+                "");
+
+            if (false == added) { return false; }
+        }
+
+        return true;
+    }
+
+    auto blank() const -> std::unique_ptr<Thread>
+    {
+        return std::unique_ptr<Thread>{
+            new Thread(*driver_, thread_id_, participants_, *inbox_, *outbox_)};
+    }
+
+    auto load(const std::string& hash) const -> std::unique_ptr<Thread>
+    {
+        return std::unique_ptr<Thread>{
+            new Thread(*driver_, thread_id_, hash, "", *inbox_, *outbox_)};
+    }
+
+    static auto ids(const Thread& thread) -> const std::unique_ptr<Page>&
+    {
+        return thread.ids_;
+    }
+
+    static auto pages(const Thread& thread) -> const std::unique_ptr<Page>&
+    {
+        return thread.pages_;
+    }
+
+    auto root(const Thread& thread) const -> std::string
+    {
+        return thread.root_;
+    }
+
+    auto verify(const Thread& thread, const std::size_t count) const -> bool
+    {
+        const auto items = thread.Items();
+
+        EXPECT_EQ(items.item_size(), static_cast<int>(count));
+
+        if (items.item_size() != static_cast<int>(count)) { return false; }
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& item = items.item(static_cast<int>(i));
+
+            EXPECT_EQ(item.id(), item_id(i));
+            EXPECT_TRUE(thread.Check(item_id(i)));
+        }
+
+        return true;
+    }
+
+    Test_StorageThread()
+        : api_(dynamic_cast<const ot::api::client::Manager&>(
+              ot::Context().StartClient(0)))
+        , config_()
+        , digest_([this](
+                      const std::uint32_t type,
+                      const ot::ReadView data,
+                      const ot::AllocateOutput output) -> bool {
+            return api_.Crypto().Hash().Digest(type, data, output);
+        })
+        , random_([] { return std::string{}; })
+        , bucket_(ot::Flag::Factory(false))
+        , driver_(ot::Factory::StorageMemDB(
+              api_.Storage(),
+              config_,
+              digest_,
+              random_,
+              bucket_))
+        , inbox_(new ot::storage::Mailbox(*driver_, ""))
+        , outbox_(new ot::storage::Mailbox(*driver_, ""))
+    {
+    }
+};
+
+const std::string Test_StorageThread::thread_id_{"threadthreadthreadthread"};
+const std::set<std::string> Test_StorageThread::participants_{
+    "participantparticipant"};
+
+TEST_F(Test_StorageThread, split)
+{
+    const auto count = std::size_t{300};
+    auto thread = blank();
+
+    ASSERT_TRUE(add(*thread, count));
+    ASSERT_TRUE(pages(*thread));
+    ASSERT_TRUE(ids(*thread));
+    EXPECT_LT(0u, pages(*thread)->level_);
+    EXPECT_LT(0u, ids(*thread)->level_);
+    EXPECT_LT(1u, pages(*thread)->children_.size());
+    EXPECT_EQ(pages(*thread)->count_, count);
+    EXPECT_EQ(ids(*thread)->count_, count);
+    EXPECT_EQ(thread->UnreadCount(), count);
+    EXPECT_TRUE(verify(*thread, count));
+
+    auto reloaded = load(root(*thread));
+
+    ASSERT_TRUE(pages(*reloaded));
+    EXPECT_EQ(leaves(*pages(*reloaded)), 0u);
+    EXPECT_EQ(reloaded->UnreadCount(), count);
+    EXPECT_TRUE(reloaded->Check(item_id(150)));
+    EXPECT_EQ(leaves(*pages(*reloaded)), 0u);
+    EXPECT_EQ(leaves(*ids(*reloaded)), 1u);
+    EXPECT_TRUE(reloaded->Read(item_id(150), false));
+    EXPECT_EQ(leaves(*pages(*reloaded)), 1u);
+    EXPECT_FALSE(reloaded->Check(item_id(count)));
+    EXPECT_EQ(reloaded->UnreadCount(), count - 1u);
+    EXPECT_TRUE(verify(*reloaded, count));
+}
+
+TEST_F(Test_StorageThread, collapse)
+{
+    const auto count = std::size_t{200};
+    auto thread = blank();
+
+    ASSERT_TRUE(add(*thread, count));
+    ASSERT_TRUE(pages(*thread));
+    EXPECT_LT(0u, pages(*thread)->level_);
+
+    for (auto i = std::size_t{50}; i < count; ++i) {
+        EXPECT_TRUE(thread->Remove(item_id(i)));
+    }
+
+    ASSERT_TRUE(pages(*thread));
+    ASSERT_TRUE(ids(*thread));
+    EXPECT_EQ(pages(*thread)->level_, 0u);
+    EXPECT_EQ(ids(*thread)->level_, 0u);
+    EXPECT_EQ(pages(*thread)->count_, 50u);
+    EXPECT_FALSE(thread->Check(item_id(50)));
+    EXPECT_FALSE(thread->Remove(item_id(50)));
+    EXPECT_TRUE(verify(*thread, 50));
+
+    for (auto i = std::size_t{0}; i < 50; ++i) {
+        EXPECT_TRUE(thread->Remove(item_id(i)));
+    }
+
+    EXPECT_FALSE(pages(*thread));
+    EXPECT_FALSE(ids(*thread));
+    EXPECT_EQ(thread->UnreadCount(), 0u);
+
+    auto reloaded = load(root(*thread));
+
+    EXPECT_FALSE(pages(*reloaded));
+    EXPECT_EQ(reloaded->Items().item_size(), 0);
+}
+
+TEST_F(Test_StorageThread, replace)
+{
+    auto thread = blank();
+
+    ASSERT_TRUE(add(*thread, 150));
+    EXPECT_TRUE(thread->Add(
+        item_id(10), 1000, ot::StorageBox::INCOMINGCHEQUE, "", "", 0));
+
+    const auto items = thread->Items();
+
+    ASSERT_EQ(items.item_size(), 150);
+    EXPECT_EQ(items.item(149).id(), item_id(10));
+    EXPECT_EQ(items.item(149).index(), 150u);
+    EXPECT_EQ(ids(*thread)->count_, 150u);
+}
+
+TEST_F(Test_StorageThread, explicit_index)
+{
+    auto thread = blank();
+
+    ASSERT_TRUE(add(*thread, 2));
+    EXPECT_TRUE(thread->Add(
+        item_id(2), 2, ot::StorageBox::INCOMINGCHEQUE, "", "", 1000));
+    EXPECT_TRUE(thread->Add(
+        item_id(3), 3, ot::StorageBox::INCOMINGCHEQUE, "", "", 0));
+
+    const auto items = thread->Items();
+
+    ASSERT_EQ(items.item_size(), 4);
+    EXPECT_EQ(items.item(2).index(), 1000u);
+    EXPECT_EQ(items.item(3).index(), 1001u);
+}
+
+TEST_F(Test_StorageThread, upgrade)
+{
+    const auto count = std::size_t{300};
+    auto legacy = ot::proto::StorageThread{};
+    legacy.set_version(1);
+    legacy.set_id(thread_id_);
+
+    for (const auto& participant : participants_) {
+        legacy.add_participant(participant);
+    }
+
+    // Store the items out of order to check that the upgrade sorts them
+    for (auto i = count; i > 0; --i) {
+        auto& item = *legacy.add_item();
+        item.set_version(1);
+        item.set_id(item_id(i - 1));
+        item.set_index(i - 1);
+        item.set_time(i - 1);
+        item.set_box(static_cast<std::uint32_t>(
+            (0 == (i % 2)) ? ot::StorageBox::MAILOUTBOX
+                           : ot::StorageBox::INCOMINGCHEQUE));
+        item.set_unread(true);
+    }
+
+    auto hash = std::string{};
+
+    ASSERT_TRUE(driver_->StoreProto(legacy, hash));
+
+    auto thread = load(hash);
+
+    ASSERT_TRUE(pages(*thread));
+    ASSERT_TRUE(ids(*thread));
+    EXPECT_NE(root(*thread), hash);
+    EXPECT_LT(0u, pages(*thread)->level_);
+    EXPECT_EQ(thread->UnreadCount(), count / 2u);
+    EXPECT_TRUE(verify(*thread, count));
+
+    std::shared_ptr<ot::proto::StorageThread> upgraded;
+
+    ASSERT_TRUE(driver_->LoadProto(root(*thread), upgraded));
+    EXPECT_EQ(upgraded->version(), 2u);
+    EXPECT_EQ(upgraded->item_size(), 0);
+    EXPECT_EQ(upgraded->root().count(), count);
+    EXPECT_EQ(upgraded->ids().count(), count);
+    EXPECT_EQ(upgraded->nextindex(), count);
+
+    auto reloaded = load(root(*thread));
+
+    EXPECT_TRUE(reloaded->Check(item_id(0)));
+    EXPECT_TRUE(reloaded->Check(item_id(count - 1u)));
+    EXPECT_TRUE(reloaded->Add(
+        item_id(count), 0, ot::StorageBox::INCOMINGCHEQUE, "", "", 0));
+
+    const auto items = reloaded->Items();
+
+    ASSERT_EQ(items.item_size(), static_cast<int>(count + 1u));
+    EXPECT_EQ(items.item(static_cast<int>(count)).index(), count);
+}
+}  // namespace ottest
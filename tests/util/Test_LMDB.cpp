@@ -0,0 +1,401 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace lmdb = opentxs::storage::lmdb;
+
+namespace ottest
+{
+class Test_LMDB : public ::testing::Test
+{
+public:
+    enum Table { Plain = 0, Dups = 1, Legacy = 2 };
+
+    static const lmdb::TableNames names_;
+
+    const fs::path path_;
+    std::unique_ptr<lmdb::LMDB> db_;
+
+    auto load(const Table table, const std::string& key) const
+        -> std::optional<std::string>
+    {
+        auto output = std::optional<std::string>{};
+        db_->Load(table, key, [&](const auto value) {
+            output = std::string{value};
+        });
+
+        return output;
+    }
+
+    auto values(const Table table, const std::size_t key) const
+        -> std::vector<std::string>
+    {
+        auto output = std::vector<std::string>{};
+        db_->Load(
+            table,
+            key,
+            [&](const auto value) { output.emplace_back(value); },
+            lmdb::LMDB::Mode::Multiple);
+
+        return output;
+    }
+
+    Test_LMDB()
+        : path_(fs::temp_directory_path() / fs::unique_path())
+        , db_()
+    {
+        fs::create_directories(path_);
+        db_ = std::make_unique<lmdb::LMDB>(
+            names_,
+            path_.string(),
+            lmdb::TablesToInit{
+                {Table::Plain, 0},
+                {Table::Dups, MDB_DUPSORT | MDB_INTEGERKEY},
+                {Table::Legacy, 0}});
+    }
+
+    ~Test_LMDB() override
+    {
+        db_.reset();
+        fs::remove_all(path_);
+    }
+};
+
+const lmdb::TableNames Test_LMDB::names_{
+    {Table::Plain, "plain"},
+    {Table::Dups, "dups"},
+    {Table::Legacy, "legacy"},
+};
+
+TEST_F(Test_LMDB, batch_store_and_delete)
+{
+    ASSERT_TRUE(db_->Store(Table::Plain, "stale", "value").first);
+
+    auto batch = db_->StartBatch();
+    batch.Store(Table::Plain, "key 1", "value 1")
+        .Store(Table::Plain, "key 2", "value 2")
+        .Store(Table::Dups, 7, "a")
+        .Store(Table::Dups, 7, "b")
+        .Delete(Table::Plain, "stale")
+        .Delete(Table::Plain, "missing");
+
+    // Nothing is written before the batch is submitted
+    EXPECT_FALSE(load(Table::Plain, "key 1").has_value());
+
+    auto future = batch.Submit();
+
+    ASSERT_TRUE(future.get());
+    EXPECT_EQ(load(Table::Plain, "key 1").value_or(""), "value 1");
+    EXPECT_EQ(load(Table::Plain, "key 2").value_or(""), "value 2");
+    EXPECT_FALSE(load(Table::Plain, "stale").has_value());
+    EXPECT_EQ(values(Table::Dups, 7), (std::vector<std::string>{"a", "b"}));
+
+    auto remove = db_->StartBatch();
+    remove.Delete(Table::Dups, 7, "a");
+
+    ASSERT_TRUE(remove.Submit().get());
+    EXPECT_EQ(values(Table::Dups, 7), (std::vector<std::string>{"b"}));
+}
+
+TEST_F(Test_LMDB, batch_futures)
+{
+    auto empty = db_->StartBatch();
+
+    EXPECT_TRUE(empty.Submit().get());
+
+    auto batch = db_->StartBatch();
+    batch.Store(Table::Plain, "key", "value");
+    const auto first = batch.Submit();
+    const auto second = batch.Submit();
+
+    EXPECT_TRUE(first.get());
+    EXPECT_FALSE(second.get());
+
+    // Operations added after submission are ignored
+    batch.Store(Table::Plain, "late", "value");
+
+    EXPECT_FALSE(load(Table::Plain, "late").has_value());
+
+    auto moved = db_->StartBatch();
+    moved.Store(Table::Plain, "moved", "value");
+    auto target = std::move(moved);
+
+    EXPECT_FALSE(moved.Submit().get());
+    EXPECT_TRUE(target.Submit().get());
+    EXPECT_EQ(load(Table::Plain, "moved").value_or(""), "value");
+}
+
+TEST_F(Test_LMDB, batch_isolation)
+{
+    ASSERT_TRUE(db_->Store(Table::Plain, "existing", "original").first);
+
+    auto futures = std::vector<lmdb::LMDB::Batch::Future>{};
+
+    for (auto i = 0; i < 20; ++i) {
+        auto batch = db_->StartBatch();
+        const auto key = "good " + std::to_string(i);
+        batch.Store(Table::Plain, key, key);
+
+        if (0 == (i % 2)) {
+            // This store fails so the whole batch must be rolled back
+            batch.Store(Table::Plain, "bad " + std::to_string(i), "value")
+                .Store(Table::Plain, "existing", "replaced", MDB_NOOVERWRITE);
+        }
+
+        futures.emplace_back(batch.Submit());
+    }
+
+    for (auto i = 0; i < 20; ++i) {
+        const auto good = "good " + std::to_string(i);
+        const auto bad = "bad " + std::to_string(i);
+
+        if (0 == (i % 2)) {
+            EXPECT_FALSE(futures.at(i).get());
+            EXPECT_FALSE(load(Table::Plain, good).has_value());
+            EXPECT_FALSE(load(Table::Plain, bad).has_value());
+        } else {
+            EXPECT_TRUE(futures.at(i).get());
+            EXPECT_EQ(load(Table::Plain, good).value_or(""), good);
+        }
+    }
+
+    EXPECT_EQ(load(Table::Plain, "existing").value_or(""), "original");
+}
+
+TEST_F(Test_LMDB, batch_concurrent_submit)
+{
+    const auto threads = 8;
+    const auto count = 50;
+    auto workers = std::vector<std::thread>{};
+
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([this, t, count] {
+            for (auto i = 0; i < count; ++i) {
+                const auto key = std::to_string(t) + ":" + std::to_string(i);
+                auto batch = db_->StartBatch();
+                batch.Store(Table::Plain, key, key);
+
+                EXPECT_TRUE(batch.Submit().get());
+            }
+        });
+    }
+
+    for (auto& worker : workers) { worker.join(); }
+
+    for (auto t = 0; t < threads; ++t) {
+        for (auto i = 0; i < count; ++i) {
+            const auto key = std::to_string(t) + ":" + std::to_string(i);
+
+            EXPECT_EQ(load(Table::Plain, key).value_or(""), key);
+        }
+    }
+}
+
+TEST_F(Test_LMDB, batch_pending_at_shutdown)
+{
+    auto futures = std::vector<lmdb::LMDB::Batch::Future>{};
+
+    for (auto i = 0; i < 10; ++i) {
+        auto batch = db_->StartBatch();
+        batch.Store(Table::Plain, std::to_string(i), "value");
+        futures.emplace_back(batch.Submit());
+    }
+
+    // Queued batches are committed before the environment is closed
+    db_.reset();
+    db_ = std::make_unique<lmdb::LMDB>(
+        names_,
+        path_.string(),
+        lmdb::TablesToInit{
+            {Table::Plain, 0},
+            {Table::Dups, MDB_DUPSORT | MDB_INTEGERKEY},
+            {Table::Legacy, 0}});
+
+    for (auto i = 0; i < 10; ++i) {
+        EXPECT_TRUE(futures.at(i).get());
+        EXPECT_EQ(load(Table::Plain, std::to_string(i)).value_or(""), "value");
+    }
+}
+
+TEST_F(Test_LMDB, load_multiple_keys)
+{
+    for (const auto* key : {"a", "c", "e"}) {
+        const auto value = std::string{key} + key;
+
+        ASSERT_TRUE(db_->Store(Table::Plain, key, value).first);
+    }
+
+    // The same key may be requested more than once
+    const auto keys =
+        std::vector<opentxs::ReadView>{"e", "b", "a", "missing", "c", "a"};
+    auto found = std::vector<std::string>{};
+    const auto collect = [&](const std::size_t index, const auto value) {
+        found.emplace_back(std::to_string(index) + "=" + std::string{value});
+
+        return true;
+    };
+
+    EXPECT_TRUE(db_->Load(Table::Plain, keys, collect));
+    EXPECT_EQ(
+        found, (std::vector<std::string>{"0=ee", "2=aa", "4=cc", "5=aa"}));
+
+    found.clear();
+    const auto first = [&](const std::size_t index, const auto value) {
+        found.emplace_back(std::to_string(index) + "=" + std::string{value});
+
+        return false;
+    };
+
+    EXPECT_TRUE(db_->Load(Table::Plain, keys, first));
+    EXPECT_EQ(found, (std::vector<std::string>{"0=ee"}));
+
+    found.clear();
+
+    EXPECT_TRUE(db_->Load(Table::Plain, {}, collect));
+    EXPECT_TRUE(found.empty());
+}
+
+TEST_F(Test_LMDB, concurrent_readers)
+{
+    const auto keys = 100;
+    const auto threads = 16;
+    const auto rounds = 200;
+
+    for (auto i = 0; i < keys; ++i) {
+        const auto key = std::to_string(i);
+
+        ASSERT_TRUE(db_->Store(Table::Plain, key, key).first);
+    }
+
+    // More threads than the reader pool retains, each mixing the different
+    // kinds of lookup while a writer keeps committing
+    auto workers = std::vector<std::thread>{};
+    auto writer = std::thread{[&] {
+        for (auto i = 0; i < rounds; ++i) {
+            auto batch = db_->StartBatch();
+            batch.Store(Table::Dups, 1, std::to_string(i));
+            batch.Submit().get();
+        }
+    }};
+
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (auto i = 0; i < rounds; ++i) {
+                const auto key = std::to_string((t * rounds + i) % keys);
+
+                EXPECT_TRUE(db_->Exists(Table::Plain, key));
+                EXPECT_EQ(load(Table::Plain, key).value_or(""), key);
+
+                auto count = 0;
+                db_->Read(
+                    Table::Plain,
+                    [&](const auto, const auto) {
+                        ++count;
+
+                        return true;
+                    },
+                    lmdb::LMDB::Dir::Forward);
+
+                EXPECT_EQ(count, keys);
+            }
+        });
+    }
+
+    writer.join();
+
+    for (auto& worker : workers) { worker.join(); }
+
+    EXPECT_EQ(values(Table::Dups, 1).size(), static_cast<std::size_t>(rounds));
+}
+
+TEST_F(Test_LMDB, dropped_table_cursors)
+{
+    ASSERT_TRUE(db_->Store(Table::Legacy, "old", "value").first);
+    ASSERT_TRUE(db_->Store(Table::Plain, "key", "value").first);
+
+    // Leave pooled cursors open on both tables
+    EXPECT_EQ(load(Table::Legacy, "old").value_or(""), "value");
+    EXPECT_EQ(load(Table::Plain, "key").value_or(""), "value");
+
+    auto migrated = std::vector<std::string>{};
+
+    {
+        auto tx = db_->TransactionRW();
+        MDB_txn* ptr = tx;
+
+        EXPECT_TRUE(db_->ReadAndDelete(
+            Table::Legacy,
+            [&](const auto key, const auto) {
+                migrated.emplace_back(key);
+
+                return true;
+            },
+            *ptr,
+            "test"));
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+
+    EXPECT_EQ(migrated, (std::vector<std::string>{"old"}));
+    EXPECT_EQ(load(Table::Plain, "key").value_or(""), "value");
+    EXPECT_TRUE(db_->Exists(Table::Plain, "key"));
+}
+
+TEST_F(Test_LMDB, sync_interval)
+{
+    ASSERT_TRUE(db_->SyncInterval(std::chrono::milliseconds{50}));
+
+    // Deferred flushing applies to synchronous and batched writes alike
+    EXPECT_TRUE(db_->Store(Table::Plain, "direct", "value").first);
+
+    auto batch = db_->StartBatch();
+    batch.Store(Table::Plain, "batched", "value");
+
+    EXPECT_TRUE(batch.Submit().get());
+    EXPECT_EQ(load(Table::Plain, "direct").value_or(""), "value");
+    EXPECT_EQ(load(Table::Plain, "batched").value_or(""), "value");
+
+    // Give the writer thread a chance to flush, then go idle
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+
+    EXPECT_TRUE(db_->Store(Table::Plain, "late", "value").first);
+    EXPECT_TRUE(db_->SyncInterval(std::chrono::milliseconds{0}));
+    EXPECT_TRUE(db_->Store(Table::Plain, "synchronous", "value").first);
+
+    // Closing the environment flushes anything still outstanding
+    ASSERT_TRUE(db_->SyncInterval(std::chrono::milliseconds{60000}));
+    EXPECT_TRUE(db_->Store(Table::Plain, "unflushed", "value").first);
+
+    db_.reset();
+    db_ = std::make_unique<lmdb::LMDB>(
+        names_,
+        path_.string(),
+        lmdb::TablesToInit{
+            {Table::Plain, 0},
+            {Table::Dups, MDB_DUPSORT | MDB_INTEGERKEY},
+            {Table::Legacy, 0}});
+
+    for (const auto* key :
+         {"direct", "batched", "late", "synchronous", "unflushed"}) {
+        EXPECT_EQ(load(Table::Plain, key).value_or(""), "value");
+    }
+}
+}  // namespace ottest
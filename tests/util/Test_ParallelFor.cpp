@@ -0,0 +1,79 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "util/ParallelFor.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_ParallelFor : public ::testing::Test
+{
+public:
+    std::vector<std::thread> threads_;
+
+    // Runs every job on a new thread
+    auto executor() noexcept -> ot::ParallelExecutor
+    {
+        return [this](std::function<void()> job) {
+            threads_.emplace_back(std::move(job));
+
+            return true;
+        };
+    }
+
+    ~Test_ParallelFor() override
+    {
+        for (auto& thread : threads_) { thread.join(); }
+    }
+};
+
+TEST_F(Test_ParallelFor, every_item_once)
+{
+    constexpr auto count = std::size_t{1000};
+    auto visits = std::vector<std::atomic<int>>(count);
+    ot::ParallelFor(
+        count, 7, executor(), [&](const auto first, const auto last) {
+            EXPECT_LE(last - first, 7u);
+
+            for (auto i{first}; i < last; ++i) { ++visits.at(i); }
+        });
+
+    for (const auto& visited : visits) { EXPECT_EQ(visited.load(), 1); }
+}
+
+TEST_F(Test_ParallelFor, without_executor)
+{
+    const auto caller = std::this_thread::get_id();
+    auto items = std::size_t{0};
+    ot::ParallelFor(10, 3, {}, [&](const auto first, const auto last) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+
+        items += (last - first);
+    });
+
+    EXPECT_EQ(items, 10u);
+}
+
+TEST_F(Test_ParallelFor, failed_executor)
+{
+    auto items = std::atomic<std::size_t>{0};
+    ot::ParallelFor(
+        100,
+        1,
+        [](auto) { return false; },
+        [&](const auto first, const auto last) { items += (last - first); });
+
+    // The caller does the work when no helper could be scheduled
+    EXPECT_EQ(items.load(), 100u);
+}
+}  // namespace ottest